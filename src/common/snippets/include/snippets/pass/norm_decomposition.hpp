@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface NormDecomposition
+ * @brief Decomposes RMS and MVN by the last axis to a range of low-level operations
+ * @ingroup snippets
+ */
+class NormDecomposition : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::NormDecomposition");
+    NormDecomposition();
+};
+
+}  // namespace ov::snippets::pass
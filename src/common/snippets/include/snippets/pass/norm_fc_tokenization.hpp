@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/pass/matcher_pass.hpp"
+#include "snippets/op/subgraph.hpp"
+#include "snippets/pass/tokenization.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface TokenizeNormFCSnippets
+ * @brief The pass tokenizes the normalization by the last axis followed by FullyConnected into Subgraph,
+ *        so the normalized activations are computed per M block right before Brgemm instead of being written
+ *        to memory as a separate tensor. The normalization is decomposed inside the Subgraph (see NormDecomposition).
+ *        Pattern:
+ *              Input
+ *                |
+ *           RMS or MVN
+ *                |
+ *      [Multiply (MVN gamma)]
+ *                |
+ *        [Add (MVN beta)]
+ *                |
+ *          FullyConnected
+ * @ingroup snippets
+ */
+class TokenizeNormFCSnippets : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::TokenizeNormFCSnippets");
+    explicit TokenizeNormFCSnippets(const TokenizationConfig& config);
+
+    /**
+     * @brief Checks whether the Subgraph was tokenized by this pass, so its single Brgemm A input is computed in the
+     *        kernel from the normalized rows
+     */
+    static bool is_norm_fc_subgraph(const std::shared_ptr<const op::Subgraph>& subgraph);
+};
+
+}  // namespace ov::snippets::pass
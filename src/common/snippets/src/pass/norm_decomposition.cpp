@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/norm_decomposition.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/powerstatic.hpp"
+#include "snippets/op/reduce.hpp"
+
+namespace ov::snippets::pass {
+
+namespace {
+
+ov::Output<ov::Node> convert_to(const ov::Output<ov::Node>& value, const element::Type& type) {
+    if (value.get_element_type() == type) {
+        return value;
+    }
+    return std::make_shared<ov::snippets::op::ConvertSaturation>(value, type);
+}
+
+ov::Output<ov::Node> make_scalar(float value) {
+    return std::make_shared<ov::op::v0::Constant>(element::f32, Shape{}, std::vector<float>{value});
+}
+
+// reduceMean by the last axis = reduceSum * (1 / size)
+ov::Output<ov::Node> reduce_mean(const ov::Output<ov::Node>& value, size_t axis, float size_inv) {
+    const auto reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(value, axis);
+    op::ReduceBase::compute_and_set_reduce_subtensors(reduce_sum);
+    return std::make_shared<ov::op::v1::Multiply>(reduce_sum, make_scalar(size_inv));
+}
+
+}  // namespace
+
+// RMS -> x * (1 / Sqrt(ReduceMean(x * x) + eps)) * gamma
+// MVN -> (x - mean) * (1 / Sqrt(ReduceMean((x - mean) ^ 2) + eps)),
+// where mean = ReduceMean(x) and eps can be added outside the Sqrt
+NormDecomposition::NormDecomposition() {
+    MATCHER_SCOPE(NormDecomposition);
+    auto norm_pattern = ov::pass::pattern::wrap_type<ov::op::internal::RMS, ov::op::v6::MVN>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::NormDecomposition")
+        const auto norm = m.get_match_root();
+        const auto& data_shape = norm->get_input_partial_shape(0);
+        OPENVINO_ASSERT(data_shape.rank().is_static() && data_shape.size() > 0 && data_shape.rbegin()->is_static(),
+                        "Normalization decomposition in snippets supports only static normalized dimension");
+        const auto axis = data_shape.size() - 1;
+        const auto size_inv = 1.0F / static_cast<float>(data_shape.rbegin()->get_length());
+
+        const auto data = convert_to(norm->input_value(0), element::f32);
+        std::shared_ptr<ov::Node> result;
+        if (const auto rms = ov::as_type_ptr<ov::op::internal::RMS>(norm)) {
+            const auto sqr = std::make_shared<ov::op::v1::Multiply>(data, data);
+            const auto eps = make_scalar(static_cast<float>(rms->get_epsilon()));
+            const auto eps_add = std::make_shared<ov::op::v1::Add>(reduce_mean(sqr, axis, size_inv), eps);
+            const auto rms_inv =
+                std::make_shared<ov::snippets::op::PowerStatic>(std::make_shared<ov::op::v0::Sqrt>(eps_add), -1.F);
+            result = std::make_shared<ov::op::v1::Multiply>(data, rms_inv);
+            if (rms->get_input_size() > 1) {
+                result = std::make_shared<ov::op::v1::Multiply>(result, convert_to(rms->input_value(1), element::f32));
+            }
+        } else {
+            const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(norm);
+            const auto sub_mean = std::make_shared<ov::op::v1::Subtract>(data, reduce_mean(data, axis, size_inv));
+            result = sub_mean;
+            if (mvn->get_normalize_variance()) {
+                const auto sqr = std::make_shared<ov::op::v1::Multiply>(sub_mean, sub_mean);
+                const auto variance = reduce_mean(sqr, axis, size_inv);
+                const auto eps = make_scalar(mvn->get_eps());
+                std::shared_ptr<ov::Node> stddev;
+                if (mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+                    stddev = std::make_shared<ov::op::v0::Sqrt>(std::make_shared<ov::op::v1::Add>(variance, eps));
+                } else {
+                    stddev = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Sqrt>(variance), eps);
+                }
+                const auto stddev_inv = std::make_shared<ov::snippets::op::PowerStatic>(stddev, -1.F);
+                result = std::make_shared<ov::op::v1::Multiply>(sub_mean, stddev_inv);
+            }
+        }
+
+        const auto output = convert_to(result, norm->get_output_element_type(0));
+        return ov::replace_node_update_name(norm, output.get_node_shared_ptr());
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(norm_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::snippets::pass
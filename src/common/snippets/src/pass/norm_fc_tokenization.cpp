@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/norm_fc_tokenization.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/util/pp.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/op/brgemm.hpp"
+#include "snippets/op/subgraph.hpp"
+#include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/tokenization_config.hpp"
+#include "snippets/utils/tokenization_utils.hpp"
+
+namespace ov::snippets::pass {
+
+namespace {
+
+constexpr const char* norm_fc_subgraph_key = "SnippetsNormFCSubgraph";
+
+bool is_skipped(const std::shared_ptr<ov::Node>& node) {
+    return GetSnippetsNodeType(node) == SnippetsNodeType::SkippedByPlugin;
+}
+
+bool has_one_consumer(const std::shared_ptr<ov::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// Normalization by the last axis, which is K dimension of the FullyConnected
+bool is_supported_norm(const std::shared_ptr<ov::Node>& node) {
+    const auto& shape = node->get_input_partial_shape(0);
+    if (shape.rank().is_dynamic() || shape.size() == 0 || shape.rbegin()->is_dynamic() || !has_one_consumer(node) ||
+        is_skipped(node)) {
+        return false;
+    }
+    if (ov::is_type<ov::op::internal::RMS>(node)) {
+        return true;
+    }
+    if (!ov::is_type<ov::op::v6::MVN>(node)) {
+        return false;
+    }
+    const auto axes = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    if (!axes) {
+        return false;
+    }
+    const auto axes_values = axes->cast_vector<int64_t>();
+    const auto rank = static_cast<int64_t>(shape.size());
+    return axes_values.size() == 1 && (axes_values[0] == -1 || axes_values[0] == rank - 1);
+}
+
+// Per-channel affine transformation applied to the MVN output (gamma or beta)
+bool is_affine_op(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type_any_of<ov::op::v1::Multiply, ov::op::v1::Add>(node) &&
+           ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1)) && has_one_consumer(node) &&
+           !is_skipped(node);
+}
+
+}  // namespace
+
+TokenizeNormFCSnippets::TokenizeNormFCSnippets(const TokenizationConfig& config) {
+    MATCHER_SCOPE(TokenizeNormFCSnippets);
+    using namespace ov::pass::pattern;
+
+    auto m_fc = wrap_type<ov::op::v0::MatMul>({any_input(), wrap_type<ov::op::v0::Constant>()});
+
+    register_matcher(std::make_shared<Matcher>(m_fc, matcher_name), [OV_CAPTURE_CPY_AND_THIS](Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::TokenizeNormFCSnippets")
+        const auto fc = ov::as_type_ptr<ov::op::v0::MatMul>(m.get_match_root());
+        if (!fc || fc->get_transpose_a() || is_skipped(fc) ||
+            ov::snippets::op::Brgemm::get_output_type(fc->get_input_element_type(0), fc->get_input_element_type(1)) ==
+                element::dynamic ||
+            transformation_callback(fc)) {
+            return false;
+        }
+
+        // Collect the chain in the reverse order: FC <- [Add] <- [Multiply] <- Norm
+        ov::NodeVector ordered_ops{fc};
+        auto parent = fc->get_input_node_shared_ptr(0);
+        if (ov::is_type<ov::op::v1::Add>(parent) && is_affine_op(parent)) {
+            ordered_ops.push_back(parent);
+            parent = parent->get_input_node_shared_ptr(0);
+        }
+        if (ov::is_type<ov::op::v1::Multiply>(parent) && is_affine_op(parent)) {
+            ordered_ops.push_back(parent);
+            parent = parent->get_input_node_shared_ptr(0);
+        }
+        // RMS contains gamma, so only MVN can be followed by the affine ops
+        if (!is_supported_norm(parent) || (ordered_ops.size() > 1 && !ov::is_type<ov::op::v6::MVN>(parent))) {
+            return false;
+        }
+        ordered_ops.push_back(parent);
+        std::reverse(ordered_ops.begin(), ordered_ops.end());
+
+        // data input + non-scalar gamma and beta + weights + 1x result
+        size_t io_count = 3;
+        for (const auto& op : ordered_ops) {
+            if (op == fc || ov::is_type<ov::op::v6::MVN>(op)) {
+                continue;
+            }
+            for (size_t i = 1; i < op->get_input_size(); ++i) {
+                io_count += ov::shape_size(op->get_input_shape(i)) != 1 ? 1 : 0;
+            }
+        }
+        // Buffers: the normalized activations and the Brgemm repacking
+        static constexpr size_t n_reg_group = 2;
+        // Loop depth could reach 3 because of SplitLoops optimization
+        static constexpr size_t n_loops_depth = 3;
+        const bool is_dynamic = std::any_of(ordered_ops.begin(), ordered_ops.end(), [](const std::shared_ptr<Node>& n) {
+            return n->is_dynamic();
+        });
+        // The available GPRs are described by the tokenization config, which the plugin fills for its target
+        if (!config.is_gprs_count_sufficient(io_count, n_reg_group, n_loops_depth, is_dynamic)) {
+            return false;
+        }
+
+        const auto subgraph = ov::snippets::utils::tokenize_ordered_nodes(ordered_ops);
+
+        // mark the Subgraph as Completed to not allow Snippets to include any nodes into this Subgraph in common
+        // Tokenization
+        SetSnippetsSubgraphType(subgraph, SnippetsSubgraphType::Completed);
+        subgraph->get_rt_info()[norm_fc_subgraph_key] = true;
+        return true;
+    });
+}
+
+bool TokenizeNormFCSnippets::is_norm_fc_subgraph(const std::shared_ptr<const op::Subgraph>& subgraph) {
+    if (!subgraph) {
+        return false;
+    }
+    const auto& rt = subgraph->get_rt_info();
+    const auto it = rt.find(norm_fc_subgraph_key);
+    return it != rt.end() && it->second.as<bool>();
+}
+
+}  // namespace ov::snippets::pass
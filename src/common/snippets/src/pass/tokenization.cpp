@@ -22,6 +22,7 @@
 #include "snippets/pass/gn_tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/mlp_seq_tokenization.hpp"
+#include "snippets/pass/norm_fc_tokenization.hpp"
 
 namespace ov::snippets::pass {
 
@@ -98,6 +99,7 @@ bool SnippetsTokenization::run_on_model(const std::shared_ptr<ov::Model>& m) {
     manager.register_pass<TokenizeMHASnippets>(m_mha_config);
     manager.register_pass<TokenizeGatedMLPSnippets>(m_tokenization_config);
     manager.register_pass<TokenizeMLPSeqSnippets>(m_mlp_seq_config);
+    manager.register_pass<TokenizeNormFCSnippets>(m_tokenization_config);
 
     auto tokenization_passes = manager.register_pass<ov::pass::GraphRewrite>();
     tokenization_passes->add_matcher<TokenizeGNSnippets>();
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <common_test_utils/ov_test_utils.hpp>
+
+#include "snippets/pass/tokenization_config.hpp"
+#include "subgraph_norm_fc.hpp"
+#include "utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        PartialShape,                    // Input Shape
+        Shape,                           // Weights Shape
+        NormFCFunction::NormType         // Normalization type
+> NormFCParams;
+
+class TokenizeNormFCSnippetsTests : public TransformationTestsF, public testing::WithParamInterface<NormFCParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NormFCParams>& obj);
+
+protected:
+    void SetUp() override;
+
+    ov::snippets::pass::TokenizationConfig base_config = get_default_tokenization_config();
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
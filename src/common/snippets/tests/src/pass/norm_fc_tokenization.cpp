@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "pass/norm_fc_tokenization.hpp"
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/pass/norm_fc_tokenization.hpp"
+#include "snippets/pass/tokenization.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string TokenizeNormFCSnippetsTests::getTestCaseName(const testing::TestParamInfo<NormFCParams>& obj) {
+    const auto& [input_shape, weights_shape, norm_type] = obj.param;
+    std::ostringstream result;
+    result << "IS=" << ov::test::utils::partialShape2str({input_shape}) << "_";
+    result << "WS=" << ov::test::utils::vec2str(weights_shape) << "_";
+    result << "Norm=" << norm_type;
+    return result.str();
+}
+
+void TokenizeNormFCSnippetsTests::SetUp() {
+    TransformationTestsF::SetUp();
+    const auto& [input_shape, weights_shape, norm_type] = this->GetParam();
+    const auto f = NormFCFunction({input_shape}, weights_shape, norm_type);
+    model = f.getOriginal();
+    model_ref = f.getReference();
+
+    manager.register_pass<ov::snippets::pass::EnumerateNodes>();
+    manager.register_pass<ov::snippets::pass::TokenizeNormFCSnippets>(base_config);
+    disable_rt_info_check();
+}
+
+TEST_P(TokenizeNormFCSnippetsTests, smoke_TokenizeNormFCSnippets) {}
+
+namespace TokenizeNormFCSnippetsTestsInstantiation {
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_NormFCTokenize,
+                         TokenizeNormFCSnippetsTests,
+                         ::testing::Combine(::testing::Values(PartialShape{1, 64}, PartialShape{-1, -1, 64}),
+                                            ::testing::Values(Shape{128, 64}),
+                                            ::testing::Values(NormFCFunction::NormType::RMS,
+                                                              NormFCFunction::NormType::MVN)),
+                         TokenizeNormFCSnippetsTests::getTestCaseName);
+
+}  // namespace TokenizeNormFCSnippetsTestsInstantiation
+
+// int8 weights are decompressed and the activations are quantized dynamically by the FullyConnected executor, which
+// has no snippets counterpart, so the normalization is kept standalone
+TEST_F(TransformationTestsF, smoke_Snippets_NormFCTokenize_Int8WeightsAreSkipped) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(element::f32, Shape{1, 64});
+    auto gamma = ov::op::v0::Constant::create(element::f32, Shape{64}, std::vector<float>(64, 0.5F));
+    auto rms = std::make_shared<ov::op::internal::RMS>(data, gamma, 1e-5, element::f32);
+    auto weights = ov::op::v0::Constant::create(element::i8, Shape{128, 64}, std::vector<int8_t>(128 * 64, 3));
+    auto convert = std::make_shared<ov::op::v0::Convert>(weights, element::f32);
+    auto scale = ov::op::v0::Constant::create(element::f32, Shape{128, 1}, std::vector<float>(128, 0.01F));
+    auto decompressed = std::make_shared<ov::op::v1::Multiply>(convert, scale);
+    auto fc = std::make_shared<ov::op::v0::MatMul>(rms, decompressed, false, true);
+    model = std::make_shared<Model>(OutputVector{fc}, ParameterVector{data});
+
+    manager.register_pass<ov::snippets::pass::EnumerateNodes>();
+    manager.register_pass<ov::snippets::pass::TokenizeNormFCSnippets>(get_default_tokenization_config());
+    // model_ref is not set, so the model is expected to stay unchanged
+}
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -108,6 +108,14 @@ void vm_commit(void* ptr, size_t size, std::error_code& ec) noexcept;
  */
 void vm_decommit(void* ptr, size_t size) noexcept;
 
+/**
+ * @brief Advises the OS that the range is going to be read soon, so the backing file pages are read ahead.
+ * Unlike touching the pages it never faults: ranges which are not mapped or not accessible are ignored.
+ * @param ptr   Start of the range, doesn't have to be page-aligned.
+ * @param size  Size of the range in bytes.
+ */
+void vm_hint_willneed(const void* ptr, size_t size) noexcept;
+
 /**
  * @brief Releases the reserved virtual address range. Can be called without a prior vm_decommit().
  * After this call the pointer is invalid and must not be used.
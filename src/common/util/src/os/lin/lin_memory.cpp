@@ -69,6 +69,16 @@ void vm_decommit(void* ptr, size_t size) noexcept {
 #endif
 }
 
+void vm_hint_willneed(const void* ptr, size_t size) noexcept {
+    if (ptr != nullptr && size > 0) {
+        const auto page_size = static_cast<size_t>(get_system_page_size());
+        const auto region = align_region(reinterpret_cast<uintptr_t>(ptr), size, page_size);
+        std::ignore = madvise(reinterpret_cast<void*>(region.m_address),
+                              align_size_up(region.m_length, page_size),
+                              MADV_WILLNEED);
+    }
+}
+
 void vm_release(void* ptr, size_t size) noexcept {
     assert(ptr != nullptr && size > 0);
     std::ignore = munmap(ptr, size);
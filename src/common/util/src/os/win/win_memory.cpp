@@ -53,6 +53,16 @@ void vm_decommit(void* ptr, size_t size) noexcept {
     std::ignore = VirtualFree(ptr, size, MEM_DECOMMIT);
 }
 
+void vm_hint_willneed(const void* ptr, size_t size) noexcept {
+    if (ptr != nullptr && size > 0) {
+        const auto page_size = static_cast<size_t>(get_system_page_size());
+        const auto region = align_region(reinterpret_cast<uintptr_t>(ptr), size, page_size);
+        WIN32_MEMORY_RANGE_ENTRY entry{reinterpret_cast<void*>(region.m_address),
+                                       align_size_up(region.m_length, page_size)};
+        std::ignore = ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &entry, 0);
+    }
+}
+
 void vm_release(void* ptr, size_t) noexcept {
     assert(ptr != nullptr);
     std::ignore = VirtualFree(ptr, 0, MEM_RELEASE);
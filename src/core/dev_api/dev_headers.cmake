@@ -58,4 +58,5 @@ set(DEV_HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/openvino/runtime/string_aligned_buffer.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/xml_util/constant_writer.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/xml_util/xml_serialize_util.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/openvino/xml_util/weight_store.hpp
 )
@@ -71,6 +71,18 @@ struct Context {
     WeightSourceRegistry m_runtime_sources;  //!< Weight sources available in runtime, not stored in cache.
 };
 
+/** @brief Observer of the constant data evictions requested by Extension::hint_evict. */
+struct OPENVINO_API EvictionObserver {
+    virtual ~EvictionObserver();
+
+    /** @brief Called before the constant data is evicted, the eviction proceeds once the call returns.
+     *
+     * @param source_id Source id of the evicted constant.
+     * @param constant_id Id of the evicted constant.
+     */
+    virtual void on_evict(DataID source_id, DataID constant_id) noexcept = 0;
+};
+
 /** @brief Extension iface for classes which manage shared context */
 struct OPENVINO_API Extension {
     /** @brief Get the constant source id for constant node.
@@ -131,6 +143,18 @@ struct OPENVINO_API Extension {
      * @param constant Constant node to evict buffer for.
      */
     static void hint_evict(ov::op::v0::Constant& constant) noexcept;
+
+    /** @brief Registers the observer to be notified about constant data evictions.
+     *
+     * @param observer Observer to register, it has to be removed before it's destroyed.
+     */
+    static void add_eviction_observer(EvictionObserver& observer);
+
+    /** @brief Removes the observer, it's not notified once the call returns.
+     *
+     * @param observer Observer to remove.
+     */
+    static void remove_eviction_observer(EvictionObserver& observer);
 };
 
 /** @brief Get the source buffer for a given source id.
@@ -15,6 +15,8 @@
 
 namespace ov::util {
 
+class WeightStore;
+
 class OPENVINO_API ConstantWriter {
 public:
     using FilePosition = int64_t;
@@ -22,6 +24,11 @@ public:
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
+    /**
+     * @brief Creates writer which stores weights in content-addressed store, so identical weights are shared
+     * with other models serialized into the same store.
+     */
+    explicit ConstantWriter(WeightStore& weight_store);
     virtual ~ConstantWriter();
 
     virtual FilePosition write(const char* ptr,
@@ -43,11 +50,14 @@ private:
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
+    FilePosition write_to_store(const char* ptr, size_t size);
+
     ConstWritePositions m_hash_to_file_positions;
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
+    WeightStore* m_weight_store = nullptr;
 };
 }  // namespace ov::util
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+
+#include "openvino/core/visibility.hpp"
+
+namespace ov {
+class Model;
+}  // namespace ov
+
+namespace ov::util {
+
+/**
+ * @brief Content-addressed weights file which can be shared by several IR models.
+ *
+ * Every weight blob is addressed by a digest of its content computed over fixed-size chunks. A blob which is already
+ * stored (by the current or by any previously serialized model) is referenced by its existing offset instead of being
+ * appended again. A candidate match is always verified byte-by-byte against the stored data, so digest collisions
+ * never alias different weights.
+ *
+ * The digest index is persisted next to the store (`<store>.idx`), which allows to extend the store from several
+ * processes run one after another. Models serialized into one store are read with the store as their weights file,
+ * e.g. `core.read_model("model_a.xml", "weights.ovstore")`, so identical constants of different models resolve to the
+ * same file pages and to the same weight sharing source id at runtime.
+ */
+class OPENVINO_API WeightStore {
+public:
+    using FilePosition = int64_t;
+
+    /** @brief Size of the chunk used to compute content digest. */
+    static constexpr size_t digest_chunk_size = 1024 * 1024;
+
+    /**
+     * @brief Opens the store at given path or creates an empty one if it doesn't exist.
+     * @param path Path to the store data file.
+     */
+    explicit WeightStore(const std::filesystem::path& path);
+    ~WeightStore();
+
+    WeightStore(const WeightStore&) = delete;
+    WeightStore& operator=(const WeightStore&) = delete;
+
+    /**
+     * @brief Adds the data to the store unless identical data is already stored.
+     * @param ptr  Pointer to the data.
+     * @param size Data size in bytes.
+     * @return Offset of the data in the store.
+     */
+    FilePosition write(const char* ptr, size_t size);
+
+    /**
+     * @brief Serializes the model to IR xml file which references weights from this store.
+     * @param model    Model to serialize.
+     * @param xml_path Path to the output xml file.
+     */
+    void serialize(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& xml_path);
+
+    /** @brief Gets the content digest used as a store key. */
+    static uint64_t compute_digest(const char* ptr, size_t size);
+
+    const std::filesystem::path& get_path() const {
+        return m_path;
+    }
+
+    /** @brief Gets the store size in bytes. */
+    size_t size() const {
+        return static_cast<size_t>(m_end);
+    }
+
+    /** @brief Gets the number of unique blobs in the store. */
+    size_t get_blob_count() const {
+        return m_entries.size();
+    }
+
+private:
+    friend class ConstantWriter;
+
+    struct Entry {
+        FilePosition m_offset;
+        size_t m_size;
+    };
+
+    bool is_stored(const char* ptr, const Entry& entry);
+    void load_index();
+
+    std::filesystem::path m_path;
+    std::fstream m_data;
+    std::ofstream m_index;
+    std::unordered_multimap<uint64_t, Entry> m_entries;
+    FilePosition m_end;
+};
+}  // namespace ov::util
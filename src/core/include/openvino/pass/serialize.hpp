@@ -46,6 +46,17 @@ public:
               const std::filesystem::path& bin_path,
               Version version = Version::UNSPECIFIED);
 
+protected:
+    /**
+     * @brief Serializes the model to xml file, the constants are written by given writer instead of a bin file.
+     * @param xml_path        Path to the output xml file.
+     * @param constant_writer Writer of the constants, it must outlive the transformation.
+     * @param version         IR version.
+     */
+    Serialize(const std::filesystem::path& xml_path,
+              util::ConstantWriter& constant_writer,
+              Version version = Version::UNSPECIFIED);
+
 private:
     std::ostream* m_xml_file;
     std::ostream* m_bin_file;
@@ -53,6 +64,7 @@ private:
     const std::filesystem::path m_bin_path;
     const Version m_version;
     const std::map<std::string, ov::OpSet> m_custom_opsets;
+    util::ConstantWriter* m_constant_writer = nullptr;
 };
 
 /**
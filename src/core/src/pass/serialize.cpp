@@ -52,12 +52,11 @@ inline void convert_py_rt_info(std::shared_ptr<ov::Model> model) {
     ov::pass::ConvertLegacyPrecisionAttribute().run_on_model(model);
 }
 
-void serialize_func(std::ostream& xml_file,
-                    std::ostream& bin_file,
-                    std::shared_ptr<ov::Model> model,
-                    ov::pass::Serialize::Version ver,
-                    bool deterministic,
-                    ov::util::ConstantWriter& constant_writer) {
+void serialize_xml(std::ostream& xml_file,
+                   std::shared_ptr<ov::Model> model,
+                   ov::pass::Serialize::Version ver,
+                   bool deterministic,
+                   ov::util::ConstantWriter& constant_writer) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -84,6 +83,15 @@ void serialize_func(std::ostream& xml_file,
 
     xml_doc.save(xml_file);
     xml_file.flush();
+}
+
+void serialize_func(std::ostream& xml_file,
+                    std::ostream& bin_file,
+                    std::shared_ptr<ov::Model> model,
+                    ov::pass::Serialize::Version ver,
+                    bool deterministic,
+                    ov::util::ConstantWriter& constant_writer) {
+    serialize_xml(xml_file, std::move(model), ver, deterministic, constant_writer);
     bin_file.flush();
 }
 
@@ -105,6 +113,34 @@ void handle_file_serialize_error(const std::filesystem::path& xml_path,
     std::ignore = std::filesystem::remove(xml_path);
     std::ignore = std::filesystem::remove(bin_path);
 }
+
+void handle_file_serialize_error(const std::filesystem::path& xml_path, std::ofstream& xml) {
+    xml.close();
+    std::ignore = std::filesystem::remove(xml_path);
+}
+
+// The constants are written by external writer (e.g. to a weight store), only the xml file is created.
+void serialize_func(const std::filesystem::path& xml_path,
+                    std::shared_ptr<ov::Model> model,
+                    ov::pass::Serialize::Version ver,
+                    ov::util::ConstantWriter& constant_writer) {
+    ov::util::create_directory_recursive(xml_path.parent_path());
+
+    std::ofstream xml_file(xml_path);
+    OPENVINO_ASSERT(xml_file, "Can't open xml file: ", xml_path);
+    xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+    // the xml file is the only file created here, the writer keeps its own data consistent on failure
+    try {
+        serialize_xml(xml_file, std::move(model), ver, false, constant_writer);
+    } catch (const ov::Exception&) {
+        handle_file_serialize_error(xml_path, xml_file);
+        throw;
+    } catch (const std::ios_base::failure&) {
+        handle_file_serialize_error(xml_path, xml_file);
+        throw;
+    }
+}
 }  // namespace
 
 namespace ov {
@@ -117,6 +153,8 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
 
     if (m_xml_file && m_bin_file) {
         serialize_func(*m_xml_file, *m_bin_file, model, m_version);
+    } else if (m_constant_writer) {
+        serialize_func(m_xml_path, model, m_version, *m_constant_writer);
     } else {
         ov::util::create_directory_recursive(m_xml_path.parent_path());
 
@@ -165,6 +203,18 @@ pass::Serialize::Serialize(const std::filesystem::path& xml_path,
     validate_xml_path(m_xml_path);
 }
 
+pass::Serialize::Serialize(const std::filesystem::path& xml_path,
+                           util::ConstantWriter& constant_writer,
+                           Version version)
+    : m_xml_file{nullptr},
+      m_bin_file{nullptr},
+      m_xml_path{xml_path},
+      m_bin_path{},
+      m_version{version},
+      m_constant_writer{&constant_writer} {
+    validate_xml_path(m_xml_path);
+}
+
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        const std::function<void(std::ostream&)>& custom_data_serializer,
                                        const std::function<std::string(const std::string&)>& cache_encrypt,
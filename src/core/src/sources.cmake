@@ -383,4 +383,5 @@ set(LIBRARY_SRC
     ${CMAKE_CURRENT_LIST_DIR}/type/nf4.cpp
     ${CMAKE_CURRENT_LIST_DIR}/xml_util/constant_writer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/xml_util/xml_serialize_util.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/xml_util/weight_store.cpp
 )
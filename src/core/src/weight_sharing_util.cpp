@@ -4,6 +4,10 @@
 
 #include "openvino/core/weight_sharing_util.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 #include "openvino/core/model.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
@@ -35,6 +39,16 @@ const ov::wsh::WeightMetaData* get_constant_meta(const ov::wsh::WeightRegistry&
     }
     return nullptr;
 };
+
+struct EvictionObservers {
+    std::mutex m_mutex;
+    std::vector<ov::wsh::EvictionObserver*> m_observers;
+};
+
+EvictionObservers& get_eviction_observers() {
+    static EvictionObservers observers;
+    return observers;
+}
 }  // namespace
 
 namespace ov::weight_sharing {
@@ -99,14 +113,37 @@ std::shared_ptr<ov::AlignedBuffer> Extension::get_constant_source_buffer(const o
     return desc ? desc->get_source_buffer() : nullptr;
 }
 
+EvictionObserver::~EvictionObserver() = default;
+
 void Extension::hint_evict(ov::op::v0::Constant& constant) noexcept {
     if (constant.m_data) {
-        if (constant.m_data->get_descriptor()) {
+        if (const auto desc = constant.m_data->get_descriptor()) {
+            try {
+                auto& observers = get_eviction_observers();
+                std::lock_guard lock{observers.m_mutex};
+                for (const auto observer : observers.m_observers) {
+                    observer->on_evict(desc->get_id(), desc->get_offset());
+                }
+            } catch (...) {
+            }
             constant.m_data->hint_evict();
         }
     }
 }
 
+void Extension::add_eviction_observer(EvictionObserver& observer) {
+    auto& observers = get_eviction_observers();
+    std::lock_guard lock{observers.m_mutex};
+    observers.m_observers.push_back(&observer);
+}
+
+void Extension::remove_eviction_observer(EvictionObserver& observer) {
+    auto& observers = get_eviction_observers();
+    std::lock_guard lock{observers.m_mutex};
+    observers.m_observers.erase(std::remove(observers.m_observers.begin(), observers.m_observers.end(), &observer),
+                                observers.m_observers.end());
+}
+
 std::shared_ptr<ov::AlignedBuffer> get_source_buffer(const Context& shared_context, const DataID source_id) {
     const auto& weights = shared_context.m_cache_sources;
     if (auto weight_it = weights.find(source_id); weight_it != weights.end()) {
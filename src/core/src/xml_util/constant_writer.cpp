@@ -8,6 +8,7 @@
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/hash_util.hpp"
+#include "openvino/xml_util/weight_store.hpp"
 
 namespace ov::util {
 
@@ -18,8 +19,18 @@ ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
       m_blob_offset(bin_data.tellp()),
       m_data_hash{} {}
 
+ConstantWriter::ConstantWriter(WeightStore& weight_store) : ConstantWriter(weight_store.m_data, true) {
+    m_weight_store = &weight_store;
+}
+
 ConstantWriter::~ConstantWriter() = default;
 
+ConstantWriter::FilePosition ConstantWriter::write_to_store(const char* ptr, size_t size) {
+    // The store deduplicates by content itself, also against weights of previously serialized models.
+    m_data_hash = util::u64_hash_combine(m_data_hash, WeightStore::compute_digest(ptr, size));
+    return m_weight_store->write(ptr, size);
+}
+
 ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    size_t size,
                                                    size_t& new_size,
@@ -33,6 +44,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
     const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
+    if (m_weight_store) {
+        return write_to_store(data_ptr, new_size);
+    }
+
     if (m_enable_compression) {
         // This hash is weak (but efficient). For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays.
@@ -66,6 +81,15 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     for (const auto& sv : chunks)
         new_size += sv.size();
 
+    if (m_weight_store) {
+        std::vector<char> tmp;
+        tmp.reserve(new_size);
+        for (const auto& sv : chunks) {
+            tmp.insert(tmp.end(), sv.begin(), sv.end());
+        }
+        return write_to_store(tmp.data(), new_size);
+    }
+
     if (m_enable_compression) {
         std::vector<char> tmp(new_size);
         char* dst = tmp.data();
@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/xml_util/weight_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/hash_util.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
+
+namespace ov::util {
+namespace {
+// Index record layout: {digest, offset, size}
+using IndexRecord = std::array<uint64_t, 3>;
+
+std::filesystem::path make_index_path(const std::filesystem::path& path) {
+    auto index_path = path;
+    index_path += ".idx";
+    return index_path;
+}
+
+// Serialize transformation which writes the constants to the store instead of a bin file
+class WeightStoreSerialize : public ov::pass::Serialize {
+public:
+    WeightStoreSerialize(const std::filesystem::path& xml_path, ConstantWriter& constant_writer)
+        : ov::pass::Serialize(xml_path, constant_writer) {}
+};
+}  // namespace
+
+WeightStore::WeightStore(const std::filesystem::path& path) : m_path(path), m_end(0) {
+    if (!ov::util::file_exists(m_path)) {
+        if (m_path.has_parent_path()) {
+            ov::util::create_directory_recursive(m_path.parent_path());
+        }
+        std::ofstream create(m_path, std::ios::binary);
+        OPENVINO_ASSERT(create, "Can't create weight store file: ", m_path);
+        std::ignore = std::filesystem::remove(make_index_path(m_path));
+    }
+    m_data.open(m_path, std::ios::in | std::ios::out | std::ios::binary);
+    OPENVINO_ASSERT(m_data, "Can't open weight store file: ", m_path);
+    m_data.seekp(0, std::ios::end);
+    m_end = m_data.tellp();
+
+    load_index();
+    m_index.open(make_index_path(m_path), std::ios::binary | std::ios::app);
+    OPENVINO_ASSERT(m_index, "Can't open weight store index: ", make_index_path(m_path));
+}
+
+WeightStore::~WeightStore() = default;
+
+void WeightStore::load_index() {
+    std::ifstream index(make_index_path(m_path), std::ios::binary);
+    for (IndexRecord record{}; index.read(reinterpret_cast<char*>(record.data()), sizeof(record));) {
+        const auto& [digest, offset, size] = record;
+        // Records which point beyond the data file (e.g. after an interrupted write) are dropped.
+        if (offset <= static_cast<uint64_t>(m_end) && size <= static_cast<uint64_t>(m_end) - offset) {
+            m_entries.emplace(digest, Entry{static_cast<FilePosition>(offset), static_cast<size_t>(size)});
+        }
+    }
+}
+
+uint64_t WeightStore::compute_digest(const char* ptr, size_t size) {
+    uint64_t digest = util::u64_hash_combine(0, size);
+    for (size_t offset = 0; offset < size; offset += digest_chunk_size) {
+        const auto chunk_size = std::min(digest_chunk_size, size - offset);
+        digest = util::u64_hash_combine(digest, ov::runtime::compute_hash(ptr + offset, chunk_size));
+    }
+    return digest;
+}
+
+bool WeightStore::is_stored(const char* ptr, const Entry& entry) {
+    std::vector<char> chunk(std::min(digest_chunk_size, entry.m_size));
+    m_data.seekg(entry.m_offset);
+    for (size_t offset = 0; offset < entry.m_size; offset += chunk.size()) {
+        const auto chunk_size = std::min(chunk.size(), entry.m_size - offset);
+        if (!m_data.read(chunk.data(), chunk_size) || std::memcmp(chunk.data(), ptr + offset, chunk_size) != 0) {
+            m_data.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+WeightStore::FilePosition WeightStore::write(const char* ptr, size_t size) {
+    const auto digest = compute_digest(ptr, size);
+    const auto found = m_entries.equal_range(digest);
+    for (auto it = found.first; it != found.second; ++it) {
+        if (it->second.m_size == size && is_stored(ptr, it->second)) {
+            return it->second.m_offset;
+        }
+    }
+
+    const auto offset = m_end;
+    m_data.seekp(offset);
+    m_data.write(ptr, size);
+    OPENVINO_ASSERT(m_data, "Can't write to weight store file: ", m_path);
+    m_data.flush();
+    m_end += static_cast<FilePosition>(size);
+
+    // The index record is written after the data, so the index never references a partially written blob.
+    const IndexRecord record{digest, static_cast<uint64_t>(offset), static_cast<uint64_t>(size)};
+    m_index.write(reinterpret_cast<const char*>(record.data()), sizeof(record));
+    m_index.flush();
+    m_entries.emplace(digest, Entry{offset, size});
+    return offset;
+}
+
+void WeightStore::serialize(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& xml_path) {
+    ConstantWriter constant_writer(*this);
+    WeightStoreSerialize(xml_path, constant_writer).run_on_model(model);
+}
+}  // namespace ov::util
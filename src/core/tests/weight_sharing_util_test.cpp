@@ -250,6 +250,33 @@ TEST_F(WeightShareExtensionTest, set_constant_buffer_with_id) {
     EXPECT_EQ(const_type, element::f32);
 }
 
+TEST_F(WeightShareExtensionTest, hint_evict_notifies_eviction_observers) {
+    struct Observer : weight_sharing::EvictionObserver {
+        void on_evict(weight_sharing::DataID source_id, weight_sharing::DataID constant_id) noexcept override {
+            m_evicted.emplace_back(source_id, constant_id);
+        }
+        std::vector<std::pair<weight_sharing::DataID, weight_sharing::DataID>> m_evicted;
+    } observer;
+
+    auto buffer = std::make_shared<ov::AlignedBuffer>(4000);
+    auto wt_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+        buffer->get_ptr<char>() + 100,
+        buffer->size() - 100,
+        buffer,
+        ov::create_base_descriptor(12, 0, buffer));
+    auto c = Constant(element::f32, Shape{975}, wt_buffer);
+    auto in_memory = Constant(element::f32, Shape{2, 2}, std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+
+    weight_sharing::Extension::add_eviction_observer(observer);
+    weight_sharing::Extension::hint_evict(c);
+    weight_sharing::Extension::hint_evict(in_memory);
+    weight_sharing::Extension::remove_eviction_observer(observer);
+    weight_sharing::Extension::hint_evict(c);
+
+    ASSERT_EQ(observer.m_evicted.size(), 1);
+    EXPECT_EQ(observer.m_evicted[0], std::make_pair(weight_sharing::DataID{12}, weight_sharing::DataID{100}));
+}
+
 TEST_F(WeightShareExtensionTest, get_origin_meta_data_from_constant) {
     auto c = Constant(element::f32, Shape{2, 2}, std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
     c.get_rt_info()[ov::WeightlessCacheAttribute::get_type_info_static()] =
@@ -5,4 +5,5 @@
 set(OV_CORE_TESTS_XML_UTIL_SRCS
     ${CMAKE_CURRENT_LIST_DIR}/custom_ir.cpp
     ${CMAKE_CURRENT_LIST_DIR}/xml_parse_utils_test.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/weight_store_test.cpp
 )
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/xml_util/weight_store.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/graph_comparator.hpp"
+#include "openvino/core/weight_sharing_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/util/file_util.hpp"
+#include "pass/serialization/read_ir.hpp"
+
+namespace ov::test {
+
+using op::v0::Parameter, op::v0::Constant, op::v1::Add, op::v1::Multiply;
+
+class WeightStoreTest : public testing::Test {
+protected:
+    void SetUp() override {
+        ov::util::create_directory_recursive(m_test_dir);
+    }
+
+    void TearDown() override {
+        if (util::directory_exists(m_test_dir)) {
+            std::filesystem::remove_all(m_test_dir);
+        }
+    }
+
+    static std::shared_ptr<Constant> make_weights(float start, size_t size = 1024) {
+        std::vector<float> values(size);
+        std::iota(values.begin(), values.end(), start);
+        return Constant::create(element::f32, Shape{size}, values);
+    }
+
+    // Fine-tuned variant: the shared base weights plus variant specific scale.
+    static std::shared_ptr<Model> make_variant(float scale_start) {
+        auto param = std::make_shared<Parameter>(element::f32, Shape{1024});
+        auto add = std::make_shared<Add>(param, make_weights(0.0f));
+        auto mul = std::make_shared<Multiply>(add, make_weights(scale_start));
+        return std::make_shared<Model>(mul->outputs(), ParameterVector{param}, "variant");
+    }
+
+    static const Constant& get_constant(const Model& model, const std::string& type_name, size_t input) {
+        for (const auto& node : model.get_ordered_ops()) {
+            if (node->get_type_name() == type_name) {
+                return *as_type<Constant>(node->get_input_node_ptr(input));
+            }
+        }
+        OPENVINO_THROW("Node not found: ", type_name);
+    }
+
+    static FunctionsComparator model_comparator() {
+        return FunctionsComparator::with_default()
+            .enable(FunctionsComparator::ATTRIBUTES)
+            .enable(FunctionsComparator::CONST_VALUES);
+    }
+
+    std::filesystem::path m_test_dir = utils::generateTestFilePrefix();
+    std::filesystem::path m_store_path = m_test_dir / "weights.ovstore";
+};
+
+TEST_F(WeightStoreTest, deduplicate_weights_across_models) {
+    constexpr size_t blob_size = 1024 * sizeof(float);
+    const auto model_a = make_variant(1.0f);
+    const auto model_b = make_variant(2.0f);
+
+    {
+        util::WeightStore store(m_store_path);
+        store.serialize(model_a, m_test_dir / "model_a.xml");
+        store.serialize(model_b, m_test_dir / "model_b.xml");
+
+        EXPECT_EQ(store.get_blob_count(), 3u);
+        EXPECT_EQ(store.size(), 3 * blob_size);
+    }
+    EXPECT_EQ(static_cast<size_t>(util::file_size(m_store_path)), 3 * blob_size);
+
+    const auto read_a = readModel(util::path_to_string(m_test_dir / "model_a.xml"), util::path_to_string(m_store_path));
+    const auto read_b = readModel(util::path_to_string(m_test_dir / "model_b.xml"), util::path_to_string(m_store_path));
+
+    const auto res_a = model_comparator().compare(read_a, model_a);
+    EXPECT_TRUE(res_a.valid) << res_a.message;
+    const auto res_b = model_comparator().compare(read_b, model_b);
+    EXPECT_TRUE(res_b.valid) << res_b.message;
+
+    // Shared weights resolve to the same weight sharing source and constant id.
+    const auto& base_a = get_constant(*read_a, "Add", 1);
+    const auto& base_b = get_constant(*read_b, "Add", 1);
+    EXPECT_EQ(wsh::Extension::get_constant_source_id(base_a), wsh::Extension::get_constant_source_id(base_b));
+    EXPECT_EQ(wsh::Extension::get_constant_id(base_a), wsh::Extension::get_constant_id(base_b));
+    EXPECT_NE(wsh::Extension::get_constant_id(get_constant(*read_a, "Multiply", 1)),
+              wsh::Extension::get_constant_id(get_constant(*read_b, "Multiply", 1)));
+}
+
+TEST_F(WeightStoreTest, reopen_store_keeps_index) {
+    constexpr size_t blob_size = 1024 * sizeof(float);
+    {
+        util::WeightStore store(m_store_path);
+        store.serialize(make_variant(1.0f), m_test_dir / "model_a.xml");
+    }
+
+    util::WeightStore store(m_store_path);
+    EXPECT_EQ(store.get_blob_count(), 2u);
+    store.serialize(make_variant(1.0f), m_test_dir / "model_a_copy.xml");
+    store.serialize(make_variant(3.0f), m_test_dir / "model_c.xml");
+
+    EXPECT_EQ(store.get_blob_count(), 3u);
+    EXPECT_EQ(store.size(), 3 * blob_size);
+}
+
+TEST_F(WeightStoreTest, keeps_ir_version_from_rt_info) {
+    const auto model = make_variant(1.0f);
+    model->get_rt_info()["version"] = int64_t{10};
+
+    util::WeightStore store(m_store_path);
+    store.serialize(model, m_test_dir / "model_v10.xml");
+
+    std::ifstream xml(m_test_dir / "model_v10.xml");
+    const std::string content{std::istreambuf_iterator<char>(xml), std::istreambuf_iterator<char>()};
+    EXPECT_NE(content.find("version=\"10\""), std::string::npos);
+}
+
+TEST_F(WeightStoreTest, failed_serialize_removes_xml) {
+    const auto model = make_variant(1.0f);
+    model->get_rt_info()["version"] = int64_t{12};
+    const auto xml_path = m_test_dir / "model_unsupported.xml";
+
+    util::WeightStore store(m_store_path);
+    EXPECT_THROW(store.serialize(model, xml_path), ov::Exception);
+    EXPECT_FALSE(util::file_exists(xml_path));
+}
+
+TEST_F(WeightStoreTest, digest_collision_is_verified) {
+    util::WeightStore store(m_store_path);
+    // Current hash gives the same value for {2, 2} and {0, 128} arrays, both blobs have to be stored.
+    const std::array<uint8_t, 2> a{2, 2}, b{0, 128};
+
+    const auto offset_a = store.write(reinterpret_cast<const char*>(a.data()), a.size());
+    const auto offset_b = store.write(reinterpret_cast<const char*>(b.data()), b.size());
+
+    EXPECT_NE(offset_a, offset_b);
+    EXPECT_EQ(store.write(reinterpret_cast<const char*>(a.data()), a.size()), offset_a);
+    EXPECT_EQ(store.write(reinterpret_cast<const char*>(b.data()), b.size()), offset_b);
+    EXPECT_EQ(store.size(), a.size() + b.size());
+}
+}  // namespace ov::test
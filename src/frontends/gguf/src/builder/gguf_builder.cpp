@@ -68,7 +68,7 @@ ov::AnyMap extract_tokenizer_config(const std::unordered_map<std::string, GGUFMe
 }  // namespace
 
 std::shared_ptr<GgufGraph> build_ggml_graph_from_gguf(const std::string& file) {
-    auto [metadata, weights, qtypes, mmap, quant_buf] = get_gguf_data(file);
+    auto [metadata, weights, qtypes, mmap, quant_bufs] = get_gguf_data(file);
 
     // Decide the family FIRST: the metadata key layout differs per family, so reading any
     // decoder hyperparameter before this point would misreport an mmproj file as a broken LLM.
@@ -10,12 +10,18 @@
 #include "gguf.hpp"
 #include "weights.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <optional>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -350,7 +356,7 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-GGUFLoad get_gguf_data(const std::string& file) {
+GGUFLoad get_gguf_data(const std::string& file, size_t decode_budget) {
     std::unordered_map<std::string, GGUFMetaData> metadata;
     std::unordered_map<std::string, ov::Tensor> arrays;
     std::unordered_map<std::string, gguf_tensor_type> qtype;
@@ -535,9 +541,11 @@ GGUFLoad get_gguf_data(const std::string& file) {
         return {w_bytes, s_bytes, z_bytes};
     };
 
-    // ---- Pass 1: total bytes needed for all repacked quantized data ----
-    size_t total_quant_bytes = 0;
-    for (const auto& ti : infos) {
+    // ---- Pass 1: bytes each quantized tensor reads from the mapping and writes to its repacked copy ----
+    std::vector<size_t> out_bytes(infos.size(), 0);
+    std::vector<size_t> job_bytes(infos.size(), 0);
+    for (size_t t = 0; t < infos.size(); ++t) {
+        const auto& ti = infos[t];
         const bool is_quant = ti.type == GGUF_TYPE_Q4_0 || ti.type == GGUF_TYPE_Q4_1 || ti.type == GGUF_TYPE_Q5_0 ||
                               ti.type == GGUF_TYPE_Q5_1 || ti.type == GGUF_TYPE_Q8_0 || ti.type == GGUF_TYPE_Q2_K ||
                               ti.type == GGUF_TYPE_Q3_K || ti.type == GGUF_TYPE_Q4_K || ti.type == GGUF_TYPE_Q5_K ||
@@ -546,18 +554,29 @@ GGUFLoad get_gguf_data(const std::string& file) {
         if (!is_quant)
             continue;
         auto [wb, sb, bb] = quant_sizes(ti);
-        size_t sum = 0;
-        OPENVINO_ASSERT(!ov::util::add_overflow(wb, sb, sum) && !ov::util::add_overflow(sum, bb, sum) &&
-                            !ov::util::add_overflow(total_quant_bytes, sum, total_quant_bytes),
-                        "[load_gguf] total quantized buffer size overflows size_t");
+        const auto tr = type_traits(ti.type);
+        const size_t src_bytes =
+            size_prod(ov::Shape(ti.dim, ti.dim + ti.ndim)) / tr.items_per_block * tr.bytes_per_block;
+        OPENVINO_ASSERT(!ov::util::add_overflow(wb, sb, out_bytes[t]) &&
+                            !ov::util::add_overflow(out_bytes[t], bb, out_bytes[t]) &&
+                            !ov::util::add_overflow(out_bytes[t], src_bytes, job_bytes[t]),
+                        "[load_gguf] quantized buffer size of tensor '",
+                        ti.name,
+                        "' overflows size_t");
     }
 
-    // Single allocation for all repacked quantized data (IR-frontend AlignedBuffer pattern).
-    auto quant_buf = std::make_shared<ov::AlignedBuffer>(total_quant_bytes > 0 ? total_quant_bytes : 1);
-
-    // ---- Pass 2: materialize tensors, slicing into quant_buf for quantized ones ----
+    // ---- Pass 2: materialize tensors batch by batch, slicing the quantized ones into the batch buffer ----
+    // Every batch touches at most decode_budget bytes: its slice of the mapping and the repacked copy. The
+    // copy is allocated when the batch starts and the source pages are evicted once it is decoded, so neither
+    // a model-sized allocation nor a model-sized resident mapping is ever needed on top of the result.
+    // Slices are laid out serially; the repacking itself is deferred to the end of the batch so that tensors
+    // can be decoded concurrently instead of one after another.
+    const auto batches = split_decode_batches(job_bytes, decode_budget);
+    std::vector<std::shared_ptr<ov::AlignedBuffer>> quant_bufs;
+    std::shared_ptr<ov::AlignedBuffer> quant_buf;
+    std::vector<std::function<void()>> decode_jobs;
     size_t quant_offset = 0;
-    for (const auto& ti : infos) {
+    auto materialize = [&](const TensorInfo& ti) {
         gguf_tensor tensor;
         tensor.name = ti.name.data();
         tensor.namelen = ti.name.size();
@@ -624,8 +643,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor scales(s_view, so_buf);
             quant_offset += sb;
 
-            gguf_fill_q4_0(tensor, weights, scales);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_q4_0(tensor, weights, scales);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -648,8 +669,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor scales(s_view, so_buf);
             quant_offset += sb;
 
-            gguf_fill_sym(tensor, weights, scales);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_sym(tensor, weights, scales);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -674,8 +697,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor zp(scales.get_element_type(), scale_shape);
             quant_offset += zb;
 
-            gguf_fill_asym(tensor, weights, scales, zp);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_asym(tensor, weights, scales, zp);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -703,8 +728,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor zp(ov::element::u8, scale_shape);
             quant_offset += zb;
 
-            gguf_fill_q2_0(tensor, weights, scales, zp);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_q2_0(tensor, weights, scales, zp);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -729,8 +756,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor scales_t(s_view, so_buf);
             quant_offset += sb;
 
-            gguf_fill_sym(tensor, weights_t, scales_t);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_sym(tensor, weights_t, scales_t);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights_t));
             arrays.emplace(name_prefix + ".scales", std::move(scales_t));
@@ -754,8 +783,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor scales(s_view, so_buf);
             quant_offset += sb;
 
-            gguf_fill_sym(tensor, weights, scales);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_sym(tensor, weights, scales);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -796,8 +827,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor zp(zp_elem, scale_shape);
             quant_offset += zb;
 
-            gguf_fill_asym(tensor, weights, scales, zp);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_asym(tensor, weights, scales, zp);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             arrays.emplace(name, std::move(weights));
             arrays.emplace(name_prefix + ".scales", std::move(scales));
@@ -827,8 +860,10 @@ GGUFLoad get_gguf_data(const std::string& file) {
             ov::Tensor scales(s_view, so_buf);
             quant_offset += sb;
 
-            gguf_fill_mxfp4(tensor, weights, scales);
-            mapped->hint_evict(abs_off, tensor.bsize);
+            decode_jobs.emplace_back([=]() mutable {
+                gguf_fill_mxfp4(tensor, weights, scales);
+                mapped->hint_evict(abs_off, tensor.bsize);
+            });
 
             constexpr std::string_view weight_suffix = ".weight";
             const std::string prefix = name.substr(0, name.length() - weight_suffix.length());
@@ -844,9 +879,63 @@ GGUFLoad get_gguf_data(const std::string& file) {
                 qtype.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(ti.type));
             }
         }
+    };
+
+    for (const auto& [begin, end] : batches) {
+        const size_t batch_bytes = std::accumulate(out_bytes.begin() + begin, out_bytes.begin() + end, size_t{0});
+        if (batch_bytes > 0) {
+            quant_buf = std::make_shared<ov::AlignedBuffer>(batch_bytes);
+            quant_bufs.push_back(quant_buf);
+            quant_offset = 0;
+        }
+        for (size_t t = begin; t < end; ++t) {
+            materialize(infos[t]);
+        }
+        // Each fill function is parallel inside the tensor, which leaves most threads idle on the many small
+        // tensors (norms, biases, small projections), so the jobs of a batch run concurrently.
+        ov::parallel_for(decode_jobs.size(), [&](size_t i) {
+            decode_jobs[i]();
+        });
+        decode_jobs.clear();
     }
 
-    return {metadata, arrays, qtype, mapped, quant_buf};
+    return {metadata, arrays, qtype, mapped, quant_bufs};
+}
+
+size_t default_decode_memory_budget() {
+    static const size_t budget = [] {
+        constexpr size_t one_mb = size_t{1} << 20;
+        const char* env = std::getenv("OV_GGUF_DECODE_MEMORY_BUDGET");
+        if (env == nullptr || *env == '\0') {
+            return 1024 * one_mb;
+        }
+        char* end = nullptr;
+        const unsigned long long mb = std::strtoull(env, &end, 10);
+        OPENVINO_ASSERT(*end == '\0' && mb > 0 && mb <= std::numeric_limits<size_t>::max() / one_mb,
+                        "[GGUF] OV_GGUF_DECODE_MEMORY_BUDGET must be a positive size in MiB, got '",
+                        env,
+                        "'");
+        return static_cast<size_t>(mb) * one_mb;
+    }();
+    return budget;
+}
+
+std::vector<std::pair<size_t, size_t>> split_decode_batches(const std::vector<size_t>& sizes, size_t budget) {
+    std::vector<std::pair<size_t, size_t>> batches;
+    size_t begin = 0, batch_size = 0;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        // A tensor larger than the budget forms a batch of its own.
+        if (i != begin && sizes[i] > budget - batch_size) {
+            batches.emplace_back(begin, i);
+            begin = i;
+            batch_size = 0;
+        }
+        batch_size = sizes[i] > budget - batch_size ? budget : batch_size + sizes[i];
+    }
+    if (begin != sizes.size()) {
+        batches.emplace_back(begin, sizes.size());
+    }
+    return batches;
 }
 
 std::map<std::string, GGUFMetaData> decoder_config_from_meta(
@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -85,15 +86,15 @@ struct gguf_tensor {
 using GGUFMetaData =
     std::variant<std::monostate, float, int, ov::Tensor, std::string, std::vector<std::string>, std::vector<int32_t>>;
 
-// GGUFLoad result: (metadata, tensor arrays, qtype map, mmap, quant_buf).
+// GGUFLoad result: (metadata, tensor arrays, qtype map, mmap, quant_bufs).
 // - mmap: must stay alive while arrays tensors are used (non-quantized tensors are mmap views).
-// - quant_buf: single AlignedBuffer holding all repacked quantized weight/scale/bias data;
-//   tensors in `arrays` for quantized weights are SharedBuffer slices into this buffer.
+// - quant_bufs: one AlignedBuffer per decode batch holding the repacked quantized weight/scale/bias
+//   data of that batch; tensors in `arrays` for quantized weights are SharedBuffer slices into them.
 using GGUFLoad = std::tuple<std::unordered_map<std::string, GGUFMetaData>,
                             std::unordered_map<std::string, ov::Tensor>,
                             std::unordered_map<std::string, gguf_tensor_type>,
                             std::shared_ptr<ov::MappedMemory>,
-                            std::shared_ptr<ov::AlignedBuffer>>;
+                            std::vector<std::shared_ptr<ov::AlignedBuffer>>>;
 
 // Fill pre-allocated i4 weights (u32-packed, XORed for i4 sign) and f16 scales from a
 // Q4_0 tensor. No bias: Q4_0 is symmetric (zp = -8*scale is implicit, not stored).
@@ -132,11 +133,20 @@ void dequant_row_q4_k_f32_for_test(const uint8_t* row, size_t cols, float* y);
 void dequant_row_q5_k_f32_for_test(const uint8_t* row, size_t cols, float* y);
 void dequant_row_q6_k_f32_for_test(const uint8_t* row, size_t cols, float* y);
 
-// Parse a GGUF file: returns (metadata, tensors-by-ggml-name, qtype map, mmap, quant_buf).
+// Default upper bound of the memory a decode batch of get_gguf_data touches: the mapped GGUF tensor data
+// plus its repacked copy. 1 GiB unless OV_GGUF_DECODE_MEMORY_BUDGET sets another size in MiB.
+size_t default_decode_memory_budget();
+
+// Split consecutive decode jobs of the given source sizes into [begin, end) batches whose total size does
+// not exceed `budget`; a job larger than the budget forms a batch of its own.
+std::vector<std::pair<size_t, size_t>> split_decode_batches(const std::vector<size_t>& sizes, size_t budget);
+
+// Parse a GGUF file: returns (metadata, tensors-by-ggml-name, qtype map, mmap, quant_bufs).
 // Non-quantized tensors are zero-copy views into the mmap (mmap must outlive arrays use).
-// Quantized tensors are SharedBuffer slices of a single AlignedBuffer (quant_buf) so all
-// repacked weight/scale/bias data lives in one allocation (IR-frontend pattern).
-GGUFLoad get_gguf_data(const std::string& file);
+// Quantized tensors are decoded in batches of at most `decode_budget` bytes (source plus repacked
+// data). Each batch is repacked into an AlignedBuffer allocated just before it is decoded, and its
+// source pages are evicted right after, so the memory in flight stays bounded for large models.
+GGUFLoad get_gguf_data(const std::string& file, size_t decode_budget = default_decode_memory_budget());
 
 // Extract the DECODER-family architecture config (architecture, layer_num, head_num, head_size,
 // head_num_kv, hidden_size, max_position_embeddings, rms_norm_eps, rope_freq_base, file_type, ...)
@@ -18,6 +18,8 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -191,3 +193,110 @@ INSTANTIATE_TEST_SUITE_P(AllQuantTypes,
                          [](const ::testing::TestParamInfo<DeqCase>& i) {
                              return std::string(i.param.stem);
                          });
+
+TEST(GGUFDecodeBatches, RespectMemoryBudget) {
+    using Batches = std::vector<std::pair<size_t, size_t>>;
+    EXPECT_EQ(split_decode_batches({}, 100), Batches{});
+    EXPECT_EQ(split_decode_batches({10, 20, 30, 40}, 100), (Batches{{0, 4}}));
+    EXPECT_EQ(split_decode_batches({60, 30, 20, 90, 10}, 100), (Batches{{0, 2}, {2, 3}, {3, 5}}));
+    // A tensor larger than the budget is decoded alone.
+    EXPECT_EQ(split_decode_batches({10, 250, 10}, 100), (Batches{{0, 1}, {1, 2}, {2, 3}}));
+}
+
+namespace {
+
+// Write a minimal GGUF v3 file of `count` zero-filled Q8_0 tensors of `rows x cols` weights, no metadata.
+void write_q8_0_gguf(const std::filesystem::path& path, size_t count, uint64_t rows, uint64_t cols) {
+    std::ofstream out(path, std::ios::binary);
+    auto put = [&out](auto value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    const uint64_t bsize = rows * cols / 32 * 34;  // block_q8_0: f16 scale + 32 i8
+    put(uint32_t{0x46554747});                    // "GGUF"
+    put(uint32_t{3});
+    put(uint64_t{count});
+    put(uint64_t{0});
+    for (size_t i = 0; i < count; ++i) {
+        const std::string name = "blk." + std::to_string(i) + ".ffn_up.weight";
+        put(uint64_t{name.size()});
+        out.write(name.data(), name.size());
+        put(uint32_t{2});
+        put(cols);
+        put(rows);
+        put(uint32_t{GGUF_TYPE_Q8_0});
+        put(uint64_t{i * bsize});
+    }
+    const std::vector<char> zeros(bsize, 0);
+    out.write(zeros.data(), (32 - static_cast<size_t>(out.tellp()) % 32) % 32);
+    for (size_t i = 0; i < count; ++i) {
+        out.write(zeros.data(), zeros.size());
+    }
+}
+
+#ifdef __linux__
+// Peak resident set size since the last reset_peak_rss(), in bytes.
+size_t peak_rss() {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+size_t current_rss() {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+bool reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.close();
+    return static_cast<bool>(clear_refs);
+}
+#endif
+
+}  // namespace
+
+// The repacked copy is allocated batch by batch and the source pages are evicted once decoded, so loading
+// peaks at the result plus about one budget, instead of the result plus the whole mapped file.
+TEST(GGUFDecodeBatches, BoundPeakMemory) {
+#ifndef __linux__
+    GTEST_SKIP() << "peak RSS is read from /proc/self/status";
+#else
+    constexpr size_t count = 64;
+    constexpr uint64_t rows = 256, cols = 4096;
+    constexpr size_t budget = size_t{8} << 20;
+    constexpr size_t tensor_bytes = rows * cols / 32 * 34;  // the Q8_0 source and its i8 + f16 copy alike
+    const auto path = std::filesystem::temp_directory_path() / "ov_gguf_decode_peak_memory.gguf";
+    write_q8_0_gguf(path, count, rows, cols);
+    // Warm up the thread pool, so that its stacks are not attributed to the measured load.
+    get_gguf_data(path.string(), budget);
+
+    if (!reset_peak_rss()) {
+        std::filesystem::remove(path);
+        GTEST_SKIP() << "peak RSS cannot be reset on this kernel";
+    }
+    const size_t baseline = current_rss();
+    {
+        auto [metadata, arrays, qtype, mapped, quant_bufs] = get_gguf_data(path.string(), budget);
+        const size_t peak = peak_rss() - baseline;
+
+        EXPECT_EQ(arrays.size(), count * 2);
+        EXPECT_EQ(quant_bufs.size(), (count + 2) / 3);  // three 2 x 1.0625 MiB jobs fit in 8 MiB
+        for (const auto& buf : quant_bufs) {
+            EXPECT_LE(buf->size(), budget);
+        }
+        // Without eviction the whole mapped file (another count * tensor_bytes) would be resident on top.
+        EXPECT_LT(peak, count * tensor_bytes + 2 * budget + (size_t{16} << 20));
+    }
+    std::filesystem::remove(path);
+#endif
+}
@@ -4,9 +4,15 @@
 
 #include "openvino/frontend/ir/frontend.hpp"
 
+#ifndef _WIN32
+#    include <sys/stat.h>
+#endif
+
 #include <array>
+#include <mutex>
 #include <optional>
 #include <pugixml.hpp>
+#include <unordered_map>
 #include <vector>
 
 #include "input_model.hpp"
@@ -16,6 +22,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/hash_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "transformations/fp16_compression/convert_legacy_precision_attribute.hpp"
@@ -42,6 +49,64 @@ size_t get_ir_version(const pugi::xml_document& doc) {
 
 constexpr size_t HEADER_SIZE_LIM = 512lu;
 
+/** @brief Identity and version of a weights file, it changes whenever the file is rewritten or replaced. */
+struct WeightsFileStamp {
+    size_t m_size = 0;
+    std::filesystem::file_time_type m_write_time{};
+    uint64_t m_file_id = 0;
+
+    bool operator==(const WeightsFileStamp& other) const {
+        return m_size == other.m_size && m_write_time == other.m_write_time && m_file_id == other.m_file_id;
+    }
+};
+
+WeightsFileStamp get_weights_file_stamp(const std::filesystem::path& weights_path) {
+    WeightsFileStamp stamp;
+    stamp.m_size = static_cast<size_t>(ov::util::file_size(weights_path));
+    std::error_code ec;
+    stamp.m_write_time = std::filesystem::last_write_time(weights_path, ec);
+#ifndef _WIN32
+    // A file replaced by another one within the write time resolution still has the other inode.
+    if (struct stat sb = {}; stat(weights_path.c_str(), &sb) == 0) {
+        stamp.m_file_id =
+            ov::util::u64_hash_combine(static_cast<uint64_t>(sb.st_ino), static_cast<uint64_t>(sb.st_dev));
+    }
+#endif
+    return stamp;
+}
+
+/**
+ * @brief Maps weights file once per process.
+ *
+ * Several IRs may reference one weights file (e.g. content-addressed weight store shared by fine-tuned model variants),
+ * the mapping is reused while any model keeps it alive and the file is neither modified nor replaced, i.e. its size,
+ * write time and inode are the same as when it was mapped.
+ */
+std::shared_ptr<ov::MappedMemory> get_mapped_weights(const std::filesystem::path& weights_path) {
+    struct MappedWeights {
+        std::weak_ptr<ov::MappedMemory> m_memory;
+        WeightsFileStamp m_stamp;
+    };
+    static std::mutex mutex;
+    static std::unordered_map<std::filesystem::path::string_type, MappedWeights> mapped_weights;
+
+    const auto stamp = get_weights_file_stamp(weights_path);
+    const auto key = std::filesystem::absolute(weights_path).lexically_normal().native();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto found = mapped_weights.find(key); found != mapped_weights.end() && found->second.m_stamp == stamp) {
+        if (auto mapped_memory = found->second.m_memory.lock()) {
+            return mapped_memory;
+        }
+    }
+    for (auto it = mapped_weights.begin(); it != mapped_weights.end();) {
+        it = it->second.m_memory.expired() ? mapped_weights.erase(it) : std::next(it);
+    }
+    auto mapped_memory = ov::load_mmap_object(weights_path);
+    mapped_weights[key] = {mapped_memory, stamp};
+    return mapped_memory;
+}
+
 /**
  * @brief Extracts IR version from model stream
  * @param model Model's stream
@@ -218,7 +283,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     if (!weights_path.empty()) {
         const auto enable_mmap = variants.back().is<bool>() ? variants.back().as<bool>() : false;
         if (enable_mmap) {
-            auto mapped_memory = ov::load_mmap_object(weights_path);
+            auto mapped_memory = get_mapped_weights(weights_path);
             weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
                                                                                         mapped_memory->size(),
                                                                                         mapped_memory);
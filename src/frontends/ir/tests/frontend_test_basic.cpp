@@ -596,6 +596,44 @@ TEST_P(IRFrontendMMapTests, read_model_get_weights_map) {
     EXPECT_EQ(wt_meta_map.size(), 2);
 }
 
+#ifndef _WIN32  // a mapped file can't be replaced on Windows
+TEST_F(IRFrontendTests, mapped_weights_are_not_reused_after_file_replacement) {
+    const auto save_model = [](const std::filesystem::path& xml_path, float value) {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4});
+        auto add = std::make_shared<ov::opset1::Add>(
+            parameter,
+            std::make_shared<ov::opset1::Constant>(ov::element::f32, ov::Shape{1, 4}, value));
+        auto model = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::opset1::Result>(add)},
+                                                 ov::ParameterVector{parameter});
+        ov::save_model(model, xml_path);
+    };
+    const auto get_constant_value = [](const std::shared_ptr<ov::Model>& model) {
+        for (const auto& op : model->get_ops()) {
+            if (const auto constant = ov::as_type_ptr<ov::opset1::Constant>(op)) {
+                return constant->cast_vector<float>().front();
+            }
+        }
+        return 0.0f;
+    };
+
+    save_model(xmlFileName, 1.0f);
+    const auto model = core.read_model(xmlFileName, binFileName, {ov::enable_mmap(true)});
+    ASSERT_EQ(get_constant_value(model), 1.0f);
+
+    // the weights file of the same size is replaced while the first model still maps the old one
+    const auto new_xml = std::filesystem::path(prefix).concat("_IrFrontendTestModelNew.xml");
+    const auto new_bin = std::filesystem::path(prefix).concat("_IrFrontendTestModelNew.bin");
+    save_model(new_xml, 2.0f);
+    ASSERT_EQ(std::filesystem::file_size(new_bin), std::filesystem::file_size(binFileName));
+    std::filesystem::rename(new_bin, binFileName);
+    std::filesystem::remove(new_xml);
+
+    const auto new_model = core.read_model(xmlFileName, binFileName, {ov::enable_mmap(true)});
+    EXPECT_EQ(get_constant_value(new_model), 2.0f);
+    EXPECT_EQ(get_constant_value(model), 1.0f);
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(EnableMMapPropery, IRFrontendMMapTests, ::testing::Bool());
 
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
@@ -494,6 +494,13 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
             constant_buffer = ext_data.load_external_mem_data();
         } else if (m_mmap_cache) {
             constant_buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            if (reinterpret_cast<uintptr_t>(constant_buffer->get_ptr()) % ov_type.size() != 0) {
+                // The mapping is shared only when the offset keeps the elements aligned, the misaligned data is
+                // copied once into an aligned buffer.
+                auto aligned_buffer = std::make_shared<ov::AlignedBuffer>(constant_buffer->size());
+                std::memcpy(aligned_buffer->get_ptr(), constant_buffer->get_ptr(), constant_buffer->size());
+                constant_buffer = std::move(aligned_buffer);
+            }
             has_weightless_offset = true;
             weightless_offset = ext_data.offset();
         } else {
@@ -527,6 +534,9 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
                 "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                 "' in the model");
         }
+    } else if (const auto raw_data = get_raw_data_ptr(); raw_data != nullptr && ov_type != ov::element::string) {
+        // Raw bytes have the same layout as the constant, so they are copied once without a typed intermediate.
+        constant = std::make_shared<ov::op::v0::Constant>(ov_type, m_shape, raw_data);
     } else if (m_tensor_proto != nullptr) {
         switch (m_tensor_proto->data_type()) {
         case TensorProto_DataType::TensorProto_DataType_FLOAT:
@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <utility>
 #include <vector>
@@ -326,15 +327,17 @@ private:
                                                                reinterpret_cast<size_t>(m_tensor_place->get_data()),
                                                                m_tensor_place->get_data_size())
                                   : detail::TensorExternalData(*m_tensor_proto);
-        std::shared_ptr<ov::AlignedBuffer> buffer = nullptr;
-        if (ext_data.data_location() == detail::ORT_MEM_ADDR) {
-            buffer = ext_data.load_external_mem_data();
-        } else if (m_mmap_cache) {
-            buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
-        } else {
-            buffer = ext_data.load_external_data(m_model_dir);
+        // The typed values are copied straight from the shared mapping or from the file, no intermediate buffer
+        // holding a second copy of the data is created.
+        if (m_mmap_cache && ext_data.data_location() != detail::ORT_MEM_ADDR) {
+            const auto buffer = ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            std::vector<T> values(buffer->size() / sizeof(T));
+            std::memcpy(values.data(), buffer->get_ptr(), values.size() * sizeof(T));
+            return values;
         }
-        return std::vector<T>(buffer->get_ptr<T>(), buffer->get_ptr<T>() + (buffer->size() / sizeof(T)));
+        std::vector<T> values(ext_data.get_data_length(m_model_dir) / sizeof(T));
+        ext_data.read_external_data(m_model_dir, reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+        return values;
     }
 
     const void* get_data_ptr() const {
@@ -365,6 +368,19 @@ private:
         ONNX_INVALID_DATA_TYPE(m_tensor_proto->data_type(), "FLOAT, INT32, INT64, UINT32, UINT64, DOUBLE");
     }
 
+    /// \brief Returns raw little-endian bytes of the tensor or nullptr if the data is stored in typed fields or
+    ///        the place shares its data with the constant.
+    const void* get_raw_data_ptr() const {
+        if (has_external_data()) {
+            return nullptr;
+        }
+        if (m_tensor_place != nullptr) {
+            return m_tensor_place->is_raw() && !m_tensor_place->is_const_data_reusable() ? m_tensor_place->get_data()
+                                                                                          : nullptr;
+        }
+        return m_tensor_proto->has_raw_data() ? m_tensor_proto->raw_data().data() : nullptr;
+    }
+
     size_t get_data_size() const {
         if (m_tensor_place != nullptr) {
             if (m_tensor_place->is_raw() || m_tensor_place->get_data_location()) {
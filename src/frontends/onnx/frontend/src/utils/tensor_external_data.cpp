@@ -4,6 +4,7 @@
 
 #include "utils/tensor_external_data.hpp"
 
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
@@ -71,21 +72,58 @@ Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::
         mapped_memory);
 }
 
-Buffer<ov::AlignedBuffer> TensorExternalData::load_external_data(const std::filesystem::path& model_dir) const {
-    std::filesystem::path full_path;
+std::filesystem::path TensorExternalData::get_full_path(const std::filesystem::path& model_dir) const {
     try {
-        full_path = ov::util::sanitize_path(model_dir, ov::util::make_path(m_data_location));
+        return ov::util::sanitize_path(model_dir, ov::util::make_path(m_data_location));
     } catch (const std::runtime_error& e) {
         throw error::invalid_external_data{e.what()};
     }
+}
 
+uint64_t TensorExternalData::validate_and_get_length(const std::filesystem::path& full_path) const {
     const auto file_size = util::file_size(full_path);
     if (file_size < 0 || m_data_length > static_cast<uint64_t>(file_size) ||
         m_offset > static_cast<uint64_t>(file_size) - m_data_length) {
         throw error::invalid_external_data{*this};
     }
+    return m_data_length > 0 ? m_data_length : static_cast<uint64_t>(file_size) - m_offset;
+}
 
-    uint64_t read_data_length = m_data_length > 0 ? m_data_length : static_cast<uint64_t>(file_size) - m_offset;
+uint64_t TensorExternalData::get_data_length(const std::filesystem::path& model_dir) const {
+    if (m_data_location == ORT_MEM_ADDR) {
+        return m_data_length;
+    }
+    return validate_and_get_length(get_full_path(model_dir));
+}
+
+void TensorExternalData::read_external_data(const std::filesystem::path& model_dir, char* dst, size_t size) const {
+    if (m_data_location == ORT_MEM_ADDR) {
+        if (size > m_data_length) {
+            throw error::invalid_external_data{*this};
+        }
+        if (size > 0) {
+            std::memcpy(dst, reinterpret_cast<const char*>(m_offset), size);
+        }
+        return;
+    }
+    const auto full_path = get_full_path(model_dir);
+    if (size > validate_and_get_length(full_path)) {
+        throw error::invalid_external_data{*this};
+    }
+    std::ifstream external_data_stream(full_path, std::ios::binary | std::ios::in);
+    if (external_data_stream.fail()) {
+        throw error::invalid_external_data{*this};
+    }
+    external_data_stream.seekg(m_offset, std::ios::beg);
+    external_data_stream.read(dst, size);
+    if (external_data_stream.fail()) {
+        throw error::invalid_external_data{*this};
+    }
+}
+
+Buffer<ov::AlignedBuffer> TensorExternalData::load_external_data(const std::filesystem::path& model_dir) const {
+    const auto full_path = get_full_path(model_dir);
+    const uint64_t read_data_length = validate_and_get_length(full_path);
     const auto get_now_buffer = [&]() {
         std::ifstream external_data_stream(full_path, std::ios::binary | std::ios::in | std::ios::ate);
         if (external_data_stream.fail()) {
@@ -54,6 +54,22 @@ public:
     /// \return     External binary data loaded into the SharedBuffer
     Buffer<ov::AlignedBuffer> load_external_mem_data() const;
 
+    /// \brief      Read external data from tensor passed to constructor directly into provided memory
+    ///
+    /// \note       Used when a typed copy of the data is required anyway, so no intermediate buffer is created.
+    ///             If reading data from external files fails, the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory of the model the data location is relative to
+    /// \param      dst        Destination memory
+    /// \param      size       Number of bytes to read, not greater than get_data_length(model_dir)
+    void read_external_data(const std::filesystem::path& model_dir, char* dst, size_t size) const;
+
+    /// \brief      Resolves the data length, the zero length stored in the model means the data spans to the end of
+    ///             the file.
+    ///
+    /// \return     Returns the data size in bytes
+    uint64_t get_data_length(const std::filesystem::path& model_dir) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -84,6 +100,9 @@ public:
     }
 
 private:
+    std::filesystem::path get_full_path(const std::filesystem::path& model_dir) const;
+    uint64_t validate_and_get_length(const std::filesystem::path& full_path) const;
+
     std::string m_data_location{};
     uint64_t m_offset = 0;
     uint64_t m_data_length = 0;
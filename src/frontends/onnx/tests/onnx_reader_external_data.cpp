@@ -6,11 +6,13 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <set>
 #include <streambuf>
 #include <string>
 
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -18,6 +20,7 @@
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/frontend/manager.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/util/file_util.hpp"
 #include "utils/tensor_external_data.hpp"
 
 using namespace std;
@@ -468,3 +471,110 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_from_ORT_MEM_ADDR) {
 }
 
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
+
+#ifndef __APPLE__  // TODO: add getVmRSSInKB() for Apple platform
+
+using ::ONNX_NAMESPACE::TensorProto_DataLocation, ::ONNX_NAMESPACE::TensorProto_DataType,
+    ::ONNX_NAMESPACE::ValueInfoProto;
+
+class OnnxFeExternalDataMemoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto prefix = test::utils::generateTestFilePrefix();
+        m_model_path = prefix + "_external_weights.onnx";
+        m_data_name = util::path_to_string(std::filesystem::path(prefix + "_external_weights.bin").filename());
+        m_data_path = std::filesystem::path(m_model_path).parent_path() / m_data_name;
+
+        // Both initializers live in one external file, back to back.
+        const std::vector<float> weights(2 * m_weights_count, 1.0f);
+        std::ofstream data(m_data_path, std::ios::binary);
+        data.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+        data.close();
+
+        ModelProto model_proto;
+        model_proto.set_ir_version(7);
+        model_proto.add_opset_import()->set_version(13);
+        auto* graph = model_proto.mutable_graph();
+        graph->set_name("external_weights");
+        add_value_info(graph->add_input(), "x");
+        add_value_info(graph->add_output(), "y");
+        for (const auto& [name, offset] : {std::pair<std::string, size_t>{"w0", 0}, {"w1", m_weights_byte_size}}) {
+            auto* initializer = graph->add_initializer();
+            initializer->set_name(name);
+            initializer->set_data_type(TensorProto_DataType::TensorProto_DataType_FLOAT);
+            initializer->add_dims(m_weights_count);
+            initializer->set_data_location(TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL);
+            for (const auto& [key, value] : {std::pair<std::string, std::string>{"location", m_data_name},
+                                             {"offset", std::to_string(offset)},
+                                             {"length", std::to_string(m_weights_byte_size)}}) {
+                auto* entry = initializer->add_external_data();
+                entry->set_key(key);
+                entry->set_value(value);
+            }
+        }
+        auto* add_0 = graph->add_node();
+        add_0->set_op_type("Add");
+        add_0->add_input("x");
+        add_0->add_input("w0");
+        add_0->add_output("add_0");
+        auto* add_1 = graph->add_node();
+        add_1->set_op_type("Add");
+        add_1->add_input("add_0");
+        add_1->add_input("w1");
+        add_1->add_output("y");
+
+        std::ofstream model_file(m_model_path, std::ios::binary);
+        ASSERT_TRUE(model_proto.SerializeToOstream(&model_file));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_model_path);
+        std::filesystem::remove(m_data_path);
+    }
+
+    void add_value_info(ValueInfoProto* value_info, const std::string& name) const {
+        value_info->set_name(name);
+        auto* tensor_type = value_info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(TensorProto_DataType::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(m_weights_count);
+    }
+
+    const size_t m_weights_count = 16 * 1024 * 1024 / sizeof(float);
+    const size_t m_weights_byte_size = m_weights_count * sizeof(float);
+    std::string m_model_path;
+    std::string m_data_name;
+    std::filesystem::path m_data_path;
+};
+
+TEST_F(OnnxFeExternalDataMemoryTest, mmap_external_data_is_not_copied) {
+    auto test = [&]() {
+        Core core;
+        core.set_property(enable_mmap(true));
+        const auto rss_init = test::utils::getVmRSSInKB();
+        const auto model = core.read_model(m_model_path);
+        const auto rss_read = test::utils::getVmRSSInKB();
+
+        // Weights are not resident after reading, RAM should not grow by more than a half of their size.
+        if (rss_read > rss_init + (2 * m_weights_byte_size / 1024) / 2) {
+            std::cerr << "Test failed: external weights are read into RAM" << std::endl;
+            exit(1);
+        }
+        // Initializers from one file reference a single mapping instead of a copy each.
+        std::vector<const uint8_t*> data;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = as_type<ov::op::v0::Constant>(op.get())) {
+                data.push_back(constant->get_data_ptr<uint8_t>());
+            }
+        }
+        if (data.size() != 2 || static_cast<size_t>(std::abs(data[1] - data[0])) != m_weights_byte_size) {
+            std::cerr << "Test failed: external weights don't share the file mapping" << std::endl;
+            exit(1);
+        }
+        std::cerr << "Test passed" << std::endl;
+        exit(0);
+    };
+    // Run test in a separate process to not affect RAM values by previous tests
+    EXPECT_EXIT(test(), ::testing::ExitedWithCode(0), "Test passed");
+}
+
+#endif
@@ -100,6 +100,15 @@ static constexpr Property<bool, PropertyMutability::RW> enable_lp_transformation
  */
 static constexpr Property<uint32_t, PropertyMutability::RO> cache_header_alignment{"CACHE_HEADER_ALIGNMENT"};
 
+/**
+ * @brief Read-only core property with the statistics of the last weights prefetch run while a model was compiled from
+ * its path: TOTAL_BYTES, PREFETCHED_BYTES, EVICTED_BYTES, COMPILE_TIME_US and PREFETCH_TIME_US, the time of the
+ * prefetch overlapped with the compilation
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> weights_prefetch_statistics{
+    "WEIGHTS_PREFETCH_STATISTICS"};
+
 /**
  * @brief Enum to define possible cache quant schema hints.
  */
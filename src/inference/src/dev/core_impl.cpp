@@ -39,6 +39,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "ov_plugins.hpp"
 #include "shared_context_manager.hpp"
+#include "weights_prefetcher.hpp"
 #ifdef PROXY_PLUGIN_ENABLED
 #    include "openvino/proxy/plugin.hpp"
 #    include "openvino/proxy/properties.hpp"
@@ -961,7 +962,10 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, {}, [&]() {
             const auto model =
                 util::read_model(model_path, "", get_extensions_copy(), parsed.m_core_config.get_enable_mmap());
-            return compile_model_and_cache(plugin, model, parsed.m_config, {}, cache_content);
+            WeightsPrefetcher weights_prefetcher(model);
+            auto compiled_model = compile_model_and_cache(plugin, model, parsed.m_config, {}, cache_content);
+            weights_prefetcher.stop();
+            return compiled_model;
         });
     } else {
         compiled_model = plugin.compile_model(model_path, parsed.m_config);
@@ -1297,6 +1301,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::internal::weights_prefetch_statistics.name()) {
+        return WeightsPrefetcher::last_statistics();
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -13,6 +13,7 @@
 #include "openvino/util/container_util.hpp"
 #include "transformations/common_optimizations/fused_names_cleanup.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
+#include "weights_prefetcher.hpp"
 
 namespace {
 
@@ -87,7 +88,10 @@ std::shared_ptr<ov::ICompiledModel> ov::IPlugin::compile_model(const std::filesy
     if (!ov::is_virtual_device(get_device_name())) {
         CoreConfig::remove_core(local_properties);
     }
-    return compile_model(model, local_properties);
+    WeightsPrefetcher weights_prefetcher(model);
+    auto compiled_model = compile_model(model, local_properties);
+    weights_prefetcher.stop();
+    return compiled_model;
 }
 
 bool ov::IPlugin::is_property_supported(const std::string& name, const ov::AnyMap& arguments) const {
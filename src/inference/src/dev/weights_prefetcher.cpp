@@ -0,0 +1,213 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_prefetcher.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/runtime/lazy_buffer.hpp"
+#include "openvino/runtime/threading/executor_manager.hpp"
+#include "openvino/util/log.hpp"
+#include "openvino/util/memory.hpp"
+
+namespace ov {
+namespace {
+// Granularity of cancellation and eviction checks.
+constexpr size_t prefetch_chunk_size = 1024 * 1024;
+
+std::chrono::microseconds elapsed(const std::chrono::steady_clock::time_point& start,
+                                  const std::chrono::steady_clock::time_point& end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+}
+
+std::mutex last_statistics_mutex;
+WeightsPrefetcher::Statistics last_prefetch_statistics;
+}  // namespace
+
+struct WeightsPrefetcher::State {
+    enum class Stage { Queued, Running, Done };
+
+    struct Region {
+        wsh::DataID m_source_id;
+        wsh::DataID m_constant_id;
+        const uint8_t* m_data;
+        size_t m_size;
+    };
+
+    void run();
+
+    // Keep the constants alive, so the regions stay mapped.
+    std::vector<std::shared_ptr<const ov::Node>> m_constants;
+    std::vector<Region> m_regions;
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+    // Everything below is guarded by m_mutex, a region is advised under the lock so that it's never advised after
+    // its eviction or after the prefetch is cancelled.
+    std::mutex m_mutex;
+    std::condition_variable m_done_cv;
+    Stage m_stage = Stage::Queued;
+    bool m_stop = false;
+    std::set<std::pair<wsh::DataID, wsh::DataID>> m_evicted;
+    size_t m_prefetched_bytes = 0;
+    size_t m_evicted_bytes = 0;
+    std::chrono::steady_clock::time_point m_prefetch_start;
+    std::chrono::steady_clock::time_point m_prefetch_end;
+};
+
+void WeightsPrefetcher::State::run() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Cancelled while queued behind the prefetch of another compilation.
+        if (m_stop) {
+            m_stage = Stage::Done;
+            m_done_cv.notify_all();
+            return;
+        }
+        m_stage = Stage::Running;
+        m_prefetch_start = std::chrono::steady_clock::now();
+    }
+    // Advises the next chunk of the region, returns false once the region is done or the prefetch is cancelled.
+    auto advise = [this](const Region& region, size_t offset) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stop) {
+            return false;
+        }
+        // Reading evicted weights back would undo the eviction.
+        if (m_evicted.count({region.m_source_id, region.m_constant_id}) != 0) {
+            m_evicted_bytes += region.m_size - offset;
+            return false;
+        }
+        const auto length = std::min(prefetch_chunk_size, region.m_size - offset);
+        util::vm_hint_willneed(region.m_data + offset, length);
+        m_prefetched_bytes += length;
+        return true;
+    };
+    try {
+        for (const auto& region : m_regions) {
+            size_t offset = 0;
+            while (offset < region.m_size && advise(region, offset)) {
+                offset += prefetch_chunk_size;
+            }
+        }
+    } catch (...) {
+        // Prefetch is only a hint, the weights are read on demand if it fails.
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_prefetch_end = std::chrono::steady_clock::now();
+    m_stage = Stage::Done;
+    m_done_cv.notify_all();
+}
+
+WeightsPrefetcher::WeightsPrefetcher(const std::shared_ptr<const ov::Model>& model)
+    : m_state(std::make_shared<State>()) {
+    std::set<std::pair<wsh::DataID, wsh::DataID>> scheduled;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type<ov::op::v0::Constant>(node.get())) {
+            // Only file-backed weights are worth to prefetch, constants created in memory are resident already.
+            const auto source_id = wsh::Extension::get_constant_source_id(*constant);
+            if (source_id == wsh::invalid_source_id) {
+                continue;
+            }
+            // Lazy loaded weights are read from the file when their data is accessed, which is not a hint anymore.
+            if (std::dynamic_pointer_cast<LazyBuffer>(wsh::Extension::get_constant_source_buffer(*constant))) {
+                continue;
+            }
+            const auto constant_id = wsh::Extension::get_constant_id(*constant);
+            if (scheduled.emplace(source_id, constant_id).second) {
+                m_state->m_regions.push_back({source_id,
+                                              constant_id,
+                                              static_cast<const uint8_t*>(constant->get_data_ptr()),
+                                              constant->get_byte_size()});
+                m_statistics.m_total_bytes += constant->get_byte_size();
+                m_state->m_constants.push_back(node);
+            }
+        }
+    }
+    if (m_state->m_regions.empty()) {
+        m_state->m_stage = State::Stage::Done;
+        return;
+    }
+    wsh::Extension::add_eviction_observer(*this);
+    m_observing = true;
+    // A single shared executor, so concurrent compilations neither spawn a thread each nor compete for the disk.
+    threading::executor_manager()->get_executor("WeightsPrefetcher")->run([state = m_state] {
+        state->run();
+    });
+}
+
+WeightsPrefetcher::~WeightsPrefetcher() {
+    cancel();
+}
+
+void WeightsPrefetcher::cancel() {
+    {
+        std::unique_lock<std::mutex> lock(m_state->m_mutex);
+        m_state->m_stop = true;
+        // A queued prefetch returns as soon as it's dequeued, only the running one has to be waited for.
+        m_state->m_done_cv.wait(lock, [this] {
+            return m_state->m_stage != State::Stage::Running;
+        });
+        m_state->m_regions.clear();
+        m_state->m_constants.clear();
+    }
+    if (m_observing) {
+        wsh::Extension::remove_eviction_observer(*this);
+        m_observing = false;
+    }
+}
+
+void WeightsPrefetcher::on_evict(wsh::DataID source_id, wsh::DataID constant_id) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        m_state->m_evicted.emplace(source_id, constant_id);
+    } catch (...) {
+    }
+}
+
+WeightsPrefetcher::Statistics WeightsPrefetcher::stop() {
+    const auto stop_time = std::chrono::steady_clock::now();
+    m_statistics.m_compile_time = elapsed(m_state->m_start, stop_time);
+    cancel();
+    {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        m_statistics.m_prefetched_bytes = m_state->m_prefetched_bytes;
+        m_statistics.m_evicted_bytes = m_state->m_evicted_bytes;
+        if (m_state->m_prefetch_start != std::chrono::steady_clock::time_point{}) {
+            m_statistics.m_prefetch_time =
+                elapsed(m_state->m_prefetch_start, std::min(m_state->m_prefetch_end, stop_time));
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(last_statistics_mutex);
+        last_prefetch_statistics = m_statistics;
+    }
+
+    OPENVINO_DEBUG("[ weights prefetch ] prefetched ",
+                   m_statistics.m_prefetched_bytes,
+                   " of ",
+                   m_statistics.m_total_bytes,
+                   " bytes, skipped ",
+                   m_statistics.m_evicted_bytes,
+                   " evicted bytes, overlapped ",
+                   m_statistics.m_prefetch_time.count(),
+                   " us of ",
+                   m_statistics.m_compile_time.count(),
+                   " us compile time");
+    return m_statistics;
+}
+
+ov::AnyMap WeightsPrefetcher::last_statistics() {
+    std::lock_guard<std::mutex> lock(last_statistics_mutex);
+    return {{"TOTAL_BYTES", last_prefetch_statistics.m_total_bytes},
+            {"PREFETCHED_BYTES", last_prefetch_statistics.m_prefetched_bytes},
+            {"EVICTED_BYTES", last_prefetch_statistics.m_evicted_bytes},
+            {"COMPILE_TIME_US", static_cast<int64_t>(last_prefetch_statistics.m_compile_time.count())},
+            {"PREFETCH_TIME_US", static_cast<int64_t>(last_prefetch_statistics.m_prefetch_time.count())}};
+}
+
+}  // namespace ov
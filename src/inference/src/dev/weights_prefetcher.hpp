@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "openvino/core/any.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/weight_sharing_util.hpp"
+
+namespace ov {
+
+/**
+ * @brief Reads file-backed weights of the model ahead in background while the model is compiled.
+ *
+ * Constants are visited in topological order, which is the order a plugin folds and repacks them, so the compilation
+ * mostly finds its weights in the page cache instead of reading them one by one. The weights are only advised to the
+ * OS (madvise(MADV_WILLNEED) / PrefetchVirtualMemory) and never touched, so the prefetch neither faults pages in nor
+ * grows the resident set. Constants evicted by the compilation (see wsh::Extension::hint_evict) are skipped.
+ *
+ * The prefetch of all compilations runs on one shared executor, one model after another, and is cancelled when the
+ * compilation ends, because the remaining weights are read on demand anyway.
+ */
+class WeightsPrefetcher : private wsh::EvictionObserver {
+public:
+    struct Statistics {
+        size_t m_total_bytes = 0;       //!< Size of file-backed weights scheduled for prefetch.
+        size_t m_prefetched_bytes = 0;  //!< Weights advised to the OS before the compilation ended.
+        size_t m_evicted_bytes = 0;     //!< Weights skipped because the compilation evicted them first.
+        std::chrono::microseconds m_compile_time{0};
+        std::chrono::microseconds m_prefetch_time{0};  //!< Time of prefetch I/O overlapped with the compilation.
+    };
+
+    /**
+     * @brief Schedules background prefetch of model weights.
+     * @param model Model which weights are prefetched.
+     */
+    explicit WeightsPrefetcher(const std::shared_ptr<const ov::Model>& model);
+    ~WeightsPrefetcher() override;
+
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+
+    /**
+     * @brief Cancels the prefetch which is still in progress and reports how much of it overlapped the compilation.
+     */
+    Statistics stop();
+
+    /**
+     * @brief Statistics of the last prefetch stopped in the process, see ov::internal::weights_prefetch_statistics.
+     */
+    static ov::AnyMap last_statistics();
+
+private:
+    struct State;
+
+    void cancel();
+    void on_evict(wsh::DataID source_id, wsh::DataID constant_id) noexcept override;
+
+    std::shared_ptr<State> m_state;
+    bool m_observing = false;
+    Statistics m_statistics{};
+};
+
+}  // namespace ov
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dev/weights_prefetcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/threading/executor_manager.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov::test {
+
+using op::v0::Parameter, op::v0::Constant, op::v1::Add;
+
+class WeightsPrefetcherTest : public testing::Test {
+protected:
+    void SetUp() override {
+        std::vector<float> weights(m_weights_size / sizeof(float), 1.0f);
+        std::ofstream out(m_weights_path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(weights.data()), m_weights_size);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_weights_path);
+    }
+
+    // Model with two file-backed constants referencing the same weights region and one constant created in memory.
+    std::shared_ptr<Model> make_model() const {
+        const auto mapped = load_mmap_object(m_weights_path);
+        const Shape shape{m_weights_size / sizeof(float)};
+        auto make_file_constant = [&] {
+            auto buffer =
+                std::make_shared<SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped->data(), mapped->size(), mapped);
+            return std::make_shared<Constant>(element::f32, shape, buffer);
+        };
+        auto param = std::make_shared<Parameter>(element::f32, shape);
+        auto add = std::make_shared<Add>(param, make_file_constant());
+        add = std::make_shared<Add>(add, make_file_constant());
+        add = std::make_shared<Add>(add, Constant::create(element::f32, shape, {2.0f}));
+        return std::make_shared<Model>(add->outputs(), ParameterVector{param});
+    }
+
+    const size_t m_weights_size = 8 * 1024 * 1024;
+    std::filesystem::path m_weights_path = utils::generateTestFilePrefix() + "_weights.bin";
+};
+
+TEST_F(WeightsPrefetcherTest, schedule_file_backed_weights_once) {
+    WeightsPrefetcher prefetcher(make_model());
+    const auto statistics = prefetcher.stop();
+
+    EXPECT_EQ(statistics.m_total_bytes, m_weights_size);
+    EXPECT_LE(statistics.m_prefetched_bytes, statistics.m_total_bytes);
+    EXPECT_LE(statistics.m_prefetch_time, statistics.m_compile_time);
+}
+
+TEST_F(WeightsPrefetcherTest, no_prefetch_for_in_memory_weights) {
+    auto param = std::make_shared<Parameter>(element::f32, Shape{4});
+    auto add = std::make_shared<Add>(param, Constant::create(element::f32, Shape{4}, {1.0f}));
+    WeightsPrefetcher prefetcher(std::make_shared<Model>(add->outputs(), ParameterVector{param}));
+    const auto statistics = prefetcher.stop();
+
+    EXPECT_EQ(statistics.m_total_bytes, 0u);
+    EXPECT_EQ(statistics.m_prefetched_bytes, 0u);
+}
+
+TEST_F(WeightsPrefetcherTest, prefetch_completes_before_a_long_compilation_ends) {
+    WeightsPrefetcher prefetcher(make_model());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    const auto statistics = prefetcher.stop();
+
+    EXPECT_EQ(statistics.m_prefetched_bytes, statistics.m_total_bytes);
+    EXPECT_GT(statistics.m_prefetch_time.count(), 0);
+    EXPECT_LE(statistics.m_prefetch_time, statistics.m_compile_time);
+}
+
+TEST_F(WeightsPrefetcherTest, concurrent_compilations_share_the_prefetch_executor) {
+    const auto executors = threading::executor_manager()->get_executors_number();
+    {
+        std::vector<std::unique_ptr<WeightsPrefetcher>> prefetchers;
+        for (size_t i = 0; i < 4; ++i) {
+            prefetchers.push_back(std::make_unique<WeightsPrefetcher>(make_model()));
+        }
+        // Stopping a prefetch queued behind the others doesn't wait for them.
+        for (auto it = prefetchers.rbegin(); it != prefetchers.rend(); ++it) {
+            const auto statistics = (*it)->stop();
+            EXPECT_LE(statistics.m_prefetched_bytes, statistics.m_total_bytes);
+        }
+    }
+    EXPECT_LE(threading::executor_manager()->get_executors_number(), executors + 1);
+}
+
+TEST_F(WeightsPrefetcherTest, last_statistics_report_the_overlap) {
+    WeightsPrefetcher prefetcher(make_model());
+    const auto statistics = prefetcher.stop();
+    const auto reported = WeightsPrefetcher::last_statistics();
+
+    EXPECT_EQ(reported.at("TOTAL_BYTES").as<size_t>(), statistics.m_total_bytes);
+    EXPECT_EQ(reported.at("PREFETCHED_BYTES").as<size_t>(), statistics.m_prefetched_bytes);
+    EXPECT_EQ(reported.at("EVICTED_BYTES").as<size_t>(), statistics.m_evicted_bytes);
+    EXPECT_EQ(reported.at("COMPILE_TIME_US").as<int64_t>(), statistics.m_compile_time.count());
+    EXPECT_EQ(reported.at("PREFETCH_TIME_US").as<int64_t>(), statistics.m_prefetch_time.count());
+}
+
+}  // namespace ov::test
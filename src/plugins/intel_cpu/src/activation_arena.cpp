@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "activation_arena.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "cpu_memory.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+namespace {
+
+// The memory objects of the graphs sharing the arena are created and destroyed by the different compiled models
+// independently, so the observers registration is synchronized
+class SharedMemoryBlock : public IMemoryBlockObserver {
+public:
+    explicit SharedMemoryBlock(std::unique_ptr<IMemoryBlock> memBlock) : m_block(std::move(memBlock)) {}
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_block.getRawPtr();
+    }
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("Unexpected setExtBuff call to the activation arena");
+    }
+    bool resize(size_t size) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_block.resize(size);
+    }
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return false;
+    }
+    void registerMemory(Memory* memPtr) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_block.registerMemory(memPtr);
+    }
+    void unregisterMemory(Memory* memPtr) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_block.unregisterMemory(memPtr);
+    }
+
+private:
+    std::mutex m_mutex;
+    DnnlMemoryBlock m_block;
+};
+
+}  // namespace
+
+ActivationArena::ActivationArena() {
+    auto memory = std::make_unique<MemoryBlockWithReuse>();
+    m_memory = memory.get();
+    m_block = std::make_shared<SharedMemoryBlock>(std::move(memory));
+}
+
+ActivationArena::Ptr ActivationArena::get(const std::string& group, size_t stream) {
+    OPENVINO_ASSERT(!group.empty(), "Activation arena group name is empty");
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, size_t>, std::weak_ptr<ActivationArena>> arenas;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& weak = arenas[{group, stream}];
+    auto arena = weak.lock();
+    if (!arena) {
+        arena = std::make_shared<ActivationArena>();
+        weak = arena;
+    }
+    return arena;
+}
+
+void ActivationArena::acquire(size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_users++;
+    // grows only, the memory objects of all the graphs are notified if the buffer is reallocated
+    m_block->resize(size);
+}
+
+void ActivationArena::release() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(m_users > 0, "Unbalanced activation arena release");
+    if (--m_users == 0) {
+        m_memory->free();
+    }
+}
+
+size_t ActivationArena::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memory->size();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cpu_memory.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * A buffer for the intermediate tensors of static graphs shared by the graphs of different compiled models, which run
+ * on the same stream index and belong to the same user defined group. Each graph solves its memory reuse on its own
+ * and places the solution at the beginning of the arena, so the arena is sized to the largest of the solutions.
+ * The graphs sharing the arena must not be executed at the same time, which is ensured by the arena mutex being held
+ * for the whole inference (see CompiledModel::GraphGuard).
+ */
+class ActivationArena {
+public:
+    using Ptr = std::shared_ptr<ActivationArena>;
+
+    ActivationArena();
+
+    ActivationArena(const ActivationArena&) = delete;
+    ActivationArena& operator=(const ActivationArena&) = delete;
+
+    // Returns the arena of the group for the given stream index, the arena lives while any graph uses it
+    static Ptr get(const std::string& group, size_t stream);
+
+    // Serializes the inferences of the graphs sharing the arena
+    std::mutex& mutex() {
+        return m_guard;
+    }
+
+    [[nodiscard]] const MemoryBlockPtr& block() const {
+        return m_block;
+    }
+
+    // Registers a user of `size` bytes of the arena growing it if needed, must be called under the arena mutex
+    void acquire(size_t size);
+
+    // Unregisters a user, the memory is freed once the arena has no users
+    void release();
+
+    [[nodiscard]] size_t size() const;
+
+private:
+    std::mutex m_guard;
+    mutable std::mutex m_mutex;
+    MemoryBlockPtr m_block;
+    MemoryBlockWithReuse* m_memory = nullptr;
+    size_t m_users = 0;
+};
+
+}  // namespace ov::intel_cpu
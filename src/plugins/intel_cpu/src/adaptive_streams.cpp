@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "adaptive_streams.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+namespace {
+
+// The other partition has to be preferred for at least this long before the switch
+constexpr std::chrono::milliseconds min_hold{20};
+// ... and for at least this many average inference latencies, so slow models don't flap either
+constexpr double hold_latencies = 8.0;
+
+}  // namespace
+
+AdaptiveStreams::AdaptiveStreams(std::shared_ptr<ov::ICompiledModel> wide_model, int narrow_streams, int wide_streams)
+    : m_wide_model(std::move(wide_model)),
+      m_narrow_streams(narrow_streams),
+      m_wide_streams(wide_streams) {
+    OPENVINO_ASSERT(m_wide_streams > 0 && m_wide_streams < m_narrow_streams,
+                    "Adaptive streams expect fewer wide streams than narrow ones, got ",
+                    m_wide_streams,
+                    " and ",
+                    m_narrow_streams);
+}
+
+AdaptiveStreams::~AdaptiveStreams() {
+    // the completion callbacks of the inferences in flight still use the slots
+    for (auto& slot : m_slots) {
+        try {
+            slot->request->wait();
+        } catch (...) {
+        }
+    }
+}
+
+AdaptiveStreams::Mode AdaptiveStreams::begin() {
+    const size_t in_flight = m_in_flight.fetch_add(1, std::memory_order_relaxed) + 1;
+    const auto preferred = in_flight <= static_cast<size_t>(m_wide_streams) ? Mode::Wide : Mode::Narrow;
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto mode = m_mode.load(std::memory_order_relaxed);
+    if (preferred == mode) {
+        m_preferred_since = {};
+        return mode;
+    }
+    if (m_preferred_since == std::chrono::steady_clock::time_point{}) {
+        m_preferred_since = now;
+        return mode;
+    }
+    using seconds = std::chrono::duration<double>;
+    const auto hold = std::max<seconds>(min_hold, seconds(m_latency * hold_latencies));
+    if (now - m_preferred_since < hold) {
+        return mode;
+    }
+    m_preferred_since = {};
+    m_mode.store(preferred, std::memory_order_relaxed);
+    m_switches.fetch_add(1, std::memory_order_relaxed);
+    return preferred;
+}
+
+void AdaptiveStreams::end(std::chrono::steady_clock::time_point start) {
+    const double latency = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    m_in_flight.fetch_sub(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_latency = m_latency == 0.0 ? latency : 0.9 * m_latency + 0.1 * latency;
+}
+
+AdaptiveStreams::Slot* AdaptiveStreams::acquire() {
+    std::lock_guard<std::mutex> lock(m_slots_mutex);
+    if (m_idle.empty()) {
+        auto slot = std::make_unique<Slot>();
+        slot->request = m_wide_model->create_infer_request();
+        for (const auto& port : m_wide_model->inputs()) {
+            slot->own_tensors.push_back(slot->request->get_tensor(port));
+        }
+        for (const auto& port : m_wide_model->outputs()) {
+            slot->own_tensors.push_back(slot->request->get_tensor(port));
+        }
+        auto* raw = slot.get();
+        slot->request->set_callback([this, raw](const std::exception_ptr& error) {
+            auto resume = std::move(raw->resume);
+            *raw->error = error;
+            release(raw);
+            resume();
+        });
+        m_idle.push_back(raw);
+        m_slots.push_back(std::move(slot));
+    }
+    auto* slot = m_idle.back();
+    m_idle.pop_back();
+    return slot;
+}
+
+void AdaptiveStreams::release(Slot* slot) {
+    // the idle slot must not keep the tensors of the user request alive or write to them
+    const auto& inputs = m_wide_model->inputs();
+    const auto& outputs = m_wide_model->outputs();
+    try {
+        for (size_t i = 0; i < inputs.size(); i++) {
+            slot->request->set_tensor(inputs[i], slot->own_tensors[i]);
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            slot->request->set_tensor(outputs[i], slot->own_tensors[inputs.size() + i]);
+        }
+    } catch (...) {
+        // the slot is dropped then, its request keeps the user tensors until the adaptive streams are destroyed
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_slots_mutex);
+    m_idle.push_back(slot);
+}
+
+void AdaptiveStreams::submit_wide(ov::ISyncInferRequest& request,
+                                  ov::threading::Task resume,
+                                  std::exception_ptr& error) {
+    Slot* slot = nullptr;
+    try {
+        slot = acquire();
+        slot->resume = std::move(resume);
+        slot->error = &error;
+        const auto& inputs = m_wide_model->inputs();
+        const auto& outputs = m_wide_model->outputs();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            slot->request->set_tensor(inputs[i], request.get_tensor(request.get_inputs()[i]));
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            slot->request->set_tensor(outputs[i], request.get_tensor(request.get_outputs()[i]));
+        }
+        slot->request->start_async();
+    } catch (...) {
+        error = std::current_exception();
+        if (slot != nullptr) {
+            resume = std::move(slot->resume);
+            release(slot);
+        }
+        resume();
+    }
+}
+
+void AdaptiveStreamsExecutor::run(ov::threading::Task task) {
+    m_error = nullptr;
+    const auto start = std::chrono::steady_clock::now();
+    m_wide = m_streams->begin() == AdaptiveStreams::Mode::Wide;
+    // the request may be released by the time the pipeline task returns, so the controller is captured by value
+    if (m_wide) {
+        m_streams->submit_wide(
+            m_request,
+            [streams = m_streams, task = std::move(task), start] {
+                streams->end(start);
+                task();
+            },
+            m_error);
+        return;
+    }
+    m_narrow_executor->run([streams = m_streams, task = std::move(task), start] {
+        task();
+        streams->end(start);
+    });
+}
+
+}  // namespace ov::intel_cpu
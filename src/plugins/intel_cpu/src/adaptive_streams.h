@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Lets a multi-stream compiled model serve its asynchronous requests either by its own narrow streams or by a copy of
+ * the compiled model with fewer streams spanning the same threads. The copy shares the weights cache, so keeping both
+ * partitions costs only the intermediate buffers of the wide graphs.
+ * The partition follows the number of inferences in flight: while it doesn't exceed the number of the wide streams,
+ * the requests are latency bound and are served by the wide streams. The partition is switched only after the other
+ * one has been preferred for a few average request latencies, the inferences already started finish in the partition
+ * they were started in.
+ */
+class AdaptiveStreams {
+public:
+    enum class Mode : uint8_t { Narrow = 0, Wide = 1 };
+
+    AdaptiveStreams(std::shared_ptr<ov::ICompiledModel> wide_model, int narrow_streams, int wide_streams);
+    ~AdaptiveStreams();
+
+    AdaptiveStreams(const AdaptiveStreams&) = delete;
+    AdaptiveStreams& operator=(const AdaptiveStreams&) = delete;
+
+    // Chooses the partition of the next inference and accounts it as in flight
+    Mode begin();
+
+    // Accounts the inference started at `start` as finished
+    void end(std::chrono::steady_clock::time_point start);
+
+    /**
+     * Runs the inference of the request by the wide streams. The tensors of the request are shared with the wide
+     * request, `error` is set before `resume` is called if the inference failed.
+     */
+    void submit_wide(ov::ISyncInferRequest& request, ov::threading::Task resume, std::exception_ptr& error);
+
+    // Number of streams the requests are currently served by
+    int streams() const {
+        return m_mode.load(std::memory_order_relaxed) == Mode::Wide ? m_wide_streams : m_narrow_streams;
+    }
+
+    uint64_t switches() const {
+        return m_switches.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::shared_ptr<ov::IAsyncInferRequest> request;
+        // the tensors allocated by the request itself, restored once the inference of a user request is done
+        std::vector<ov::SoPtr<ov::ITensor>> own_tensors;
+        ov::threading::Task resume;
+        std::exception_ptr* error = nullptr;
+    };
+
+    Slot* acquire();
+    void release(Slot* slot);
+
+    std::shared_ptr<ov::ICompiledModel> m_wide_model;
+    const int m_narrow_streams;
+    const int m_wide_streams;
+
+    std::atomic<size_t> m_in_flight{0};
+    std::atomic<Mode> m_mode{Mode::Narrow};
+    std::atomic<uint64_t> m_switches{0};
+
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_preferred_since;
+    double m_latency = 0.0;  // average inference latency in seconds
+
+    std::mutex m_slots_mutex;
+    std::vector<std::unique_ptr<Slot>> m_slots;
+    std::vector<Slot*> m_idle;
+};
+
+/**
+ * The first stage executor of an async infer request of an adaptive streams compiled model. Routes every inference
+ * either to the narrow streams executor or to the wide streams.
+ */
+class AdaptiveStreamsExecutor : public ov::threading::ITaskExecutor {
+public:
+    AdaptiveStreamsExecutor(std::shared_ptr<AdaptiveStreams> streams,
+                            std::shared_ptr<ov::threading::ITaskExecutor> narrow_executor,
+                            ov::ISyncInferRequest& request)
+        : m_streams(std::move(streams)),
+          m_narrow_executor(std::move(narrow_executor)),
+          m_request(request) {}
+
+    void run(ov::threading::Task task) override;
+
+    // Whether the current inference has been executed by the wide streams
+    bool wide() const {
+        return m_wide;
+    }
+
+    void rethrow_if_failed() const {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    std::shared_ptr<AdaptiveStreams> m_streams;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_narrow_executor;
+    ov::ISyncInferRequest& m_request;
+    bool m_wide = false;
+    std::exception_ptr m_error;
+};
+
+}  // namespace ov::intel_cpu
@@ -7,6 +7,8 @@
 #include <memory>
 #include <vector>
 
+#include "adaptive_streams.h"
+#include "micro_batcher.h"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -50,6 +52,34 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
     m_sub_infer_requests = requests;
 }
 
+void ov::intel_cpu::AsyncInferRequest::setMicroBatcher(
+    const std::shared_ptr<MicroBatcher>& batcher,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor) {
+    auto& request = *static_cast<SyncInferRequest*>(m_internal_request.get());
+    auto executor = std::make_shared<MicroBatchExecutor>(batcher, task_executor, request);
+    m_pipeline = {{executor, [this, executor = executor.get()] {
+                       if (executor->batched()) {
+                           executor->rethrow_if_failed();
+                       } else {
+                           m_internal_request->infer();
+                       }
+                   }}};
+}
+
+void ov::intel_cpu::AsyncInferRequest::setAdaptiveStreams(
+    const std::shared_ptr<AdaptiveStreams>& streams,
+    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor) {
+    auto& request = *static_cast<SyncInferRequest*>(m_internal_request.get());
+    auto executor = std::make_shared<AdaptiveStreamsExecutor>(streams, task_executor, request);
+    m_pipeline = {{executor, [this, executor = executor.get()] {
+                       if (executor->wide()) {
+                           executor->rethrow_if_failed();
+                       } else {
+                           m_internal_request->infer();
+                       }
+                   }}};
+}
+
 void ov::intel_cpu::AsyncInferRequest::infer() {
     m_infer_func();
 }
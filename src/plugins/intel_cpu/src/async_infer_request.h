@@ -8,7 +8,9 @@
 #include <memory>
 #include <vector>
 
+#include "adaptive_streams.h"
 #include "infer_request.h"
+#include "micro_batcher.h"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -38,6 +40,14 @@ public:
 
     void throw_if_canceled() const;
 
+    // Routes the asynchronous inferences either to the task executor or to the micro-batcher
+    void setMicroBatcher(const std::shared_ptr<MicroBatcher>& batcher,
+                         const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor);
+
+    // Routes the asynchronous inferences either to the task executor or to the wide streams
+    void setAdaptiveStreams(const std::shared_ptr<AdaptiveStreams>& streams,
+                            const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor);
+
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_sub_infer_requests;
     bool m_has_sub_infers = false;
     std::shared_ptr<IInferRequest> m_internal_request;
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "internal_properties.hpp"
+#include "itt.h"
+
+namespace ov::intel_cpu {
+
+JitKernelRegistry& JitKernelRegistry::instance() {
+    static JitKernelRegistry registry;
+    return registry;
+}
+
+void JitKernelRegistry::codegen(const std::string& type, const std::function<size_t()>& generate) {
+    size_t size = 0;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        openvino::itt::ScopedTask<itt::domains::ov_intel_cpu> task(openvino::itt::handle("jit_codegen::" + type));
+        size = generate();
+    }
+    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& stats = m_stats[type];
+    stats.kernels++;
+    stats.code_bytes += size;
+    stats.codegen_time_us += static_cast<uint64_t>(time.count());
+}
+
+std::shared_ptr<void> JitKernelRegistry::deduplicateImpl(const std::string& type,
+                                                         const uint8_t* code,
+                                                         size_t size,
+                                                         std::shared_ptr<void> kernel) {
+    if (code == nullptr || size == 0) {
+        return kernel;
+    }
+    const auto hash = std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(code), size));
+    // the replaced kernel and the evicted ones are released after the lock
+    std::vector<std::shared_ptr<void>> released;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& [records, sweepSize] = m_records[type];
+    auto [begin, end] = records.equal_range(hash);
+    for (auto it = begin; it != end;) {
+        auto live = it->second.kernel.lock();
+        if (!live) {
+            it = records.erase(it);
+            continue;
+        }
+        if (it->second.size == size && std::memcmp(it->second.code, code, size) == 0) {
+            m_stats[type].deduplicated++;
+            touch(it->second, live);
+            released.push_back(std::move(kernel));
+            return live;
+        }
+        ++it;
+    }
+
+    if (records.size() >= sweepSize) {
+        for (auto it = records.begin(); it != records.end();) {
+            it = it->second.kernel.expired() ? records.erase(it) : std::next(it);
+        }
+        sweepSize = std::max(sweepSize, 2 * records.size());
+    }
+    const auto& record = records.emplace(hash, Record{kernel, code, size})->second;
+    touch(record, kernel);
+    released = evict();
+    return kernel;
+}
+
+void JitKernelRegistry::touch(const Record& record, const std::shared_ptr<void>& kernel) {
+    if (m_cacheCapacity == 0 || record.size > m_cacheCapacity) {
+        return;
+    }
+    auto it = m_cacheIndex.find(&record);
+    if (it != m_cacheIndex.end()) {
+        m_cache.splice(m_cache.begin(), m_cache, it->second);
+        return;
+    }
+    m_cache.emplace_front(&record, kernel);
+    m_cacheIndex[&record] = m_cache.begin();
+    m_cacheSize += record.size;
+}
+
+std::vector<std::shared_ptr<void>> JitKernelRegistry::evict() {
+    std::vector<std::shared_ptr<void>> evicted;
+    while (m_cacheSize > m_cacheCapacity) {
+        auto& [record, kernel] = m_cache.back();
+        m_cacheSize -= record->size;
+        m_cacheIndex.erase(record);
+        evicted.push_back(std::move(kernel));
+        m_cache.pop_back();
+    }
+    return evicted;
+}
+
+void JitKernelRegistry::setCacheCapacity(uint64_t bytes) {
+    std::vector<std::shared_ptr<void>> evicted;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cacheCapacity = bytes;
+    evicted = evict();
+}
+
+uint64_t JitKernelRegistry::getCacheCapacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cacheCapacity;
+}
+
+std::map<std::string, JitKernelsStats> JitKernelRegistry::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "internal_properties.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <common/c_types_map.hpp>
+
+#    include "cpu/x64/jit_generator.hpp"
+#endif
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Process wide registry of the JIT kernels generated by the plugin.
+ * Every code generation is accounted per kernel type (count, code size and time) and annotated as an ITT task.
+ * The kernels passed to deduplicate() are replaced by a live kernel of the same type with byte-identical code, so
+ * the graphs of the different streams and models share one copy of it. Up to the cache capacity (in code bytes) the
+ * deduplicated kernels are also kept alive after their last user is gone, the least recently used ones are evicted
+ * first.
+ *
+ * @note This implementation is thread safe
+ */
+class JitKernelRegistry {
+public:
+    static JitKernelRegistry& instance();
+
+    /**
+     * @brief Runs the code generation of a kernel and accounts it
+     * @param type is the kernel type the statistics are collected for
+     * @param generate generates the code and returns its size in bytes
+     */
+    void codegen(const std::string& type, const std::function<size_t()>& generate);
+
+    /**
+     * @brief Searches a live kernel of the type with the same code or registers the kernel
+     * @return the found kernel or the passed one
+     */
+    template <typename T>
+    std::shared_ptr<T> deduplicate(const std::string& type,
+                                   const uint8_t* code,
+                                   size_t size,
+                                   std::shared_ptr<T> kernel) {
+        return std::static_pointer_cast<T>(deduplicateImpl(type, code, size, std::move(kernel)));
+    }
+
+    void setCacheCapacity(uint64_t bytes);
+    [[nodiscard]] uint64_t getCacheCapacity() const;
+
+    [[nodiscard]] std::map<std::string, JitKernelsStats> getStats() const;
+
+private:
+    struct Record {
+        std::weak_ptr<void> kernel;
+        const uint8_t* code = nullptr;
+        size_t size = 0;
+    };
+    struct Records {
+        // by the hash of the code
+        std::unordered_multimap<size_t, Record> records;
+        // the records of the destroyed kernels are swept when the number of records reaches it
+        size_t sweepSize = 64;
+    };
+    using CacheList = std::list<std::pair<const Record*, std::shared_ptr<void>>>;
+
+    JitKernelRegistry() = default;
+
+    std::shared_ptr<void> deduplicateImpl(const std::string& type,
+                                          const uint8_t* code,
+                                          size_t size,
+                                          std::shared_ptr<void> kernel);
+    void touch(const Record& record, const std::shared_ptr<void>& kernel);
+    std::vector<std::shared_ptr<void>> evict();
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, JitKernelsStats> m_stats;
+    // records of the deduplicated kernels by type
+    std::unordered_map<std::string, Records> m_records;
+    // the kernels kept alive by the registry, the most recently used first
+    CacheList m_cache;
+    std::unordered_map<const Record*, CacheList::iterator> m_cacheIndex;
+    uint64_t m_cacheCapacity = 0;
+    uint64_t m_cacheSize = 0;
+};
+
+#if defined(OPENVINO_ARCH_X86_64)
+/**
+ * @brief Generates the code of the kernel by jit_generator_t::create_kernel() and accounts it in the registry
+ */
+inline dnnl::impl::status_t createJitKernel(dnnl::impl::cpu::x64::jit_generator_t& kernel) {
+    dnnl::impl::status_t status = dnnl::impl::status::success;
+    JitKernelRegistry::instance().codegen(kernel.name(), [&]() {
+        status = kernel.dnnl::impl::cpu::x64::jit_generator_t::create_kernel();
+        return kernel.getSize();
+    });
+    return status;
+}
+#endif
+
+}  // namespace ov::intel_cpu
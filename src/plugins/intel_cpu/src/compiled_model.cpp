@@ -5,15 +5,20 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "activation_arena.h"
+#include "adaptive_streams.h"
 #include "async_infer_request.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
@@ -22,6 +27,7 @@
 #include "infer_request.h"
 #include "internal_properties.hpp"
 #include "low_precision/low_precision.hpp"
+#include "micro_batcher.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -31,6 +37,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -63,6 +70,9 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    // the batcher and the adaptive streams keep requests of the models they delegate to
+    m_micro_batcher.reset();
+    m_adaptive_streams.reset();
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -78,7 +88,8 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const SocketsWeights* socket_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
@@ -87,6 +98,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (socket_weights) {
+        m_socketWeights = *socket_weights;
+    }
     m_runtime_requirements = build_runtime_requirements();
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
@@ -122,9 +136,34 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
     int streams = std::max(1, executor_config.get_streams());
+    if (m_cfg.enableHybridNodePlacement) {
+        const auto proc_type_table = ov::get_proc_type_table();
+        const int efficient_cores = proc_type_table.empty() || proc_type_table[0][MAIN_CORE_PROC] == 0
+                                        ? 0
+                                        : proc_type_table[0][EFFICIENT_CORE_PROC];
+        // The efficient cores are split between the streams. The nodes keep per-thread buffers sized for the stream, so
+        // an efficient core arena must not be wider. With more streams than efficient cores only the first streams
+        // get one, the others execute their segments on their own cores.
+        const int threads = std::max(1, std::min(efficient_cores / streams, executor_config.get_threads_per_stream()));
+        const int executors = efficient_cores == 0 ? 0 : std::min(streams, efficient_cores / threads);
+        for (int i = 0; i < executors; i++) {
+            m_efficient_core_executors.push_back(m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+                IStreamsExecutor::Config{"CPUEfficientCoreExecutor",
+                                         1,
+                                         threads,
+                                         ov::hint::SchedulingCoreType::ECORE_ONLY}));
+        }
+    }
+
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
+    // the tensor parallel sub-models are executed while the graph of the main model is locked, so they can't share
+    if (!m_cfg.activationArenaGroup.empty() && m_cfg.numSubStreams == 0 && !m_sub_memory_manager) {
+        for (size_t i = 0; i < m_graphs.size(); i++) {
+            m_graphs[i]._arena = ActivationArena::get(m_cfg.activationArenaGroup, i);
+        }
+    }
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
@@ -175,6 +214,17 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                 std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
         }
     }
+    // The wide partition is a single stream over all the threads, compiled from the same model and weights cache
+    if (m_cfg.enableAdaptiveStreams && !m_has_sub_compiled_models && !m_cfg.exclusiveAsyncRequests &&
+        executor_config.get_streams() > 1 && !model->is_dynamic() && model->get_variables().empty()) {
+        auto wide_cfg = m_cfg;
+        wide_cfg.enableAdaptiveStreams = false;
+        wide_cfg.streamExecutorConfig =
+            IStreamsExecutor::Config{"CPUWideStreamsExecutor", 1, executor_config.get_threads()};
+        m_wide_streams_model =
+            std::make_shared<CompiledModel>(model, plugin, wide_cfg, loaded_from_cache, nullptr, &m_socketWeights);
+        m_adaptive_streams = std::make_shared<AdaptiveStreams>(m_wide_streams_model, executor_config.get_streams(), 1);
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -209,7 +259,11 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         graph_idx < m_efficient_core_executors.size()
+                                                             ? m_efficient_core_executors[graph_idx]
+                                                             : nullptr,
+                                                         graphLock._graph._arena);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -252,9 +306,26 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
         async_infer_request->setSubInferRequest(requests);
         async_infer_request->setSubInfer(true);
     }
+    if (m_micro_batcher) {
+        async_infer_request->setMicroBatcher(m_micro_batcher, get_task_executor());
+    } else if (m_adaptive_streams) {
+        async_infer_request->setAdaptiveStreams(m_adaptive_streams, get_task_executor());
+    }
     return async_infer_request;
 }
 
+void CompiledModel::enable_micro_batching(const std::shared_ptr<ov::Model>& batched_model, const Config& cfg) {
+    m_micro_batched_model = std::make_shared<CompiledModel>(batched_model,
+                                                            m_plugin,
+                                                            cfg,
+                                                            m_loaded_from_cache,
+                                                            nullptr,
+                                                            &m_socketWeights);
+    m_micro_batcher = std::make_shared<MicroBatcher>(m_micro_batched_model,
+                                                     m_cfg.microBatchSize,
+                                                     std::chrono::microseconds(m_cfg.microBatchTimeout));
+}
+
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
@@ -267,6 +338,66 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
+    if (name == ov::intel_cpu::adaptive_streams_active) {
+        return m_adaptive_streams ? m_adaptive_streams->streams() : m_cfg.streamExecutorConfig.get_streams();
+    }
+    if (name == ov::intel_cpu::efficient_core_time_share) {
+        uint64_t infer_time = 0;
+        uint64_t efficient_core_time = 0;
+        for (auto& graph : m_graphs) {
+            GraphGuard::Lock lock(graph);
+            const auto [total, efficient] = lock._graph.getEfficientCoreTime();
+            infer_time += total;
+            efficient_core_time += efficient;
+        }
+        return infer_time == 0 ? 0.F : static_cast<float>(efficient_core_time) / static_cast<float>(infer_time);
+    }
+    if (name == ov::intel_cpu::weights_bandwidth) {
+        std::map<std::string, std::pair<uint64_t, uint64_t>> stats;
+        for (auto& graph : m_graphs) {
+            GraphGuard::Lock lock(graph);
+            for (const auto& [layer, stat] : lock._graph.getWeightsStreamStats()) {
+                stats[layer].first += stat.first;
+                stats[layer].second += stat.second;
+            }
+        }
+        std::map<std::string, float> bandwidth;
+        for (const auto& [layer, stat] : stats) {
+            // bytes per nanosecond is GB/s
+            const auto& [bytes, time] = stat;
+            bandwidth[layer] = time == 0 ? 0.F : static_cast<float>(bytes) / static_cast<float>(time);
+        }
+        return bandwidth;
+    }
+    if (name == ov::intel_cpu::weights_prefetch_requested_bytes) {
+        uint64_t bytes = 0;
+        for (auto& graph : m_graphs) {
+            GraphGuard::Lock lock(graph);
+            bytes += lock._graph.getWeightsPrefetchRequestedBytes();
+        }
+        return bytes;
+    }
+    if (name == ov::intel_cpu::activation_arena_size) {
+        uint64_t size = 0;
+        for (const auto& graph : m_graphs) {
+            if (graph._arena) {
+                size = std::max<uint64_t>(size, graph._arena->size());
+            }
+        }
+        return size;
+    }
+    if (name == ov::intel_cpu::micro_batching_mode) {
+        if (!m_micro_batcher) {
+            return std::string("DISABLED");
+        }
+        return std::string(m_micro_batcher->mode() == MicroBatcher::Mode::Batched ? "BATCHED" : "DIRECT");
+    }
+    if (name == ov::intel_cpu::micro_batched_requests) {
+        return m_micro_batcher ? m_micro_batcher->batched_requests() : uint64_t{0};
+    }
+    if (name == ov::intel_cpu::adaptive_streams_switches) {
+        return m_adaptive_streams ? m_adaptive_streams->switches() : uint64_t{0};
+    }
 
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
@@ -312,7 +443,15 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
             RO_property(ov::value_cache_group_size.name()),
-            RO_property(ov::runtime_requirements.name())};
+            RO_property(ov::runtime_requirements.name()),
+            RO_property(ov::intel_cpu::adaptive_streams_active.name()),
+            RO_property(ov::intel_cpu::adaptive_streams_switches.name()),
+            RO_property(ov::intel_cpu::efficient_core_time_share.name()),
+            RO_property(ov::intel_cpu::weights_bandwidth.name()),
+            RO_property(ov::intel_cpu::weights_prefetch_requested_bytes.name()),
+            RO_property(ov::intel_cpu::micro_batching_mode.name()),
+            RO_property(ov::intel_cpu::micro_batched_requests.name()),
+            RO_property(ov::intel_cpu::activation_arena_size.name())};
 
         return ro_properties;
     }
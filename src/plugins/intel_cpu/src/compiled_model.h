@@ -13,8 +13,11 @@
 #include <utility>
 #include <vector>
 
+#include "activation_arena.h"
+#include "adaptive_streams.h"
 #include "config.h"
 #include "graph.h"
+#include "micro_batcher.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -22,6 +25,7 @@
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
@@ -34,9 +38,16 @@ public:
 
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // activation arena shared with the graphs of the other compiled models of the group on the same stream
+        std::shared_ptr<ActivationArena> _arena;
         struct Lock : public std::unique_lock<std::mutex> {
-            explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {
+                if (graph._arena) {
+                    _arenaLock = std::unique_lock<std::mutex>(graph._arena->mutex());
+                }
+            }
             GraphGuard& _graph;
+            std::unique_lock<std::mutex> _arenaLock;
         };
     };
 
@@ -44,7 +55,8 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  const SocketsWeights* socket_weights = nullptr);
 
     ~CompiledModel() override;
 
@@ -67,6 +79,12 @@ public:
         return m_name;
     }
 
+    /**
+     * Compiles the model with the relaxed batch dimension sharing the weights cache of this compiled model and lets
+     * the asynchronous requests be coalesced into its executions.
+     */
+    void enable_micro_batching(const std::shared_ptr<ov::Model>& batched_model, const Config& cfg);
+
 private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
@@ -102,6 +120,12 @@ private:
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+    std::shared_ptr<CompiledModel> m_micro_batched_model = nullptr;
+    std::shared_ptr<MicroBatcher> m_micro_batcher = nullptr;
+    std::shared_ptr<CompiledModel> m_wide_streams_model = nullptr;
+    std::shared_ptr<AdaptiveStreams> m_adaptive_streams = nullptr;
+    // one executor per stream, so the streams never wait for each other's efficient core segments
+    std::vector<std::shared_ptr<ov::threading::IStreamsExecutor>> m_efficient_core_executors;
     std::string m_runtime_requirements;
 };
 
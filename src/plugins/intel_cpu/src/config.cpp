@@ -315,6 +315,18 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::intel_cpu::snippets_mode.name(),
                                ". Expected values: ov::intel_cpu::SnippetsMode::ENABLE/DISABLE/IGNORE_CALLBACK");
             }
+        } else if (key == ov::intel_cpu::snippets_brgemm_blocking_tuning.name()) {
+            try {
+                snippetsBrgemmBlockingTuning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::snippets_brgemm_blocking_tuning.name());
+            }
+        } else if (key == ov::cache_dir.name()) {
+            try {
+                cacheDir = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::cache_dir.name());
+            }
         } else if (key == ov::hint::execution_mode.name()) {
             try {
                 executionMode = val.as<ov::hint::ExecutionMode>();
@@ -335,7 +347,9 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                            ov::element::bf16,
                            ov::element::u8,
                            ov::element::u4,
-                           ov::element::u3)) {
+                           ov::element::u3,
+                           ov::element::f8e4m3,
+                           ov::element::f8e5m2)) {
                     kvCachePrecision = prec;
                 } else {
                     OPENVINO_THROW("invalid value");
@@ -345,7 +359,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::hint::kv_cache_precision.name(),
-                               ". Supported values: u8, u4, u3, bf16, f16, f32");
+                               ". Supported values: u8, u4, u3, f8e4m3, f8e5m2, bf16, f16, f32");
             }
         } else if (key == ov::key_cache_precision.name()) {
             try {
@@ -358,7 +372,9 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                            ov::element::i8,
                            ov::element::u8,
                            ov::element::u4,
-                           ov::element::u3)) {
+                           ov::element::u3,
+                           ov::element::f8e4m3,
+                           ov::element::f8e5m2)) {
                     keyCachePrecision = prec;
                 } else {
                     OPENVINO_THROW("keyCachePrecision doesn't support value ", prec);
@@ -368,7 +384,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::key_cache_precision.name(),
-                               ". Supported values: u3, u4, u8, i8, bf16, f16, f32");
+                               ". Supported values: u3, u4, u8, i8, f8e4m3, f8e5m2, bf16, f16, f32");
             }
         } else if (key == ov::value_cache_precision.name()) {
             try {
@@ -380,7 +396,9 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                            ov::element::bf16,
                            ov::element::u8,
                            ov::element::u4,
-                           ov::element::u3)) {
+                           ov::element::u3,
+                           ov::element::f8e4m3,
+                           ov::element::f8e5m2)) {
                     valueCachePrecision = prec;
                 } else {
                     OPENVINO_THROW("valueCachePrecision doesn't support value ", prec);
@@ -390,7 +408,7 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                val.as<std::string>(),
                                " for property key ",
                                ov::value_cache_precision.name(),
-                               ". Supported values: u3, u4, u8, bf16, f16, f32");
+                               ". Supported values: u3, u4, u8, f8e4m3, f8e5m2, bf16, f16, f32");
             }
         } else if (key == ov::internal::key_cache_quant_alg.name()) {
             auto alg = val.as<ov::internal::CacheQuantAlgorithm>();
@@ -495,6 +513,78 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::enable_branch_parallelism.name()) {
+            try {
+                enableBranchParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_branch_parallelism.name());
+            }
+        } else if (key == ov::intel_cpu::micro_batch_size.name()) {
+            try {
+                microBatchSize = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::micro_batch_size.name());
+            }
+        } else if (key == ov::intel_cpu::micro_batch_timeout.name()) {
+            try {
+                microBatchTimeout = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::micro_batch_timeout.name());
+            }
+        } else if (key == ov::intel_cpu::enable_adaptive_streams.name()) {
+            try {
+                enableAdaptiveStreams = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_adaptive_streams.name());
+            }
+        } else if (key == ov::intel_cpu::enable_hybrid_node_placement.name()) {
+            try {
+                enableHybridNodePlacement = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_hybrid_node_placement.name());
+            }
+        } else if (key == ov::intel_cpu::enable_winograd_convolution.name()) {
+            try {
+                enableWinogradConvolution = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_winograd_convolution.name());
+            }
+        } else if (key == ov::intel_cpu::enable_structured_sparse_fc.name()) {
+            try {
+                fcStructuredSparsity = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_structured_sparse_fc.name());
+            }
+        } else if (key == ov::intel_cpu::enable_yuv_preprocess_fusion.name()) {
+            try {
+                enableYuvPreprocessFusion = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_yuv_preprocess_fusion.name());
+            }
+        } else if (key == ov::intel_cpu::enable_inverted_residual_fusion.name()) {
+            try {
+                enableInvertedResidualFusion = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_inverted_residual_fusion.name());
+            }
+        } else if (key == ov::intel_cpu::weights_prefetch_distance.name()) {
+            try {
+                weightsPrefetchDistance = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::weights_prefetch_distance.name());
+            }
+        } else if (key == ov::intel_cpu::jit_kernels_cache_capacity.name()) {
+            try {
+                jitKernelsCacheCapacity = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::jit_kernels_cache_capacity.name());
+            }
+        } else if (key == ov::intel_cpu::activation_arena_group.name()) {
+            try {
+                activationArenaGroup = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::activation_arena_group.name());
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
@@ -75,6 +75,9 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool snippetsBrgemmBlockingTuning = false;
+    // model cache directory of the core, the brgemm blocking tuner persists its results there
+    std::string cacheDir;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -93,6 +96,19 @@ struct Config {
     ov::internal::CacheQuantAlgorithm keyCacheQuantAlg = ov::internal::CacheQuantAlgorithm::SCALAR;
     ov::internal::CacheQuantAlgorithm valueCacheQuantAlg = ov::internal::CacheQuantAlgorithm::SCALAR;
     bool enableSageAttn = false;
+    bool enableBranchParallelism = false;
+    uint32_t microBatchSize = 0;
+    uint32_t microBatchTimeout = 500;
+    bool enableAdaptiveStreams = false;
+    bool enableHybridNodePlacement = false;
+    uint32_t weightsPrefetchDistance = 0;
+    bool enableWinogradConvolution = true;
+    bool fcStructuredSparsity = true;
+    bool enableYuvPreprocessFusion = false;
+    bool enableInvertedResidualFusion = false;
+    // process wide, applied by the plugin when it is set explicitly, rejected by compile_model
+    uint64_t jitKernelsCacheCapacity = 0;
+    std::string activationArenaGroup;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -256,6 +256,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"YuvPreprocess", Type::YuvPreprocess},
         {"EmbeddingBagPacked", Type::EmbeddingBagPacked},
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
@@ -397,6 +398,7 @@ std::string NameFromType(const Type type) {
         CASE(PaKVReorder);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(YuvPreprocess);
         CASE(LLMMLP);
         CASE(QKVProjection);
         CASE(RMS);
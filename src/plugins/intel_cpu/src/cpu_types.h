@@ -133,6 +133,7 @@ enum class Type : uint8_t {
     PaKVReorder,
     RoPE,
     CausalMaskPreprocess,
+    YuvPreprocess,
     LLMMLP,
     QKVProjection,
     RMS,
@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/jit_kernel_registry.h"
 #include "cache/multi_cache.h"
 #include "emitters/plugin/x64/jit_conversion_emitters.hpp"
 #include "emitters/plugin/x64/jit_dnnl_ext_emitters.hpp"
@@ -462,12 +463,16 @@ bool intel_cpu::CPUTargetMachine::is_supported() const {
 }
 
 snippets::CompiledSnippetPtr intel_cpu::CPUTargetMachine::get_snippet() {
-    OPENVINO_ASSERT(h->create_kernel() == dnnl::impl::status::success, "Failed to create jit_kernel in get_snippet()");
+    OPENVINO_ASSERT(createJitKernel(*h) == dnnl::impl::status::success, "Failed to create jit_kernel in get_snippet()");
     const auto& result =
         std::make_shared<CompiledSnippetCPU>(std::unique_ptr<dnnl::impl::cpu::x64::jit_generator_t>(h.release()));
     // Note that we reset all the generated code, since it was copied into CompiledSnippetCPU
     h = std::make_unique<jit_snippet>();
-    return result;
+    // the same subgraph compiled for the other streams or models shares the code
+    return JitKernelRegistry::instance().deduplicate<snippets::CompiledSnippet>("jit_snippet",
+                                                                                result->get_code(),
+                                                                                result->get_code_size(),
+                                                                                result);
 }
 
 intel_cpu::CPUGenerator::CPUGenerator(dnnl::impl::cpu::x64::cpu_isa_t host_isa, ov::intel_cpu::MultiCacheWeakPtr cache)
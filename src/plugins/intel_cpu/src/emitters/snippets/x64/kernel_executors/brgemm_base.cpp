@@ -20,6 +20,7 @@
 #    include <string>
 #endif
 
+#include "cache/jit_kernel_registry.h"
 #include "common/primitive_hashing_utils.hpp"
 #include "common/utils.hpp"
 #include "dnnl_extension_utils.h"
@@ -185,8 +186,13 @@ void BrgemmBaseKernelExecutor::create_brgemm_kernel(std::shared_ptr<brgemm_kerne
     }
 
     cpu::x64::brgemm_kernel_t* kernel_ = nullptr;
-    OV_CPU_JIT_EMITTER_ASSERT(brgemm_kernel_create(&kernel_, desc) == dnnl_success,
-                              "Cannot create brgemm kernel due to invalid params");
+    dnnl_status_t status = dnnl_success;
+    JitKernelRegistry::instance().codegen("brgemm", [&]() {
+        status = brgemm_kernel_create(&kernel_, desc);
+        const auto* generator = kernel_ ? kernel_->get_jit_generator() : nullptr;
+        return generator ? generator->getSize() : 0;
+    });
+    OV_CPU_JIT_EMITTER_ASSERT(status == dnnl_success, "Cannot create brgemm kernel due to invalid params");
     kernel = std::unique_ptr<brgemm_kernel_t>(kernel_);
 }
 
@@ -27,6 +27,7 @@
 #    include <string>
 #endif
 
+#include "cache/jit_kernel_registry.h"
 #include "cache/multi_cache.h"
 #include "dnnl_extension_utils.h"
 #include "emitters/plugin/x64/utils.hpp"
@@ -232,7 +233,7 @@ BrgemmCopyBKernel::BrgemmCopyBKernel(const BrgemmCopyBKernelConfig& conf)
 }
 
 status_t BrgemmCopyBKernel::create_kernel() {
-    const auto code = jit_generator_t::create_kernel();
+    const auto code = createJitKernel(*this);
     OV_CPU_JIT_EMITTER_ASSERT(code == status::success, "Failed to create kernel");
     ker_ = jit_kernel_cast<decltype(ker_)>(const_cast<uint8_t*>(jit_ker()));
     return code;
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <new>
+#include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
@@ -53,6 +54,7 @@
 #include "nodes/reorder.h"
 #include "nodes/subgraph.h"
 #include "nodes/tensoriterator.h"
+#include "onednn/dnnl.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
@@ -69,12 +71,14 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "perf_count.h"
 #include "proxy_mem_blk.h"
+#include "shape_inference/shape_inference_cache.hpp"
 #include "thread_pool_imp.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/node_dumper.h"
 #include "utils/verbose.h"
 #include "weights_cache.hpp"
+#include "weights_prefetcher.h"
 #ifdef CPU_DEBUG_CAPS
 #    include "openvino/core/partial_shape.hpp"
 #endif
@@ -897,14 +901,198 @@ static void AllocatedReferencingEdges(const EdgeClusters& clusters) {
     }
 }
 
+// at least this amount of elements per thread makes the intra node parallelism more efficient
+static constexpr size_t minElementsPerThread = 4096;
+// a smaller node finishes before the branches of a group are dispatched to the threads
+static constexpr size_t minElementsPerBranch = 1024;
+
+// Amount of work of a node, the number of its output elements
+static size_t BranchCost(const NodePtr& node) {
+    size_t elements = 0;
+    for (size_t port = 0; port < node->getOriginalOutputsNumber(); port++) {
+        elements += node->getOutputShapeAtPort(port).getElementsCount();
+    }
+    return elements;
+}
+
+// Nodes which may run concurrently with their siblings. On x86-64 these nodes are executed by their own JIT or
+// reference kernels: they use neither the oneDNN stream of the graph nor the scratchpad of the graph context and
+// don't execute inner graphs. Their output is too small to keep all the threads busy on its own.
+static bool IsBranchParallelCandidate([[maybe_unused]] const NodePtr& node, [[maybe_unused]] size_t maxElements) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!node->isExecutable() || node->isConstant() || node->isInPlace() ||
+        none_of(node->getType(), Type::Eltwise, Type::Reduce, Type::Gather, Type::MVN)) {
+        return false;
+    }
+    const auto elements = BranchCost(node);
+    return elements >= minElementsPerBranch && elements <= maxElements;
+#else
+    return false;
+#endif
+}
+
+// A group pays off when the branches are comparable: running them concurrently is at least twice as fast as running
+// the largest one alone with all the threads
+static bool IsBranchGroupProfitable(const std::vector<NodePtr>& group) {
+    if (group.size() < 2) {
+        return false;
+    }
+    size_t total = 0;
+    size_t largest = 0;
+    for (const auto& node : group) {
+        const auto cost = BranchCost(node);
+        total += cost;
+        largest = std::max(largest, cost);
+    }
+    return largest * 2 <= total;
+}
+
+// Splits the threads between the branches of a group proportionally to their cost, every branch gets one at least
+static std::vector<int> SplitBranchThreads(const std::vector<NodePtr>& group, int threads) {
+    std::vector<size_t> costs(group.size());
+    std::transform(group.begin(), group.end(), costs.begin(), BranchCost);
+    const auto total = std::accumulate(costs.begin(), costs.end(), size_t{0});
+    const auto spare = static_cast<size_t>(threads) - group.size();
+
+    std::vector<int> result(group.size(), 1);
+    size_t assigned = 0;
+    for (size_t i = 0; i < group.size(); i++) {
+        const auto extra = spare * costs[i] / total;
+        result[i] += static_cast<int>(extra);
+        assigned += extra;
+    }
+    // the remainder goes to the most expensive branches
+    std::vector<size_t> order(group.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return costs[a] > costs[b];
+    });
+    for (size_t i = 0; assigned < spare; i = (i + 1) % order.size(), assigned++) {
+        result[order[i]]++;
+    }
+    return result;
+}
+
+/**
+ * Looks for the nodes of independent branches which are ready at the same time. The level of a node is the length of
+ * the longest path from the graph inputs, the candidates of a level form a group executed concurrently if the group
+ * is profitable. A level provides at most as many branches as there are threads, the cheapest candidates stay
+ * sequential. Only when a group is formed the graph is reordered by levels, so the nodes of each group are adjacent
+ * and go first in their level.
+ *
+ * @return groups of nodes to be executed concurrently
+ */
+std::vector<std::vector<NodePtr>> Graph::OrderByBranchLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::OrderByBranchLevels");
+    const auto threads = static_cast<size_t>(parallel_get_max_threads());
+    const auto maxElements = threads * minElementsPerThread;
+
+    std::unordered_map<Node*, size_t> levels;
+    std::map<size_t, std::vector<size_t>> levelCandidates;  // level -> topological indices of the candidates
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        size_t level = 0;
+        for (size_t port = 0; port < node->getParentEdges().size(); port++) {
+            level = std::max(level, levels[node->getParentEdgeAt(port)->getParent().get()] + 1);
+        }
+        levels[node.get()] = level;
+        if (IsBranchParallelCandidate(node, maxElements)) {
+            levelCandidates[level].push_back(i);
+        }
+    }
+
+    std::vector<bool> grouped(graphNodes.size(), false);
+    std::vector<std::vector<NodePtr>> groups;
+    for (auto& [level, candidates] : levelCandidates) {
+        std::stable_sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+            return BranchCost(graphNodes[a]) > BranchCost(graphNodes[b]);
+        });
+        candidates.resize(std::min(candidates.size(), threads));
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<NodePtr> group;
+        for (const auto i : candidates) {
+            group.push_back(graphNodes[i]);
+        }
+        if (!IsBranchGroupProfitable(group)) {
+            continue;
+        }
+        for (const auto i : candidates) {
+            grouped[i] = true;
+        }
+        groups.emplace_back(std::move(group));
+    }
+    if (groups.empty()) {
+        return groups;
+    }
+
+    std::vector<std::tuple<size_t, bool, size_t>> keys;  // {level, !grouped, topological index}
+    keys.reserve(graphNodes.size());
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        keys.emplace_back(levels[graphNodes[i].get()], !grouped[i], i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<NodePtr> ordered;
+    ordered.reserve(graphNodes.size());
+    for (const auto& [level, notGrouped, i] : keys) {
+        const auto& node = graphNodes[i];
+        node->execIndex = static_cast<int>(ordered.size());
+        ordered.push_back(node);
+    }
+    graphNodes = std::move(ordered);
+
+    return groups;
+}
+
 std::vector<size_t> Graph::CreateExecutionGraph() {
     const bool hasDynNodes = ProcessDynNodes();
     auto syncNodesInds = hasDynNodes ? IdentifySyncPoints(graphNodes) : std::vector<size_t>{};
 
+    // Memory nodes rely on the execution order established by SortTopologically()
+    const bool branchParallel = !hasDynNodes && getConfig().enableBranchParallelism &&
+                                parallel_get_max_threads() > 1 &&
+                                std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+                                    return any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+                                });
+    const auto branchGroups = branchParallel ? OrderByBranchLevels() : std::vector<std::vector<NodePtr>>{};
+
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
 
+    m_executableBranchGroups.clear();
+    for (const auto& group : branchGroups) {
+        const auto first = std::find(m_executableGraphNodes.begin(), m_executableGraphNodes.end(), group.front());
+        const auto begin = static_cast<size_t>(std::distance(m_executableGraphNodes.begin(), first));
+        if (begin + group.size() > m_executableGraphNodes.size() || !std::equal(group.begin(), group.end(), first)) {
+            continue;
+        }
+        BranchGroup branchGroup{begin, begin + group.size(), SplitBranchThreads(group, parallel_get_max_threads())};
+#if OV_THREAD_USE_TBB
+        for (const auto threads : branchGroup.threads) {
+            branchGroup.arenas.push_back(std::make_shared<tbb::task_arena>(threads));
+        }
+#endif
+        m_executableBranchGroups.push_back(std::move(branchGroup));
+    }
+
+    m_efficientCoreSegments.clear();
+    if (!hasDynNodes && m_executableBranchGroups.empty() && m_context->getEfficientCoreExecutor()) {
+        m_efficientCoreSegments = FindEfficientCoreSegments();
+    }
+
+    InitWeightsStreaming();
+
     if (hasDynNodes) {
+        // Shape inference results are memoized per node, so switching back to a recurring input shape skips it.
+        // The runtime cache capacity controls all the shape keyed caches, 0 disables them.
+        if (getConfig().rtCacheCapacity > 0) {
+            for (const auto& node : m_executableGraphNodes) {
+                if (node->isDynamicNode()) {
+                    node->enableShapeInferCache(ShapeInferCached::defaultCapacity);
+                }
+            }
+        }
         status = Status::ReadyDynamic;
         // Here we use the following heuristic: if the number of sync nodes is less than 10 times of the number of exec
         // nodes, it does make sense to use Sequential dynamic shapes processing due to the high overheads on context
@@ -958,6 +1146,14 @@ int Graph::RegisterToAllocationContext(int offset, AllocationContext& context) {
         context.execIndex[node] = {inputExecIndex, outputExecIndex};
     }
 
+    // the nodes of a group run concurrently, so their input and output memory must be alive at the same time
+    for (const auto& group : m_executableBranchGroups) {
+        const auto groupExecIndex = context.execIndex[m_executableGraphNodes[group.begin]].first;
+        for (size_t i = group.begin; i < group.end; i++) {
+            context.execIndex[m_executableGraphNodes[i]] = {groupExecIndex, groupExecIndex};
+        }
+    }
+
     context.edges.insert(context.edges.end(), graphEdges.begin(), graphEdges.end());
 
     return offset - 1;
@@ -1361,9 +1557,252 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
     return result;
 }
 
-void Graph::InferStatic(SyncInferRequest* request, int numaId) {
-    for (const auto& node : m_executableGraphNodes) {
+void Graph::ExecuteBranchGroup(const BranchGroup& group, SyncInferRequest* request, int numaId) const {
+    // an exception must not leave a parallel region, so it is rethrown once all the branches are done
+    const auto branches = group.end - group.begin;
+    std::vector<std::exception_ptr> exceptions(branches);
+    auto executeBranch = [&](size_t i) {
+        try {
+            ExecuteNodeWithCatch(m_executableGraphNodes[group.begin + i], request, numaId);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+    // every branch runs its intra node parallel loops on its share of the threads
+#if OV_THREAD_USE_TBB
+    parallel_for(branches, [&](size_t i) {
+        group.arenas[i]->execute([&] {
+            executeBranch(i);
+        });
+    });
+#elif OV_THREAD == OV_THREAD_OMP
+    const auto originNestedLevels = parallel_get_max_nested_levels();
+    if (originNestedLevels < 2) {
+        parallel_set_max_nested_levels(2);
+    }
+#    pragma omp parallel for num_threads(static_cast<int>(branches)) schedule(static, 1)
+    for (int i = 0; i < static_cast<int>(branches); i++) {
+        omp_set_num_threads(group.threads[i]);
+        executeBranch(static_cast<size_t>(i));
+    }
+    if (originNestedLevels < 2) {
+        parallel_set_max_nested_levels(originNestedLevels);
+    }
+#else
+    for (size_t i = 0; i < branches; i++) {
+        executeBranch(i);
+    }
+#endif
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+std::vector<std::pair<size_t, size_t>> Graph::FindEfficientCoreSegments() const {
+    // These nodes stream memory with little arithmetic per byte, so they run about as fast on the efficient cores
+    static const std::unordered_set<Type> bandwidthBound = {Type::Reorder,
+                                                            Type::Eltwise,
+                                                            Type::Convert,
+                                                            Type::Transpose,
+                                                            Type::Concatenation,
+                                                            Type::Split,
+                                                            Type::Gather,
+                                                            Type::GatherND,
+                                                            Type::GatherElements,
+                                                            Type::Broadcast,
+                                                            Type::Tile,
+                                                            Type::Pad,
+                                                            Type::StridedSlice,
+                                                            Type::DepthToSpace,
+                                                            Type::SpaceToDepth,
+                                                            Type::ShuffleChannels,
+                                                            Type::Roll,
+                                                            Type::ScatterUpdate,
+                                                            Type::Reduce};
+    // Handing a segment over to the efficient cores and back costs a couple of thread wake-ups
+    constexpr size_t minSegmentBytes = 1 << 20;
+
+    std::vector<std::pair<size_t, size_t>> segments;
+    size_t begin = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        const auto& node = m_executableGraphNodes[i];
+        if (bandwidthBound.count(node->getType()) == 0) {
+            if (bytes >= minSegmentBytes) {
+                segments.emplace_back(begin, i);
+            }
+            begin = i + 1;
+            bytes = 0;
+            continue;
+        }
+        for (const auto& outConf : node->getSelectedPrimitiveDescriptor()->getConfig().outConfs) {
+            bytes += outConf.getMemDesc()->getCurrentMemSize();
+        }
+    }
+    if (bytes >= minSegmentBytes) {
+        segments.emplace_back(begin, m_executableGraphNodes.size());
+    }
+    return segments;
+}
+
+void Graph::InferHybrid(SyncInferRequest* request, int numaId) {
+    const auto& executor = m_context->getEfficientCoreExecutor();
+    const auto start = std::chrono::steady_clock::now();
+    auto segment = m_efficientCoreSegments.begin();
+    for (size_t i = 0; i < m_executableGraphNodes.size();) {
+        if (segment == m_efficientCoreSegments.end() || segment->first != i) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[i++], request, numaId);
+            continue;
+        }
+        // The stream thread just waits for the segment, leaving the performance cores to the other streams
+        const auto segmentStart = std::chrono::steady_clock::now();
+        executor->run_and_wait({[&, begin = segment->first, end = segment->second] {
+            for (size_t j = begin; j < end; j++) {
+                ExecuteNodeWithCatch(m_executableGraphNodes[j], request, numaId);
+            }
+        }});
+        m_efficientCoreTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                     segmentStart)
+                                   .count();
+        i = segment->second;
+        ++segment;
+    }
+    m_inferTime +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The nodes reading a weights matrix from memory on every execution
+static bool isWeightsHeavy(const NodePtr& node) {
+    return any_of(node->getType(), Type::FullyConnected, Type::LLMMLP, Type::QKVProjection);
+}
+
+void Graph::InitWeightsStreaming() {
+    m_weightsNodesInds.clear();
+    m_nextWeightsNode.clear();
+    m_weightsPrefetcher.reset();
+
+    const auto& config = getConfig();
+    // Concurrently executed nodes have no single "next" weights heavy node
+    if (config.weightsPrefetchDistance == 0 || !m_executableBranchGroups.empty() || !m_efficientCoreSegments.empty()) {
+        return;
+    }
+
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        if (isWeightsHeavy(m_executableGraphNodes[i])) {
+            m_weightsNodesInds.push_back(i);
+        }
+    }
+    if (m_weightsNodesInds.empty()) {
+        return;
+    }
+
+    m_nextWeightsNode.resize(m_executableGraphNodes.size());
+    size_t next = 0;
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        if (next < m_weightsNodesInds.size() && m_weightsNodesInds[next] < i) {
+            next++;
+        }
+        m_nextWeightsNode[i] = next;
+    }
+
+    // The streams share the last level cache and a half of their share is left to the activations
+    size_t cacheSize = dnnl::utils::get_cache_size(3, false);
+    if (cacheSize == 0) {
+        cacheSize = dnnl::utils::get_cache_size(2, false);
+    }
+    const auto streams = static_cast<size_t>(std::max(1, config.streamExecutorConfig.get_streams()));
+    const size_t budget = cacheSize / streams / 2;
+    if (budget > 0) {
+        m_weightsPrefetcher = std::make_unique<WeightsPrefetcher>(budget);
+    } else {
+        m_weightsNodesInds.clear();
+        m_nextWeightsNode.clear();
+    }
+}
+
+void Graph::ExecuteStreamingWeights(size_t idx, SyncInferRequest* request, int numaId) {
+    const auto isWeightsNode = [this](size_t i) {
+        const auto pos = m_nextWeightsNode[i];
+        return pos < m_weightsNodesInds.size() && m_weightsNodesInds[pos] == i;
+    };
+    const auto& node = m_executableGraphNodes[idx];
+    const auto next = m_nextWeightsNode[idx];
+
+    if (!isWeightsNode(idx)) {
+        // The first node after a weights heavy one starts streaming the weights of the next ones
+        if (next < m_weightsNodesInds.size() && (idx == 0 || isWeightsNode(idx - 1))) {
+            MemoryRegions regions;
+            const auto last =
+                std::min<size_t>(m_weightsNodesInds.size(), next + getConfig().weightsPrefetchDistance);
+            for (size_t w = next; w < last; w++) {
+                const auto nodeRegions = m_executableGraphNodes[m_weightsNodesInds[w]]->getWeightsRegions();
+                regions.insert(regions.end(), nodeRegions.begin(), nodeRegions.end());
+            }
+            m_weightsPrefetcher->submit(regions);
+        }
         ExecuteNodeWithCatch(node, request, numaId);
+        return;
+    }
+
+    // The node saturates the memory bandwidth itself, prefetching further weights would only compete with it
+    m_weightsPrefetcher->cancel();
+    ExecuteNodeWithCatch(node, request, numaId);
+}
+
+std::map<std::string, std::pair<uint64_t, uint64_t>> Graph::getWeightsStreamStats() const {
+    std::map<std::string, std::pair<uint64_t, uint64_t>> stats;
+    // Derived from the performance counters, so the inference itself is not timed for the statistics
+    if (!getConfig().collectPerfCounters) {
+        return stats;
+    }
+    for (const auto& node : m_executableGraphNodes) {
+        const auto& counter = node->PerfCounter();
+        if (!isWeightsHeavy(node) || counter.count() == 0) {
+            continue;
+        }
+        uint64_t bytes = 0;
+        for (const auto& region : node->getWeightsRegions()) {
+            bytes += region.second;
+        }
+        // the counters average the executions in microseconds
+        stats[node->getName()] = {bytes * counter.count(), counter.avg() * counter.count() * 1000};
+    }
+    return stats;
+}
+
+uint64_t Graph::getWeightsPrefetchRequestedBytes() const {
+    return m_weightsPrefetcher ? m_weightsPrefetcher->requestedBytes() : 0;
+}
+
+void Graph::InferStatic(SyncInferRequest* request, int numaId) {
+    if (!m_efficientCoreSegments.empty()) {
+        InferHybrid(request, numaId);
+        return;
+    }
+    if (!m_weightsNodesInds.empty()) {
+        for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+            ExecuteStreamingWeights(i, request, numaId);
+        }
+        return;
+    }
+    if (m_executableBranchGroups.empty()) {
+        for (const auto& node : m_executableGraphNodes) {
+            ExecuteNodeWithCatch(node, request, numaId);
+        }
+        return;
+    }
+
+    auto group = m_executableBranchGroups.begin();
+    for (size_t i = 0; i < m_executableGraphNodes.size();) {
+        if (group != m_executableBranchGroups.end() && group->begin == i) {
+            ExecuteBranchGroup(*group, request, numaId);
+            i = group->end;
+            ++group;
+        } else {
+            ExecuteNodeWithCatch(m_executableGraphNodes[i++], request, numaId);
+        }
     }
 }
 
@@ -1636,6 +2075,10 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
         std::forward<UpdateStrategy>(update)(stopIndx);
 
         for (; inferCounter < stopIndx; ++inferCounter) {
+            if (!m_weightsNodesInds.empty()) {
+                ExecuteStreamingWeights(inferCounter, request, numaId);
+                continue;
+            }
             auto& node = m_executableGraphNodes[inferCounter];
 
             ExecuteNodeWithCatch(node, request, numaId);
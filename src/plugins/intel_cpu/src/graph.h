@@ -6,11 +6,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
@@ -22,11 +24,13 @@
 #include "node.h"
 #include "nodes/input.h"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "proxy_mem_blk.h"
 #include "utils/general_utils.h"
+#include "weights_prefetcher.h"
 
 namespace ov::intel_cpu {
 
@@ -100,6 +104,18 @@ public:
 
     void Infer(SyncInferRequest* request = nullptr);
 
+    // Time spent on the inferences and on their efficient core segments since the graph creation, in nanoseconds
+    std::pair<uint64_t, uint64_t> getEfficientCoreTime() const {
+        return {m_inferTime, m_efficientCoreTime};
+    }
+
+    // Weights bytes streamed and nanoseconds spent by the weights heavy nodes since the graph creation, per node name.
+    // Empty unless the performance counters are enabled
+    std::map<std::string, std::pair<uint64_t, uint64_t>> getWeightsStreamStats() const;
+
+    // Weights bytes accepted for prefetch since the graph creation
+    uint64_t getWeightsPrefetchRequestedBytes() const;
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -297,6 +313,11 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_executableBranchGroups.clear();
+        m_efficientCoreSegments.clear();
+        m_weightsNodesInds.clear();
+        m_nextWeightsNode.clear();
+        m_weightsPrefetcher.reset();
     }
     Status status{Status::NotReady};
 
@@ -328,6 +349,9 @@ protected:
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
     std::vector<size_t> CreateExecutionGraph();
+    std::vector<std::vector<NodePtr>> OrderByBranchLevels();
+    std::vector<std::pair<size_t, size_t>> FindEfficientCoreSegments() const;
+    void InitWeightsStreaming();
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -349,6 +373,21 @@ protected:
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+
+    // nodes of the independent branches executed concurrently, see OrderByBranchLevels()
+    struct BranchGroup {
+        // [begin, end) range of m_executableGraphNodes
+        size_t begin;
+        size_t end;
+        // threads of every branch
+        std::vector<int> threads;
+#if OV_THREAD_USE_TBB
+        std::vector<std::shared_ptr<tbb::task_arena>> arenas;
+#endif
+    };
+    void ExecuteBranchGroup(const BranchGroup& group, SyncInferRequest* request, int numaId) const;
+    void InferHybrid(SyncInferRequest* request, int numaId);
+    void ExecuteStreamingWeights(size_t idx, SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -371,6 +410,16 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    std::vector<BranchGroup> m_executableBranchGroups;
+    // [begin, end) ranges of bandwidth bound m_executableGraphNodes executed on the efficient cores
+    std::vector<std::pair<size_t, size_t>> m_efficientCoreSegments;
+    uint64_t m_inferTime = 0;
+    uint64_t m_efficientCoreTime = 0;
+    // indices of the weights heavy m_executableGraphNodes, see InitWeightsStreaming()
+    std::vector<size_t> m_weightsNodesInds;
+    // position in m_weightsNodesInds of the first weights heavy node at or after every executable node
+    std::vector<size_t> m_nextWeightsNode;
+    std::unique_ptr<WeightsPrefetcher> m_weightsPrefetcher;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
@@ -8,6 +8,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
 
+#include "activation_arena.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
@@ -27,7 +28,9 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           ov::threading::IStreamsExecutor::Ptr efficientCoreExecutor,
+                           std::shared_ptr<ActivationArena> activationArena)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
       m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
@@ -36,10 +39,11 @@ GraphContext::GraphContext(Config config,
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
+      m_efficientCoreExecutor(std::move(efficientCoreExecutor)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
       m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
-      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
+      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main", std::move(activationArena))) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
         m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
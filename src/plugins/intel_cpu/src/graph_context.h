@@ -24,6 +24,7 @@ namespace node {
 class MemoryStatesRegister;
 }  // namespace node
 
+class ActivationArena;
 class MemoryControl;
 class NetworkMemoryControl;
 
@@ -37,7 +38,9 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 ov::threading::IStreamsExecutor::Ptr efficientCoreExecutor = nullptr,
+                 std::shared_ptr<ActivationArena> activationArena = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -73,6 +76,11 @@ public:
         return m_cpuStreamExecutor;
     }
 
+    // Executor of the bandwidth bound graph segments on the efficient cores of a hybrid CPU, if enabled
+    [[nodiscard]] const ov::threading::IStreamsExecutor::Ptr& getEfficientCoreExecutor() const {
+        return m_efficientCoreExecutor;
+    }
+
     [[nodiscard]] std::shared_ptr<CpuParallel> getCpuParallel() const {
         return m_cpuParallel;
     }
@@ -130,6 +138,8 @@ private:
     std::shared_ptr<CpuParallel> m_cpuParallel = nullptr;
     // numa submemory manager
     std::shared_ptr<SubMemoryManager> m_subMemoryManager;
+    // bandwidth bound segments executor on the efficient cores of a hybrid CPU
+    ov::threading::IStreamsExecutor::Ptr m_efficientCoreExecutor;
 
     int m_numNumaNodes = 1;
     int m_numaNodeId = 0;
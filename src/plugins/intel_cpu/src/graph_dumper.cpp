@@ -361,6 +361,19 @@ void summary_perf(const Graph& graph) {
               << '\n';
     std::cout << "     Total(us): " << total << '\n';
     std::cout << " Total_avg(us): " << static_cast<uint64_t>(total_avg) << '\n';
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        for (const auto& node : graph.GetNodes()) {
+            if (const auto cache = node->getShapeInferCache()) {
+                hits += cache->hits();
+                misses += cache->misses();
+            }
+        }
+        if (hits + misses > 0) {
+            std::cout << " ShapeInfer cache hits: " << hits << " / " << (hits + misses) << '\n';
+        }
+    }
     {
         std::cout << " perf_by_type:" << '\n';
         std::vector<std::pair<std::string, double>> A;
@@ -26,6 +26,7 @@
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include "cpu/x64/cpu_isa_traits.hpp"
+#    include "nodes/executors/x64/conv_inverted_residual.hpp"
 #    include "onednn/dnnl.h"
 #endif
 
@@ -53,6 +54,7 @@
 #include "nodes/transpose.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/op/constant.hpp"
@@ -165,6 +167,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     graph.SortTopologically();
     graph.RemoveDroppedEdges();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInvertedResidualConvolutions");
+    FuseInvertedResidualConvolutions(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndDWConvolution");
     FuseConvolutionAndDWConvolution(graph);
     graph.RemoveDroppedNodes();
@@ -1377,6 +1383,140 @@ void GraphOptimizer::FuseConvolutionAndDWConvolution(Graph& graph) {
 #endif
 }
 
+void GraphOptimizer::FuseInvertedResidualConvolutions(Graph& graph) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+    // 1x1 expand -> DW 3x3 -> 1x1 project is executed by the inverted residual executor band by band, so the expanded
+    // tensor is kept in L2 instead of being streamed through the memory twice. Applied only when requested explicitly
+    if (!graph.getConfig().enableInvertedResidualFusion || !impl::cpu::x64::mayiuse(impl::cpu::x64::avx2)) {
+        return;
+    }
+
+    const auto& graphNodes = graph.GetNodes();
+    size_t threads = graph.getConfig().streamExecutorConfig.get_threads_per_stream();
+    if (threads == 0) {
+        threads = parallel_get_max_threads();
+    }
+
+    auto isConvolutionNode = [](const NodePtr& node) {
+        return node->getType() == Type::Convolution;
+    };
+
+    auto lastOutputPrecision = [](const NodePtr& node) {
+        return node->getFusedWith().empty() ? node->getOriginalOutputPrecisionAtPort(0)
+                                            : node->getFusedWith().back()->getOriginalOutputPrecisionAtPort(0);
+    };
+
+    // the precision of the whole block is the same, the fused operations are the simple eltwise ones
+    auto isSuitableConvolution = [&](const NodePtr& node, ov::element::Type precision) {
+        if (node->isDropped() || node->isDynamicNode() || node->getOutputShapeAtPort(0).getRank() != 4) {
+            return false;
+        }
+        const auto conv = std::dynamic_pointer_cast<Convolution>(node);
+        OPENVINO_ASSERT(conv, "Cannot cast to convolution node ", node->getName());
+        if (conv->canBeExecutedInInt8() || !conv->legacyInputZeroPoints.empty() ||
+            !conv->legacyWeightsZeroPoints.empty()) {
+            return false;
+        }
+        const bool simpleFusedOps = std::all_of(node->getFusedWith().begin(),
+                                                node->getFusedWith().end(),
+                                                [](const NodePtr& fused) {
+                                                    return fused->getType() == Type::Eltwise;
+                                                });
+        return simpleFusedOps && all_of(precision,
+                                        conv->getOriginalInputPrecisionAtPort(0),
+                                        conv->getOriginalOutputPrecisionAtPort(0),
+                                        lastOutputPrecision(node));
+    };
+
+    auto isPointwise = [](const std::shared_ptr<Convolution>& conv) {
+        const auto& weightDims = conv->getWeightDims();
+        const auto rank = weightDims.size();
+        return conv->getGroupNum() == 1 && all_of(1U, weightDims[rank - 1], weightDims[rank - 2]) &&
+               all_of_values(conv->getStride(), 1U) && all_of_values(conv->getPaddingL(), 0) &&
+               all_of_values(conv->getPaddingR(), 0);
+    };
+
+    auto isDepthwise3x3 = [](const std::shared_ptr<Convolution>& conv) {
+        const auto& weightDims = conv->getWeightDims();
+        const auto rank = weightDims.size();
+        const auto& strides = conv->getStride();
+        const auto& dilation = conv->getDilation();
+        const auto& paddingL = conv->getPaddingL();
+        const auto& paddingR = conv->getPaddingR();
+        return conv->isDepthWise() && all_of(3U, weightDims[rank - 1], weightDims[rank - 2]) &&
+               all_of(0U, dilation[0], dilation[1]) && all_of(1, paddingL[0], paddingL[1], paddingR[0], paddingR[1]) &&
+               strides[0] == strides[1] && any_of(strides[0], 1U, 2U);
+    };
+
+    auto withBias = [](const NodePtr& node) {
+        return node->getOriginalInputPrecisions().size() == 3;
+    };
+
+    auto singleConvolutionChild = [&](const NodePtr& node) -> NodePtr {
+        if (node->getChildEdges().size() != 1 || !isConvolutionNode(node->getChildEdgeAt(0)->getChild())) {
+            return nullptr;
+        }
+        return node->getChildEdgeAt(0)->getChild();
+    };
+
+    for (const auto& graphNode : graphNodes) {
+        if (!isConvolutionNode(graphNode)) {
+            continue;
+        }
+
+        const auto precision = graphNode->getOriginalInputPrecisionAtPort(0);
+        if (none_of(precision, ov::element::f32, ov::element::bf16) || !isSuitableConvolution(graphNode, precision)) {
+            continue;
+        }
+
+        const auto expand = std::dynamic_pointer_cast<Convolution>(graphNode);
+        if (!isPointwise(expand)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseInvertedResidualConvolutions_Expand);
+
+        const auto dwNode = singleConvolutionChild(graphNode);
+        if (!dwNode || !isSuitableConvolution(dwNode, precision) || !withBias(dwNode)) {
+            continue;
+        }
+        const auto dw = std::dynamic_pointer_cast<Convolution>(dwNode);
+        if (!isDepthwise3x3(dw)) {
+            continue;
+        }
+
+        const auto projectNode = singleConvolutionChild(dwNode);
+        if (!projectNode || !isSuitableConvolution(projectNode, precision) || !withBias(projectNode)) {
+            continue;
+        }
+        const auto project = std::dynamic_pointer_cast<Convolution>(projectNode);
+        if (!isPointwise(project)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseInvertedResidualConvolutions_Block);
+
+        // the expanded tensor split between the threads of the stream within the band budgets of their L2 is not
+        // streamed through the memory anyway
+        const auto& expandedDims = dwNode->getInputShapeAtPort(0).getStaticDims();
+        const size_t expandedSize =
+            std::accumulate(expandedDims.begin(), expandedDims.end(), precision.size(), std::multiplies<>());
+        if (expandedSize <= ConvInvertedResidualExecutor::bandBudget() * threads) {
+            continue;
+        }
+
+        for (const auto& node : {dwNode, projectNode}) {
+            graphNode->addFusedNode(node);
+            for (const auto& fused : node->getFusedWith()) {
+                graphNode->addFusedNode(fused);
+            }
+            node->clearFusedWith();
+            graph.DropDWConvNode(node);
+        }
+    }
+#endif
+}
+
 // TODO [NM]: unite with FuseConvolutionAndSimpleOperation
 void GraphOptimizer::FuseConvolutionAndSimpleOperationThroughMaxPool(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
@@ -1795,8 +1935,8 @@ void GraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(Graph& graph)
 
         if (!mergedConv->fusedWith.empty() &&
             (any_of(mergedConv->fusedWith[0]->getType(), Type::Convolution, Type::BinaryConvolution))) {
-            // Merged with DW_conv. Shape may change
-            mergedConv->inputShapes.push_back(mergedConv->fusedWith[0]->getOutputShapeAtPort(0));
+            // Merged with DW_conv (and the following 1x1 conv). Shape may change
+            mergedConv->inputShapes.push_back(mergedConv->getOutputShapeAtPort(0));
         } else {
             size_t secondTermPort = sum->getFusingPort() == 0 ? 1 : 0;
             mergedConv->inputShapes.push_back(sum->getInputShapeAtPort(secondTermPort));
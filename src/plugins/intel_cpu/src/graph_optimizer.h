@@ -33,6 +33,7 @@ private:
     static void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph& graph);
     static void FuseConvolutionAndSimpleOperation(Graph& graph);
     static void FuseConvolutionAndDWConvolution(Graph& graph);
+    static void FuseInvertedResidualConvolutions(Graph& graph);
     static void FusePoolingAndFakeQuantize(Graph& graph);
     static void FuseConvolutionSumAndConvolutionSumActivation(Graph& graph);
     static void FuseMVNAndSimpleOperation(Graph& graph);
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -80,4 +81,175 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Define whether independent branches of a static graph may be executed concurrently
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_branch_parallelism{"ENABLE_BRANCH_PARALLELISM"};
+
+/**
+ * @brief Maximum number of concurrent single sample requests of a THROUGHPUT compiled model which may be coalesced into
+ * one batched execution. 0 or 1 disables micro-batching.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batch_size{"MICRO_BATCH_SIZE"};
+
+/**
+ * @brief Time in microseconds the first pending request waits for other requests to form a micro-batch
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batch_timeout{"MICRO_BATCH_TIMEOUT"};
+
+/**
+ * @brief Mode the asynchronous requests of a micro-batched compiled model are currently executed in: "DIRECT" or
+ * "BATCHED". "DISABLED" if the micro-batching is off or the model is not eligible
+ */
+static constexpr Property<std::string, PropertyMutability::RO> micro_batching_mode{"MICRO_BATCHING_MODE"};
+
+/**
+ * @brief Number of the requests of a micro-batched compiled model executed together with at least one other request
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> micro_batched_requests{"MICRO_BATCHED_REQUESTS"};
+
+/**
+ * @brief Define whether a multi-stream compiled model may switch at runtime between its streams and a single stream
+ * spanning all their threads, depending on the number of inferences in flight
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_adaptive_streams{"ENABLE_ADAPTIVE_STREAMS"};
+
+/**
+ * @brief Number of streams the requests of an adaptive streams compiled model are currently executed by
+ */
+static constexpr Property<int32_t, PropertyMutability::RO> adaptive_streams_active{"ADAPTIVE_STREAMS_ACTIVE"};
+
+/**
+ * @brief Number of switches between the stream partitions an adaptive streams compiled model has made so far
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> adaptive_streams_switches{"ADAPTIVE_STREAMS_SWITCHES"};
+
+/**
+ * @brief Define whether the bandwidth bound node segments of static graphs are executed on the efficient cores of a
+ * hybrid CPU, leaving the performance cores to the other streams
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_hybrid_node_placement{"ENABLE_HYBRID_NODE_PLACEMENT"};
+
+/**
+ * @brief Share of the inference time spent on the efficient cores by the hybrid node placement
+ */
+static constexpr Property<float, PropertyMutability::RO> efficient_core_time_share{"EFFICIENT_CORE_TIME_SHARE"};
+
+/**
+ * @brief Number of the upcoming FullyConnected, LLMMLP and QKVProjection nodes whose weights are prefetched by a helper
+ * thread while the other nodes of the graph run. The prefetched volume is limited to a half of the last level cache.
+ * 0 (default) disables the prefetch
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> weights_prefetch_distance{"WEIGHTS_PREFETCH_DISTANCE"};
+
+/**
+ * @brief Define whether fp32 3x3 stride 1 convolutions with large spatial sizes and enough channels may be executed
+ * with Winograd F(4x4, 3x3). The algorithm loses a few bits of accuracy, so it's never used in the ACCURACY execution
+ * mode
+ * @param true - enable (default)
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_winograd_convolution{"ENABLE_WINOGRAD_CONVOLUTION"};
+
+/**
+ * @brief Define whether fp32 FullyConnected nodes with 2:4 structured or block sparse constant weights may be executed
+ * with the sparse JIT kernels on AVX2 / AVX-512 platforms. The sparse kernels are selected automatically for the
+ * weights bandwidth bound shapes (up to 32 rows of activations) only
+ * @param true - enable (default)
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_structured_sparse_fc{"ENABLE_STRUCTURED_SPARSE_FC"};
+
+/**
+ * @brief Define whether the NV12 / I420 decoding, resize and normalization produced by PrePostProcessor are fused into
+ * a single YuvPreprocess node with f32, bf16 or u8 output
+ * @param true - enable
+ * @param false - disable (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_yuv_preprocess_fusion{"ENABLE_YUV_PREPROCESS_FUSION"};
+
+/**
+ * @brief Define whether the 1x1 expand, 3x3 depthwise and 1x1 project convolutions of an inverted residual block are
+ * fused into a single Convolution node executed by bands of rows (AVX2 and higher)
+ * @param true - enable
+ * @param false - disable (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_inverted_residual_fusion{
+    "ENABLE_INVERTED_RESIDUAL_FUSION"};
+
+/**
+ * @brief Bandwidth in GB/s achieved by the weights heavy nodes streaming their weights, per node name. Derived from
+ * the performance counters, so empty unless ov::enable_profiling is set
+ */
+static constexpr Property<std::map<std::string, float>, PropertyMutability::RO> weights_bandwidth{"WEIGHTS_BANDWIDTH"};
+
+/**
+ * @brief Bytes of weights accepted for prefetch by all the streams, see ov::intel_cpu::weights_prefetch_distance
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> weights_prefetch_requested_bytes{
+    "WEIGHTS_PREFETCH_REQUESTED_BYTES"};
+
+/**
+ * @brief Define whether the Brgemm block sizes of static snippets subgraphs are chosen by benchmarking a small set of
+ * candidates instead of the blocking heuristic. The chosen block sizes are persisted in `ov::cache_dir`, if set, and
+ * reused by the later compilations of the same subgraph and shapes
+ * @param true - enable
+ * @param false - disable
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_brgemm_blocking_tuning{
+    "SNIPPETS_BRGEMM_BLOCKING_TUNING"};
+
+/**
+ * @brief Name of the group of compiled models sharing one activation arena per stream. The models of a group solve
+ * their memory reuse independently, but their intermediate tensors are placed in one buffer per stream sized to the
+ * largest of them, so the inferences of the group are serialized per stream. Empty string (default) disables sharing
+ */
+static constexpr Property<std::string, PropertyMutability::RW> activation_arena_group{"ACTIVATION_ARENA_GROUP"};
+
+/**
+ * @brief Size in bytes of the largest activation arena the compiled model shares with its group, 0 if it's not grouped
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> activation_arena_size{"ACTIVATION_ARENA_SIZE"};
+
+/**
+ * @brief Statistics of the JIT kernels of one type generated by the CPU plugin in the process
+ */
+struct JitKernelsStats {
+    uint64_t kernels = 0;          //!< number of generated kernels
+    uint64_t code_bytes = 0;       //!< size of the generated code
+    uint64_t codegen_time_us = 0;  //!< time spent generating the code
+    uint64_t deduplicated = 0;     //!< number of kernels replaced by a live kernel with the same code
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const JitKernelsStats& stats) {
+    return os << stats.kernels << " " << stats.code_bytes << " " << stats.codegen_time_us << " "
+              << stats.deduplicated;
+}
+
+inline std::istream& operator>>(std::istream& is, JitKernelsStats& stats) {
+    return is >> stats.kernels >> stats.code_bytes >> stats.codegen_time_us >> stats.deduplicated;
+}
+/** @endcond */
+
+/**
+ * @brief Statistics of the JIT kernels generated by the CPU plugin in the process, per kernel type. The kernels of
+ * oneDNN primitives are not accounted, except the brgemm kernels created by the plugin
+ */
+static constexpr Property<std::map<std::string, JitKernelsStats>, PropertyMutability::RO> jit_kernels_stats{
+    "JIT_KERNELS_STATS"};
+
+/**
+ * @brief Code size in bytes of the deduplicated JIT kernels kept alive by the CPU plugin after their last user is
+ * destroyed, so the models compiled later reuse them. The least recently used kernels are evicted first. The cache is
+ * process wide and is configured on the plugin. 0 (default) keeps no kernel, only the live kernels are shared
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> jit_kernels_cache_capacity{"JIT_KERNELS_CACHE_CAPACITY"};
+
 }  // namespace ov::intel_cpu
@@ -20,6 +20,7 @@
 #    include <unordered_set>
 #endif
 
+#include "activation_arena.h"
 #include "cpu_memory.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
@@ -207,6 +208,12 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(ActivationArena::Ptr arena = nullptr) : m_arena(std::move(arena)) {}
+
+    ~MemoryManagerStatic() override {
+        releaseArena();
+    }
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -232,11 +239,18 @@ private:
         ov::MemorySolver staticMemSolver(boxes_to_process);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        MemoryBlockPtr workspace;
+        if (m_arena) {
+            // the solution is placed at the beginning of the arena shared with the other graphs of the group
+            workspace = m_arena->block();
+        } else {
+            m_workspace = std::make_shared<MemoryBlockWithRelease>();
+            workspace = m_workspace;
+        }
 
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
-            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
+            auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
@@ -245,11 +259,23 @@ private:
         if (m_workspace) {
             m_workspace->resize(m_totalSize);
         }
+        if (m_arena && m_totalSize > 0 && !m_arenaAcquired) {
+            m_arena->acquire(m_totalSize);
+            m_arenaAcquired = true;
+        }
     }
     void release() override {
         if (m_workspace) {
             m_workspace->free();
         }
+        releaseArena();
+    }
+
+    void releaseArena() {
+        if (m_arenaAcquired) {
+            m_arena->release();
+            m_arenaAcquired = false;
+        }
     }
 
     static const char* getClassName() {
@@ -259,6 +285,8 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    ActivationArena::Ptr m_arena;
+    bool m_arenaAcquired = false;
     size_t m_totalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
@@ -525,12 +553,14 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, ActivationArena::Ptr arena) : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        std::move(arena)));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -597,8 +627,8 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 }
 #endif  // CPU_DEBUG_CAPS
 
-MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id, ActivationArena::Ptr arena) {
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), std::move(arena))));
     return m_controlUnits.back();
 }
 
@@ -12,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "activation_arena.h"
 #include "cpu_memory.h"
 #include "edge.h"
 
@@ -67,7 +68,7 @@ public:
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    explicit MemoryControl(std::string id, ActivationArena::Ptr arena = nullptr);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -81,7 +82,8 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
-    MemoryControl::Ptr createMemoryControlUnit(std::string id);
+    // The static intermediate tensors of the unit are placed in the arena, if provided
+    MemoryControl::Ptr createMemoryControlUnit(std::string id, ActivationArena::Ptr arena = nullptr);
 
     void allocateMemory();
     void releaseMemory();
@@ -0,0 +1,298 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "micro_batcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+namespace {
+
+// Number of full batches a measurement window of a mode lasts
+constexpr size_t window_batches = 32;
+// Number of windows the faster mode is kept before both modes are measured again
+constexpr size_t exploit_windows = 16;
+
+// The view of the samples [begin, end) of the batched tensor
+std::shared_ptr<ov::ITensor> samples(const ov::SoPtr<ov::ITensor>& tensor, size_t begin, size_t end) {
+    const auto& shape = tensor->get_shape();
+    ov::Coordinate first(shape.size(), 0);
+    ov::Coordinate last(shape.begin(), shape.end());
+    first[0] = begin;
+    last[0] = end;
+    return ov::make_tensor(tensor._ptr, first, last);
+}
+
+}  // namespace
+
+MicroBatcher::MicroBatcher(std::shared_ptr<ov::ICompiledModel> batched_model,
+                           size_t max_batch,
+                           std::chrono::microseconds timeout)
+    : m_batched_model(std::move(batched_model)),
+      m_max_batch(max_batch),
+      m_timeout(timeout),
+      m_window_start(std::chrono::steady_clock::now()) {
+    OPENVINO_ASSERT(m_max_batch > 1, "Micro-batching requires the batch size to be greater than 1");
+    m_collector = std::thread([this] {
+        collect();
+    });
+}
+
+MicroBatcher::~MicroBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_collector.join();
+    // the completion callbacks of the batches in flight still use the batcher
+    for (auto& slot : m_slots) {
+        try {
+            slot->request->wait();
+        } catch (...) {
+        }
+    }
+}
+
+std::shared_ptr<ov::Model> MicroBatcher::make_batched_model(const std::shared_ptr<const ov::Model>& model,
+                                                            size_t max_batch) {
+    if (!model->get_variables().empty()) {
+        return nullptr;
+    }
+    const auto single_sample = [](const ov::Output<const ov::Node>& port) {
+        const auto& shape = port.get_partial_shape();
+        return shape.is_static() && shape.size() > 0 && shape[0] == 1 && port.get_element_type() != ov::element::string;
+    };
+    if (!std::all_of(model->inputs().begin(), model->inputs().end(), single_sample) ||
+        !std::all_of(model->outputs().begin(), model->outputs().end(), single_sample)) {
+        return nullptr;
+    }
+
+    const ov::Dimension batch(1, static_cast<int64_t>(max_batch));
+    auto batched = model->clone();
+    std::map<ov::Output<ov::Node>, ov::PartialShape> shapes;
+    for (const auto& input : batched->inputs()) {
+        auto shape = input.get_partial_shape();
+        shape[0] = batch;
+        shapes[input] = shape;
+    }
+    try {
+        batched->reshape(shapes);
+    } catch (const ov::Exception&) {
+        return nullptr;
+    }
+
+    // Any output mixing the samples, e.g. a reduction or a reshape over the batch, can't be split back
+    for (size_t i = 0; i < batched->outputs().size(); i++) {
+        auto expected = model->output(i).get_partial_shape();
+        expected[0] = batch;
+        if (batched->output(i).get_partial_shape() != expected) {
+            return nullptr;
+        }
+    }
+    return batched;
+}
+
+void MicroBatcher::submit(ov::ISyncInferRequest& request, ov::threading::Task resume, std::exception_ptr& error) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_queue.empty()) {
+            m_deadline = std::chrono::steady_clock::now() + m_timeout;
+        }
+        m_queue.push_back({&request, std::move(resume), &error});
+    }
+    m_cv.notify_one();
+}
+
+void MicroBatcher::collect() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [&] {
+            return m_stop || !m_queue.empty();
+        });
+        if (m_queue.empty()) {
+            return;
+        }
+        m_cv.wait_until(lock, m_deadline, [&] {
+            return m_stop || m_queue.size() >= m_max_batch;
+        });
+
+        const auto size = static_cast<std::ptrdiff_t>(std::min(m_queue.size(), m_max_batch));
+        std::vector<Pending> batch(std::make_move_iterator(m_queue.begin()),
+                                   std::make_move_iterator(m_queue.begin() + size));
+        m_queue.erase(m_queue.begin(), m_queue.begin() + size);
+        if (!m_queue.empty()) {
+            m_deadline = std::chrono::steady_clock::now() + m_timeout;
+        }
+
+        lock.unlock();
+        execute(std::move(batch));
+        lock.lock();
+    }
+}
+
+MicroBatcher::Slot* MicroBatcher::acquire() {
+    std::lock_guard<std::mutex> lock(m_slots_mutex);
+    if (m_idle.empty()) {
+        auto slot = std::make_unique<Slot>();
+        slot->request = m_batched_model->create_infer_request();
+        m_idle.push_back(slot.get());
+        m_slots.push_back(std::move(slot));
+    }
+    auto* slot = m_idle.back();
+    m_idle.pop_back();
+    return slot;
+}
+
+void MicroBatcher::release(Slot* slot) {
+    std::lock_guard<std::mutex> lock(m_slots_mutex);
+    m_idle.push_back(slot);
+}
+
+void MicroBatcher::execute(std::vector<Pending> batch) {
+    Slot* slot = nullptr;
+    try {
+        slot = acquire();
+        slot->batch = std::move(batch);
+        const size_t size = slot->batch.size();
+        const auto& inputs = m_batched_model->inputs();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto tensor = slot->request->get_tensor(inputs[i]);
+            const auto& request = *slot->batch.front().request;
+            auto shape = request.get_tensor(request.get_inputs()[i])->get_shape();
+            shape[0] = size;
+            tensor->set_shape(shape);
+            for (size_t s = 0; s < size; s++) {
+                const auto& sample = *slot->batch[s].request;
+                sample.get_tensor(sample.get_inputs()[i])->copy_to(samples(tensor, s, s + 1));
+            }
+        }
+    } catch (...) {
+        if (slot == nullptr) {
+            for (auto& pending : batch) {
+                *pending.error = std::current_exception();
+                pending.resume();
+            }
+        } else {
+            complete(*slot, std::current_exception());
+        }
+        return;
+    }
+
+    slot->request->set_callback([this, slot](const std::exception_ptr& error) {
+        complete(*slot, error);
+    });
+    try {
+        slot->request->start_async();
+    } catch (...) {
+        complete(*slot, std::current_exception());
+    }
+}
+
+void MicroBatcher::complete(Slot& slot, const std::exception_ptr& error) {
+    auto batch = std::move(slot.batch);
+    std::exception_ptr status = error;
+    if (!status) {
+        try {
+            const auto& outputs = m_batched_model->outputs();
+            for (size_t o = 0; o < outputs.size(); o++) {
+                const auto tensor = slot.request->get_tensor(outputs[o]);
+                for (size_t s = 0; s < batch.size(); s++) {
+                    const auto& sample = *batch[s].request;
+                    samples(tensor, s, s + 1)->copy_to(sample.get_tensor(sample.get_outputs()[o])._ptr);
+                }
+            }
+        } catch (...) {
+            status = std::current_exception();
+        }
+    }
+    release(&slot);
+
+    if (!status && batch.size() > 1) {
+        m_batched_requests.fetch_add(batch.size(), std::memory_order_relaxed);
+    }
+    record(Mode::Batched, batch.size());
+    for (auto& pending : batch) {
+        *pending.error = status;
+        pending.resume();
+    }
+}
+
+void MicroBatcher::record(Mode mode, size_t samples) {
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    // completions of the requests started before the last switch do not belong to the window
+    if (mode != m_mode.load(std::memory_order_relaxed)) {
+        return;
+    }
+    m_window_samples += samples;
+    if (m_window_samples < window_batches * m_max_batch) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(now - m_window_start).count();
+    m_rate[static_cast<size_t>(mode)] = static_cast<double>(m_window_samples) / std::max(seconds, 1e-9);
+    m_window_samples = 0;
+    m_window_start = now;
+
+    const auto other = mode == Mode::Direct ? Mode::Batched : Mode::Direct;
+    if (m_exploit_windows > 0) {
+        // the current mode has just been measured, so only the other one needs a probe
+        if (--m_exploit_windows == 0) {
+            m_probed = 1;
+            m_mode.store(other, std::memory_order_relaxed);
+        }
+        return;
+    }
+    if (++m_probed < 2) {
+        m_mode.store(other, std::memory_order_relaxed);
+        return;
+    }
+    m_probed = 0;
+    m_exploit_windows = exploit_windows;
+    const auto best = m_rate[static_cast<size_t>(Mode::Batched)] > m_rate[static_cast<size_t>(Mode::Direct)]
+                          ? Mode::Batched
+                          : Mode::Direct;
+    m_mode.store(best, std::memory_order_relaxed);
+}
+
+void MicroBatchExecutor::run(ov::threading::Task task) {
+    m_error = nullptr;
+    m_batched = m_batcher->mode() == MicroBatcher::Mode::Batched;
+    if (m_batched) {
+        m_batcher->submit(m_request, std::move(task), m_error);
+        return;
+    }
+    // the request may be released by the time the pipeline task returns
+    m_direct_executor->run([batcher = m_batcher, task = std::move(task)] {
+        task();
+        batcher->record(MicroBatcher::Mode::Direct, 1);
+    });
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Coalesces concurrent single sample requests of a THROUGHPUT compiled model into executions of a model compiled
+ * with the batch dimension [1, max_batch]. The requests arrived within the timeout of the oldest pending one form a
+ * batch, the batch outputs are scattered back to the requests and their pipelines are resumed.
+ * Neither mode is better for every model and machine, so the batcher alternately measures samples per second of the
+ * direct (stream per request) and the batched execution and keeps the faster one until the next probe.
+ */
+class MicroBatcher {
+public:
+    enum class Mode : uint8_t { Direct = 0, Batched = 1 };
+
+    MicroBatcher(std::shared_ptr<ov::ICompiledModel> batched_model,
+                 size_t max_batch,
+                 std::chrono::microseconds timeout);
+    ~MicroBatcher();
+
+    MicroBatcher(const MicroBatcher&) = delete;
+    MicroBatcher& operator=(const MicroBatcher&) = delete;
+
+    /**
+     * Returns a copy of the model with the batch dimension of every input and output relaxed to [1, max_batch] or
+     * nullptr if the model does not process the samples independently along the outermost dimension.
+     */
+    static std::shared_ptr<ov::Model> make_batched_model(const std::shared_ptr<const ov::Model>& model,
+                                                         size_t max_batch);
+
+    Mode mode() const {
+        return m_mode.load(std::memory_order_relaxed);
+    }
+
+    // Number of the requests executed together with at least one other request
+    uint64_t batched_requests() const {
+        return m_batched_requests.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Queues the request for the batched execution. The outputs of the request are filled before `resume` is called,
+     * `error` is set if the batch failed.
+     */
+    void submit(ov::ISyncInferRequest& request, ov::threading::Task resume, std::exception_ptr& error);
+
+    // Accounts the completed samples of the given mode and switches the mode once the measurement window is over
+    void record(Mode mode, size_t samples);
+
+private:
+    struct Pending {
+        ov::ISyncInferRequest* request;
+        ov::threading::Task resume;
+        std::exception_ptr* error;
+    };
+
+    struct Slot {
+        std::shared_ptr<ov::IAsyncInferRequest> request;
+        std::vector<Pending> batch;
+    };
+
+    void collect();
+    void execute(std::vector<Pending> batch);
+    void complete(Slot& slot, const std::exception_ptr& error);
+    Slot* acquire();
+    void release(Slot* slot);
+
+    std::shared_ptr<ov::ICompiledModel> m_batched_model;
+    const size_t m_max_batch;
+    const std::chrono::microseconds m_timeout;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Pending> m_queue;
+    std::chrono::steady_clock::time_point m_deadline;
+    bool m_stop = false;
+    std::thread m_collector;
+
+    std::mutex m_slots_mutex;
+    std::vector<std::unique_ptr<Slot>> m_slots;
+    std::vector<Slot*> m_idle;
+
+    std::mutex m_stats_mutex;
+    std::atomic<Mode> m_mode{Mode::Batched};
+    std::atomic<uint64_t> m_batched_requests{0};
+    std::chrono::steady_clock::time_point m_window_start;
+    size_t m_window_samples = 0;
+    size_t m_probed = 0;
+    size_t m_exploit_windows = 0;
+    std::array<double, 2> m_rate{};
+};
+
+/**
+ * The first stage executor of an async infer request of a micro-batched compiled model. Routes every inference either
+ * to the streams executor or to the micro-batcher according to its current mode.
+ */
+class MicroBatchExecutor : public ov::threading::ITaskExecutor {
+public:
+    MicroBatchExecutor(std::shared_ptr<MicroBatcher> batcher,
+                       std::shared_ptr<ov::threading::ITaskExecutor> direct_executor,
+                       ov::ISyncInferRequest& request)
+        : m_batcher(std::move(batcher)),
+          m_direct_executor(std::move(direct_executor)),
+          m_request(request) {}
+
+    void run(ov::threading::Task task) override;
+
+    // Whether the current inference has been executed as a part of a batch
+    bool batched() const {
+        return m_batched;
+    }
+
+    void rethrow_if_failed() const {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    std::shared_ptr<MicroBatcher> m_batcher;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_direct_executor;
+    ov::ISyncInferRequest& m_request;
+    bool m_batched = false;
+    std::exception_ptr m_error;
+};
+
+}  // namespace ov::intel_cpu
@@ -47,6 +47,7 @@
 #include "openvino/util/pp.hpp"
 #include "partitioned_mem_blk.h"
 #include "selective_build.h"
+#include "shape_inference/shape_inference_cache.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "shape_inference/shape_inference_status.hpp"
 #include "transformations/rt_info/disable_precision_conversion.hpp"
@@ -793,6 +794,18 @@ void Node::updateShapes() {
     }
 }
 
+void Node::enableShapeInferCache(size_t capacity) {
+    if (!shapeInference || capacity == 0 || shapeInference->get_port_mask() != EMPTY_PORT_MASK ||
+        getShapeInferCache()) {
+        return;
+    }
+    shapeInference = std::make_shared<ShapeInferCached>(shapeInference, capacity);
+}
+
+std::shared_ptr<const ShapeInferCached> Node::getShapeInferCache() const {
+    return std::dynamic_pointer_cast<const ShapeInferCached>(shapeInference);
+}
+
 void Node::updateDynamicParams() {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateDynamicParams() is called to a static shape node of type: ",
@@ -41,6 +41,7 @@
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "perf_count.h"
+#include "shape_inference/shape_inference_cache.hpp"
 #include "utils/bit_util.hpp"
 #include "utils/debug_capabilities.h"
 
@@ -340,6 +341,11 @@ public:
         return !hasEmptyInputTensors();
     }
 
+    // the weights the node streams from memory on every execution, see Graph::ExecuteStreamingWeights()
+    virtual MemoryRegions getWeightsRegions() const {
+        return {};
+    }
+
     enum class ConstantType : uint8_t {
         Const,          // Node is placed in a constant subgraph
         NoConst,        // Node is placed in a non-constant subgraph
@@ -492,6 +498,12 @@ public:
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
     void updateShapes();
     void updateDynamicParams();
+    /**
+     * @brief Memoizes the shape inference results of recurring input shapes, if the node shape inference does not
+     * depend on the input data.
+     */
+    void enableShapeInferCache(size_t capacity);
+    [[nodiscard]] std::shared_ptr<const ShapeInferCached> getShapeInferCache() const;
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
     void redefineOutputMemory(size_t port, const VectorDims& new_output_shape) const;
@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Score-ordered candidate list of the per-class NMS loops.
+ *
+ * The list is meant to be reused between the classes processed by the same thread, so the storage is allocated once
+ * per thread instead of once per class. Candidates are sorted lazily in blocks: greedy NMS usually stops after the
+ * first few candidates, so most of the list is never ordered.
+ */
+class NmsCandidates {
+public:
+    using Candidate = std::pair<float, int>;  // score, box index
+
+    /**
+     * @brief Collects boxes which score passes the threshold (`>= threshold` if Inclusive, `> threshold` otherwise).
+     * @return number of collected candidates
+     */
+    template <bool Inclusive>
+    size_t filter(const float* scores, size_t count, float threshold) {
+        if (m_storage.size() < count) {
+            m_storage.resize(count);
+        }
+        // Branchless compaction: the candidate is always written and the end is advanced by the comparison result,
+        // which lets the compiler vectorize the loop.
+        size_t size = 0;
+        for (size_t i = 0; i < count; i++) {
+            const float score = scores[i];
+            m_storage[size] = {score, static_cast<int>(i)};
+            size += static_cast<size_t>(Inclusive ? score >= threshold : score > threshold);
+        }
+        m_size = size;
+        m_sorted = 0;
+        return m_size;
+    }
+
+    /**
+     * @brief Returns the candidate at the given position of the list ordered by score desc, box index asc.
+     */
+    const Candidate& get(size_t idx) {
+        if (idx >= m_sorted) {
+            sort_until(idx + 1);
+        }
+        return m_storage[idx];
+    }
+
+    /**
+     * @brief Orders the first `count` candidates, the rest of the list stays unordered.
+     */
+    void sort_until(size_t count) {
+        count = std::min(count, m_size);
+        if (count <= m_sorted) {
+            return;
+        }
+        const size_t block = std::max(min_sort_block, m_sorted);
+        const size_t end = std::min(m_size, std::max(count, m_sorted + block));
+        std::partial_sort(m_storage.begin() + m_sorted,
+                          m_storage.begin() + end,
+                          m_storage.begin() + m_size,
+                          [](const Candidate& l, const Candidate& r) {
+                              return l.first > r.first || (l.first == r.first && l.second < r.second);
+                          });
+        m_sorted = end;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+private:
+    // The sorted prefix grows at least by this number of candidates and doubles afterwards.
+    static constexpr size_t min_sort_block = 64;
+
+    std::vector<Candidate> m_storage;
+    size_t m_size = 0;
+    size_t m_sorted = 0;
+};
+
+/**
+ * @brief Structure-of-arrays storage of the boxes selected by the per-class NMS loop.
+ *
+ * The boxes are stored in corner format (ymin, xmin, ymax, xmax) together with their areas, so the candidate is
+ * checked against a block of selected boxes by a branchless loop which the compiler vectorizes.
+ * `norm` is added to the box sides, it is 1 for the not normalized boxes of MulticlassNms and 0 otherwise.
+ */
+class NmsSelectedBoxes {
+public:
+    void reset(size_t capacity, float norm = 0.F) {
+        for (auto& coord : m_coords) {
+            if (coord.size() < capacity) {
+                coord.resize(capacity);
+            }
+        }
+        if (m_areas.size() < capacity) {
+            m_areas.resize(capacity);
+        }
+        m_size = 0;
+        m_norm = norm;
+    }
+
+    void push(float ymin, float xmin, float ymax, float xmax) {
+        OPENVINO_ASSERT(m_size < m_areas.size(), "NmsSelectedBoxes capacity is exceeded");
+        m_coords[0][m_size] = ymin;
+        m_coords[1][m_size] = xmin;
+        m_coords[2][m_size] = ymax;
+        m_coords[3][m_size] = xmax;
+        m_areas[m_size] = area(ymin, xmin, ymax, xmax);
+        m_size++;
+    }
+
+    /**
+     * @brief Checks whether IoU of the box with any selected box reaches the threshold.
+     */
+    [[nodiscard]] bool suppresses(float ymin, float xmin, float ymax, float xmax, float iou_threshold) const {
+        const float box_area = area(ymin, xmin, ymax, xmax);
+        const float* ymins = m_coords[0].data();
+        const float* xmins = m_coords[1].data();
+        const float* ymaxs = m_coords[2].data();
+        const float* xmaxs = m_coords[3].data();
+        const float* areas = m_areas.data();
+        for (size_t start = 0; start < m_size; start += block_size) {
+            const size_t end = std::min(m_size, start + block_size);
+            bool suppressed = false;
+            for (size_t i = start; i < end; i++) {
+                const float height = std::max(std::min(ymax, ymaxs[i]) - std::max(ymin, ymins[i]) + m_norm, 0.F);
+                const float width = std::max(std::min(xmax, xmaxs[i]) - std::max(xmin, xmins[i]) + m_norm, 0.F);
+                const float intersection = height * width;
+                const bool valid = box_area > 0.F && areas[i] > 0.F;
+                const float iou = valid ? intersection / (box_area + areas[i] - intersection) : 0.F;
+                suppressed |= iou >= iou_threshold;
+            }
+            if (suppressed) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+    [[nodiscard]] const float* coord(size_t idx) const {
+        return m_coords[idx].data();
+    }
+
+private:
+    static constexpr size_t block_size = 16;
+
+    [[nodiscard]] float area(float ymin, float xmin, float ymax, float xmax) const {
+        return (ymax - ymin + m_norm) * (xmax - xmin + m_norm);
+    }
+
+    std::array<std::vector<float>, 4> m_coords;
+    std::vector<float> m_areas;
+    size_t m_size = 0;
+    float m_norm = 0.F;
+};
+
+/**
+ * @brief Returns the per-thread NMS buffer of the calling thread.
+ *
+ * The buffers are only safe to use from parallel bodies which don't spawn nested parallel work, otherwise the thread
+ * may pick up another body while waiting and overwrite its own buffer.
+ */
+template <typename T>
+T& get_thread_nms_buffer(std::vector<T>& buffers) {
+    const auto raw_tid = parallel_get_thread_num();
+    OPENVINO_ASSERT(raw_tid >= 0, "parallel_get_thread_num() returns negative value in NMS");
+    const auto thread_idx = static_cast<size_t>(raw_tid);
+    OPENVINO_ASSERT(thread_idx < buffers.size(),
+                    "parallel_get_thread_num() returns value greater than or equal to max threads in NMS");
+    return buffers[thread_idx];
+}
+
+}  // namespace ov::intel_cpu
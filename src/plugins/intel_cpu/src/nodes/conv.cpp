@@ -49,6 +49,7 @@
 #include "openvino/op/convolution.hpp"
 #include "openvino/op/group_conv.hpp"
 #include "openvino/op/util/attr_types.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "post_ops.hpp"
 #include "shape_inference/custom/convolution.hpp"
@@ -284,6 +285,8 @@ const std::vector<impl_desc_type>& Convolution::getDefaultImplPriority() {
         impl_desc_type::winograd_acl,
         impl_desc_type::gemm_acl,
         impl_desc_type::acl,
+        impl_desc_type::jit_inverted_residual_avx512,
+        impl_desc_type::jit_inverted_residual_avx2,
         impl_desc_type::brgconv_avx512_dw,
         impl_desc_type::brgconv_avx512_amx_1x1,
         impl_desc_type::brgconv_avx512_amx,
@@ -474,6 +477,8 @@ void Convolution::initSupportedPrimitiveDescriptors() {
     m_attrs.isGraphQuantized = context->isGraphQuantized();
     m_attrs.fcSemantic = false;
     m_attrs.constantWeights = getParentEdgeAt(WEIGHTS)->getParent()->isConstant();
+    m_attrs.allowWinograd = context->getConfig().enableWinogradConvolution &&
+                            context->getConfig().executionMode == ov::hint::ExecutionMode::PERFORMANCE;
     m_attrs.weightsNonTransposed = false;
     m_attrs.dqScales = getDQScales();
 
@@ -539,6 +544,21 @@ void Convolution::initSupportedPrimitiveDescriptors() {
             nodeConfig.inConfs.emplace_back(dwBiasDesc);
         }
 
+        if (withPWConv) {
+            const std::vector<size_t> pwWeightsDims{pw_conv_oc, dw_conv_oc, 1, 1};
+            const std::vector<size_t> pwBiasesDims{pw_conv_oc};
+
+            const auto pwWeightsDesc = std::make_shared<DnnlBlockedMemoryDesc>(Shape(pwWeightsDims),
+                                                                               memory::data_type::f32,
+                                                                               memory::format_tag::oihw);
+            nodeConfig.inConfs.emplace_back(pwWeightsDesc);
+
+            const auto pwBiasDesc = std::make_shared<DnnlBlockedMemoryDesc>(Shape(pwBiasesDims),
+                                                                            memory::data_type::f32,
+                                                                            memory::format_tag::x);
+            nodeConfig.inConfs.emplace_back(pwBiasDesc);
+        }
+
         if (withSum) {
             auto sumDesc =
                 getSumMemDesc(nodeDescriptors.at(ARG_DST), getInputShapeAtPort(getParentEdges().size() - 1), sumType);
@@ -666,6 +686,11 @@ void Convolution::createPrimitive() {
         m_memory[ARG_ATTR_POST_OP_DW | ARG_BIAS] = getSrcMemoryAtPort(getOriginalInputsNumber() + 1);
     }
 
+    if (withPWConv) {
+        m_memory[ARG_ATTR_POST_OP_PW | ARG_WEI] = getSrcMemoryAtPort(getOriginalInputsNumber() + 2);
+        m_memory[ARG_ATTR_POST_OP_PW | ARG_BIAS] = getSrcMemoryAtPort(getOriginalInputsNumber() + 3);
+    }
+
     if (!legacyInputZeroPoints.empty()) {
         m_memory[ARG_ATTR_ZERO_POINTS | ARG_SRC] = memoryViewToVector(legacyInputZeroPoints, getEngine());
     }
@@ -824,6 +849,14 @@ void Convolution::addFusedNode(const NodePtr& fusingNode) {
     if (fusingNode->getType() == Type::Convolution) {
         auto convolutionNode = std::dynamic_pointer_cast<Convolution>(fusingNode);
         CPU_NODE_ASSERT(convolutionNode, "Unexpected dynamic node type");
+        if (withDWConv) {
+            // the 1x1 convolution consuming the output of the fused depthwise one, the paddings are not affected
+            CPU_NODE_ASSERT(!convolutionNode->isDepthWise(), "cannot fuse more than one depthwise convolution");
+            withPWConv = true;
+            pw_conv_oc = convolutionNode->outputShapes[0].getStaticDims()[1];
+            Node::addFusedNode(fusingNode);
+            return;
+        }
         withDWConv = true;
         const auto& inActivationDims = convolutionNode->inputShapes[0].getStaticDims();
         dw_conv_ih = inActivationDims[convolutionNode->inputShapes[0].getRank() - 2];
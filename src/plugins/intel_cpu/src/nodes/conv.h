@@ -130,6 +130,8 @@ private:
 
     bool withSum = false;
     bool withDWConv = false;
+    // the 1x1 convolution following the fused depthwise one
+    bool withPWConv = false;
     bool withSumBroadcast = false;
 
     size_t dw_conv_oc = 0;
@@ -138,6 +140,7 @@ private:
     std::vector<size_t> dw_conv_kernel;
     std::vector<size_t> dw_conv_strides;
     dnnl::memory::data_type dw_conv_in_dt{dnnl::impl::data_type::undef};
+    size_t pw_conv_oc = 0;
 
     size_t groupNum = 1LU;
     size_t IC = 1;
@@ -34,6 +34,8 @@ struct ConvAttrs {
     bool fcSemantic = false;
     // there are models with non-constant weights
     bool constantWeights = true;
+    // Winograd is not disabled (ENABLE_WINOGRAD_CONVOLUTION) nor excluded by the ACCURACY execution mode
+    bool allowWinograd = false;
     ZeroPointsType inputZeroPointsType = ZeroPointsType::None;
     std::vector<float> dqScales;
 
@@ -25,6 +25,14 @@
 #    include "post_ops.hpp"
 #endif
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/conv_inverted_residual.hpp"
+#endif
+
+#if defined(OV_CPU_WITH_MLAS) && defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/mlas/mlas_conv_winograd.hpp"
+#endif
+
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64) || defined(OV_CPU_WITH_ACL)
 #    include "nodes/executors/executor.hpp"
 #endif
@@ -108,6 +116,37 @@ struct CreateOptimalConfigAclLowp {
 template <>
 const std::vector<ExecutorImplementation<ConvAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<ConvAttrs>> convolutionImplementations {
+        OV_CPU_INSTANCE_DNNL_X64(
+            "convolution_dnnl_inverted_residual_nspc", ExecutorType::Dnnl, OperationType::Convolution,
+            // supports
+            [](const ConvConfig& config, const MemoryFormatFilter& memoryFormatFilter) -> bool {
+                VERIFY(MatchesMemoryFormatFilter(config.descs, LayoutConfig{LayoutType::nspc, LayoutType::ncsp, LayoutType::nspc, LayoutType::nspc},
+                                                 memoryFormatFilter, dnnlConvolutionMappingNotation), MEMORY_FORMAT_MISMATCH);
+                // the 1x1 -> depthwise 3x3 -> 1x1 block fused by the graph optimizer, the rows of nspc tensors are contiguous
+                VERIFY(ConvInvertedResidualExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+
+                return true;
+            },
+            CreateOptimalConfigDefault{{LayoutType::nspc, LayoutType::ncsp, LayoutType::nspc, LayoutType::nspc}},
+            AcceptsAnyShape<ConvAttrs>,
+            CreateDefault<ConvInvertedResidualExecutor, ConvAttrs>{}
+            )
+        OV_CPU_INSTANCE_MLAS_X64(
+            "convolution_mlas_winograd_nspc", ExecutorType::Mlas, OperationType::Convolution,
+            // supports
+            [](const ConvConfig& config, const MemoryFormatFilter& memoryFormatFilter) -> bool {
+                VERIFY(MatchesMemoryFormatFilter(config.descs, LayoutConfig{LayoutType::nspc, LayoutType::ncsp, LayoutType::nspc, LayoutType::nspc},
+                                                 memoryFormatFilter, dnnlConvolutionMappingNotation), MEMORY_FORMAT_MISMATCH);
+                // fp32 3x3 stride 1 convolutions with enough channels, the same nspc layout as brgconv
+                VERIFY(MlasWinogradConvExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+
+                return true;
+            },
+            CreateOptimalConfigDefault{{LayoutType::nspc, LayoutType::ncsp, LayoutType::nspc, LayoutType::nspc}},
+            // large spatial sizes only, the rest falls back to the implementations below
+            MlasWinogradConvExecutor::acceptsShapes,
+            CreateDefault<MlasWinogradConvExecutor, ConvAttrs>{}
+            )
         OV_CPU_INSTANCE_DNNL_X64(
             "convolution_dnnl_nspc_nspc", ExecutorType::Dnnl, OperationType::Convolution,
             // supports
@@ -173,6 +212,7 @@ const std::vector<ExecutorImplementation<ConvAttrs>>& getImplementations() {
                 VERIFY(MatchesMemoryFormatFilter(config.descs, LayoutConfig{LayoutType::ncsp, LayoutType::ncsp, LayoutType::nCsp8c, LayoutType::nCsp8c},
                                                  memoryFormatFilter, dnnlConvolutionMappingNotation), MEMORY_FORMAT_MISMATCH);
                 VERIFY(!isQuantized(config), UNSUPPORTED_SRC_PRECISIONS);
+                VERIFY(!hasPostOp<PointwiseConvolutionPostOp>(config.attrs.postOps), UNSUPPORTED_POST_OPS);
                 const auto [groupNum, groupIC, IC, groupOC] = DnnlConvolutionPrimitive::getChannelParams(config);
                 VERIFY(IC < 4 && groupOC != 1, HEURISTICS_MISMATCH);
 
@@ -210,6 +250,7 @@ const std::vector<ExecutorImplementation<ConvAttrs>>& getImplementations() {
                                                  memoryFormatFilter, dnnlConvolutionMappingNotation), MEMORY_FORMAT_MISMATCH);
 
                 VERIFY(!isQuantized(config), UNSUPPORTED_SRC_PRECISIONS);
+                VERIFY(!hasPostOp<PointwiseConvolutionPostOp>(config.attrs.postOps), UNSUPPORTED_POST_OPS);
                 const auto [groupNum, groupIC, IC, groupOC] = DnnlConvolutionPrimitive::getChannelParams(config);
                 VERIFY(IC > 4, HEURISTICS_MISMATCH);
 
@@ -243,6 +284,7 @@ const std::vector<ExecutorImplementation<ConvAttrs>>& getImplementations() {
                 VERIFY(MatchesMemoryFormatFilter(config.descs, LayoutConfig{LayoutType::nspc, LayoutType::ncsp, LayoutType::nspc, LayoutType::nspc},
                                                  memoryFormatFilter, dnnlConvolutionMappingNotation), MEMORY_FORMAT_MISMATCH);
                 VERIFY(!isQuantized(config), UNSUPPORTED_SRC_PRECISIONS);
+                VERIFY(!hasPostOp<PointwiseConvolutionPostOp>(config.attrs.postOps), UNSUPPORTED_POST_OPS);
                 VERIFY(none_of(srcType(config), ov::element::bf16, ov::element::f16), UNSUPPORTED_SRC_PRECISIONS);
                 VERIFY(DnnlConvolutionPrimitive::isNspcAvailable(config), HEURISTICS_MISMATCH);
 
@@ -97,6 +97,13 @@ public:
         curNumaNode = numaNodeID;
     }
 
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        if (auto it = m_primArgs.find(DNNL_ARG_WEIGHTS); it != m_primArgs.end() && it->second) {
+            return {{it->second.get_data_handle(), it->second.get_desc().get_size()}};
+        }
+        return {};
+    }
+
 private:
     void updateSrcMemory(const DnnlMemoryDescPtr& memDesc, const PrimitivePtr primitive, const MemoryPtr& memory) {
         const auto& primMemDesc = primitive->srcDesc();
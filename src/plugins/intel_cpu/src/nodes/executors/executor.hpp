@@ -76,6 +76,13 @@ public:
         return scratchPads[curNumaNodeId];
     }
 
+    // a copy of the context with a scratchpad of its own, for the primitives executed concurrently by the same node
+    [[nodiscard]] CPtr withPrivateScratchPad() const {
+        auto context = std::make_shared<ExecutorContext>(*this);
+        context->scratchPads[curNumaNodeId] = std::make_shared<DnnlScratchPad>(engine, curNumaNodeId);
+        return context;
+    }
+
     [[nodiscard]] std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeightCache() const {
         return privateWeighCache;
     }
@@ -126,6 +133,9 @@ public:
 using ExecutorFactoryLegacyPtr = std::shared_ptr<ExecutorFactoryLegacy>;
 using ExecutorFactoryLegacyCPtr = std::shared_ptr<const ExecutorFactoryLegacy>;
 
+// [data, data + size) ranges of memory
+using MemoryRegions = std::vector<std::pair<const void*, size_t>>;
+
 class Executor {
 public:
     // returns false if the stage has failed and the executor must be rejected
@@ -154,6 +164,10 @@ public:
     virtual void moveMemToNumaNode([[maybe_unused]] int numaID) {
         OPENVINO_THROW_NOT_IMPLEMENTED("This version of the 'moveMemToNumaNode' method is not implemented by executor");
     }
+    // the weights read from memory on every execution, so they can be prefetched while the preceding nodes run
+    [[nodiscard]] virtual MemoryRegions weightsRegions() const {
+        return {};
+    }
     virtual ~Executor() = default;
 };
 
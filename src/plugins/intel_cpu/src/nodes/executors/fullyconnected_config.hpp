@@ -13,10 +13,22 @@
 
 namespace ov::intel_cpu {
 
+// Structured sparsity of the constant weights [N, K] detected at compile time
+enum class FCSparsityPattern : uint8_t {
+    None,
+    // at most 2 non-zero values in every group of 4 consecutive values along K
+    Structured2x4,
+    // zero blocks of 16 output channels x 1 input channel
+    Block1x16,
+    // zero blocks of 4 output channels x 4 input channels
+    Block4x4,
+};
+
 // @todo require explicit initialization of all the attributes?
 struct FCAttrs {
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    FCSparsityPattern sparsityPattern = FCSparsityPattern::None;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool constantWeights = true;
 
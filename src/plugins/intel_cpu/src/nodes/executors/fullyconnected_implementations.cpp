@@ -22,6 +22,7 @@
 #include "nodes/executors/matmul_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #if defined(OV_CPU_WITH_MLAS) && defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/mlas/mlas_decompress_gemm.hpp"
 #    include "nodes/executors/mlas/mlas_gemm.hpp"
 #endif
 #include "nodes/executors/precision_matcher.hpp"
@@ -43,6 +44,11 @@
 #    include "onednn/iml_type_mapper.h"
 #endif
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/gemv_decompress_fc.hpp"
+#    include "nodes/executors/x64/sparse_fc.hpp"
+#endif
+
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "nodes/executors/kleidiai/kleidiai_mm.hpp"
 #endif
@@ -186,6 +192,53 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_sparse_jit",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                VERIFY(SparseFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            SparseFCExecutor::acceptsShapes,
+            CreateDefault<SparseFCExecutor, FCAttrs>{}
+            )
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_gemv_decompress_jit",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                VERIFY(DecompressGemvFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            // M <= 4 only, larger batches fall back to the implementations below
+            DecompressGemvFCExecutor::acceptsShapes,
+            CreateDefault<DecompressGemvFCExecutor, FCAttrs>{}
+            )
+        OV_CPU_INSTANCE_MLAS_X64(
+            "fullyconnected_decompress_gemm_mlas",
+            ExecutorType::Mlas,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                VERIFY(MlasDecompressGemmExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            // the f8 weights with M > 4, the oneDNN implementations below have no f8 decompression
+            MlasDecompressGemmExecutor::acceptsShapes,
+            CreateDefault<MlasDecompressGemmExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
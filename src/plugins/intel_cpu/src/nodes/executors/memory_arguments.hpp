@@ -40,5 +40,7 @@ using MemoryArgs = std::unordered_map<int, MemoryPtr>;
 #define ARG_ATTR_ZERO_POINTS 8192
 /// fused depthwise convolution.
 #define ARG_ATTR_POST_OP_DW 16384
+/// fused pointwise convolution following the depthwise one.
+#define ARG_ATTR_POST_OP_PW 32768
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,392 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mlas_conv_winograd.hpp"
+
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "mlas/sgemm.hpp"
+#include "nodes/executors/convolution_config.hpp"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/dnnl.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "post_ops.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+
+// F(4x4, 3x3): 6x6 input tiles, 4x4 output tiles
+static constexpr size_t tileSize = 6;
+static constexpr size_t outTileSize = 4;
+static constexpr size_t tilePoints = tileSize * tileSize;
+static constexpr size_t kernelSize = 3;
+// the 36 GEMMs over the channels have to outweigh the transforms of the tiles. The transforms are as fast on AVX-512
+// as on AVX2, while brgconv computes the direct convolution twice as fast, so the GEMMs have to be wider there
+static constexpr size_t minChannelsAvx2 = 16;
+static constexpr size_t minChannelsAvx512 = 64;
+static constexpr size_t minOutputSide = 8;
+static constexpr size_t minOutputPixels = 56 * 56;
+static constexpr size_t minTilesBlock = 8;
+static constexpr size_t maxTilesBlock = 64;
+
+// B^T, applied to the channel vectors of 6 points
+static void inputTransform(const float* const in[tileSize], float* const out[tileSize], size_t channels) {
+    for (size_t c = 0; c < channels; c++) {
+        const float d0 = in[0][c];
+        const float d1 = in[1][c];
+        const float d2 = in[2][c];
+        const float d3 = in[3][c];
+        const float d4 = in[4][c];
+        const float d5 = in[5][c];
+        out[0][c] = 4.F * d0 - 5.F * d2 + d4;
+        out[1][c] = -4.F * (d1 + d2) + d3 + d4;
+        out[2][c] = 4.F * (d1 - d2) - d3 + d4;
+        out[3][c] = 2.F * (d3 - d1) - d2 + d4;
+        out[4][c] = 2.F * (d1 - d3) - d2 + d4;
+        out[5][c] = 4.F * d1 - 5.F * d3 + d5;
+    }
+}
+
+// A^T, applied to the channel vectors of 6 points
+static void outputTransform(const float* const in[tileSize], float* const out[outTileSize], size_t channels) {
+    for (size_t c = 0; c < channels; c++) {
+        const float m0 = in[0][c];
+        const float s12 = in[1][c] + in[2][c];
+        const float d12 = in[1][c] - in[2][c];
+        const float s34 = in[3][c] + in[4][c];
+        const float d34 = in[3][c] - in[4][c];
+        out[0][c] = m0 + s12 + s34;
+        out[1][c] = d12 + 2.F * d34;
+        out[2][c] = s12 + 4.F * s34;
+        out[3][c] = d12 + 8.F * d34 + in[5][c];
+    }
+}
+
+// G, applied to 3 kernel points
+static void weightsTransform(const float in[kernelSize], float out[tileSize]) {
+    out[0] = in[0] / 4.F;
+    out[1] = -(in[0] + in[1] + in[2]) / 6.F;
+    out[2] = -(in[0] - in[1] + in[2]) / 6.F;
+    out[3] = in[0] / 24.F + in[1] / 12.F + in[2] / 6.F;
+    out[4] = in[0] / 24.F - in[1] / 12.F + in[2] / 6.F;
+    out[5] = in[2];
+}
+
+static size_t packedMatrixSize(size_t inChannels, size_t outChannels) {
+    // every packed matrix starts at a cache line
+    return rnd_up(mlas_sgemm_pack_get_size(static_cast<int64_t>(outChannels), static_cast<int64_t>(inChannels)), 64);
+}
+
+// [OC, IC, 3, 3] weights to 36 packed [IC, OC] matrices of G g G^T
+static MemoryCPtr prepareWeightsMemory(const MemoryPtr& weightsMemory, const ExecutorContext::CPtr& context) {
+    const auto& weiDims = weightsMemory->getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const size_t matrixSize = packedMatrixSize(IC, OC);
+
+    auto create = [&]() {
+        DEBUG_LOG("MlasWinogradConvExecutor: cache miss, transform and pack weights");
+        std::vector<float> transformed(tilePoints * IC * OC);
+        const auto* weights = weightsMemory->getDataAs<const float>();
+        parallel_for(OC, [&](size_t oc) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                const float* g = weights + (oc * IC + ic) * kernelSize * kernelSize;
+                // G g: the kernel columns, then (G g) G^T: the rows of the result
+                float gg[tileSize][kernelSize];
+                for (size_t x = 0; x < kernelSize; x++) {
+                    const float column[kernelSize] = {g[x], g[kernelSize + x], g[2 * kernelSize + x]};
+                    float out[tileSize];
+                    weightsTransform(column, out);
+                    for (size_t y = 0; y < tileSize; y++) {
+                        gg[y][x] = out[y];
+                    }
+                }
+                for (size_t y = 0; y < tileSize; y++) {
+                    float out[tileSize];
+                    weightsTransform(gg[y], out);
+                    for (size_t x = 0; x < tileSize; x++) {
+                        transformed[((y * tileSize + x) * IC + ic) * OC + oc] = out[x];
+                    }
+                }
+            }
+        });
+
+        const CpuBlockedMemoryDesc packedDesc(u8, intel_cpu::Shape{tilePoints * matrixSize});
+        MemoryPtr packed = std::make_shared<Memory>(context->getEngine(), packedDesc);
+        auto* packedData = packed->getDataAs<uint8_t>();
+        parallel_for(tilePoints, [&](size_t p) {
+            mlas_sgemm_pack("F",
+                            static_cast<int64_t>(OC),
+                            static_cast<int64_t>(IC),
+                            static_cast<int64_t>(OC),
+                            transformed.data() + p * IC * OC,
+                            reinterpret_cast<float*>(packedData + p * matrixSize));
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = "conv_winograd_mlas_f4x4_3x3_" + std::to_string(OC) + "_" +
+                                        std::to_string(IC) + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("MlasWinogradConvExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("MlasWinogradConvExecutor: Weights cache is not available");
+    return create();
+}
+
+bool MlasWinogradConvExecutor::supports(const ConvConfig& config) {
+    const auto& attrs = config.attrs;
+    // the transforms trade a few bits of accuracy for the speed
+    VERIFY(attrs.allowWinograd, "is not enabled");
+    VERIFY(ov::with_cpu_x86_avx2(), UNSUPPORTED_ISA);
+    VERIFY(all_of(f32, srcType(config), weiType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(!hasBias(config) || biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+    VERIFY(attrs.constantWeights, "non constant weights are not supported");
+    VERIFY(attrs.dqScales.empty() && attrs.inputZeroPointsType == ZeroPointsType::None, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(srcRank(config) == 4U && weiRank(config) == 4U, UNSUPPORTED_SRC_RANK);
+    VERIFY(!attrs.isGrouped && attrs.autoPadding == AutoPaddingType::None, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(all_of_values(attrs.stride, 1U) && all_of_values(attrs.dilation, 0U), UNSUPPORTED_BY_EXECUTOR);
+    const auto nonNegative = [](ptrdiff_t pad) {
+        return pad >= 0;
+    };
+    VERIFY(std::all_of(attrs.paddingL.begin(), attrs.paddingL.end(), nonNegative), UNSUPPORTED_BY_EXECUTOR);
+
+    const auto& wei = weiDims(config);
+    VERIFY(wei[2] == kernelSize && wei[3] == kernelSize, UNSUPPORTED_BY_EXECUTOR);
+    const size_t minChannels = ov::with_cpu_x86_avx512_core() ? minChannelsAvx512 : minChannelsAvx2;
+    VERIFY(wei[0] >= minChannels && wei[1] >= minChannels, HEURISTICS_MISMATCH);
+
+    // relu and clip are applied in the output transform
+    const auto& postOps = attrs.postOps;
+    VERIFY(postOps.size() <= 1, UNSUPPORTED_NUMBER_OF_POSTOPS);
+    if (!postOps.empty()) {
+        VERIFY(postOps[0].type() == typeid(ActivationPostOp), UNSUPPORTED_TYPE_OF_POSTOPS);
+        const auto& activation = std::any_cast<const ActivationPostOp&>(postOps[0]);
+        VERIFY(any_of(activation.type(), ActivationPostOp::Type::relu, ActivationPostOp::Type::clip),
+               UNSUPPORTED_TYPE_OF_POSTOPS);
+    }
+
+    return true;
+}
+
+bool MlasWinogradConvExecutor::acceptsShapes([[maybe_unused]] const ConvAttrs& attrs, const MemoryArgs& memory) {
+    // the direct implementations are faster for the small spatial sizes, where the tiles are mostly padding
+    const auto& dstDims = memory.at(ARG_DST)->getStaticDims();
+    const size_t outHeight = dstDims[2];
+    const size_t outWidth = dstDims[3];
+    return outHeight >= minOutputSide && outWidth >= minOutputSide && outHeight * outWidth >= minOutputPixels;
+}
+
+MlasWinogradConvExecutor::MlasWinogradConvExecutor(const ConvAttrs& attrs,
+                                                   const MemoryArgs& memory,
+                                                   const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      m_inChannels(memory.at(ARG_WEI)->getStaticDims()[1]),
+      m_outChannels(memory.at(ARG_WEI)->getStaticDims()[0]),
+      m_padTop(attrs.paddingL[0]),
+      m_padLeft(attrs.paddingL[1]),
+      m_packedWeights(prepareWeightsMemory(memory.at(ARG_WEI), context)),
+      m_packedMatrixSize(packedMatrixSize(m_inChannels, m_outChannels)) {
+    if (!attrs.postOps.empty()) {
+        const auto& activation = std::any_cast<const ActivationPostOp&>(attrs.postOps[0]);
+        if (activation.type() == ActivationPostOp::Type::relu) {
+            m_negativeSlope = activation.alpha();
+        } else {
+            m_lowerBound = activation.alpha();
+            m_upperBound = activation.beta();
+        }
+    }
+}
+
+bool MlasWinogradConvExecutor::update(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getStaticDims();
+    const auto& dstDims = memory.at(ARG_DST)->getStaticDims();
+    m_batch = srcDims[0];
+    m_inHeight = srcDims[2];
+    m_inWidth = srcDims[3];
+    m_outHeight = dstDims[2];
+    m_outWidth = dstDims[3];
+    m_tilesH = div_up(m_outHeight, outTileSize);
+    m_tilesW = div_up(m_outWidth, outTileSize);
+
+    // the transformed tiles of a block and the GEMM results stay in the half of L2
+    m_threads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t tiles = m_batch * m_tilesH * m_tilesW;
+    const size_t tileFloats = tilePoints * (m_inChannels + m_outChannels);
+    const size_t l2Floats = static_cast<size_t>(dnnl::utils::get_cache_size(2, true)) / 2 / sizeof(float);
+    m_tilesBlock = std::clamp(l2Floats / tileFloats, minTilesBlock, maxTilesBlock);
+    m_tilesBlock = std::max(std::min(m_tilesBlock, div_up(tiles, m_threads)), size_t{1});
+
+    // transformed tiles, GEMM results, the transform of one tile, a zero input point and a discarded output point
+    m_scratchPerThread = tileFloats * m_tilesBlock + tilePoints * std::max(m_inChannels, m_outChannels) +
+                         m_inChannels + m_outChannels;
+    auto scratchDesc = std::make_shared<CpuBlockedMemoryDesc>(f32, intel_cpu::Shape{m_threads, m_scratchPerThread});
+    m_scratch = m_context->getScratchPad()->createScratchPadMem(scratchDesc);
+
+    return true;
+}
+
+void MlasWinogradConvExecutor::executeBlock(const float* src,
+                                            float* dst,
+                                            const float* bias,
+                                            size_t firstTile,
+                                            size_t tiles,
+                                            float* scratch) const {
+    const size_t IC = m_inChannels;
+    const size_t OC = m_outChannels;
+    float* transformedSrc = scratch;                                   // [36][tiles block][IC]
+    float* gemmDst = transformedSrc + tilePoints * m_tilesBlock * IC;  // [36][tiles block][OC]
+    float* tileBuffer = gemmDst + tilePoints * m_tilesBlock * OC;      // [36][max(IC, OC)]
+    float* zeros = tileBuffer + tilePoints * std::max(IC, OC);         // [IC]
+    float* discarded = zeros + IC;                                     // [OC]
+    std::fill(zeros, zeros + IC, 0.F);
+
+    const size_t tilesPerImage = m_tilesH * m_tilesW;
+    const float* in[tileSize];
+    float* out[tileSize];
+
+    for (size_t t = 0; t < tiles; t++) {
+        const size_t n = (firstTile + t) / tilesPerImage;
+        const size_t tileY = (firstTile + t) % tilesPerImage / m_tilesW;
+        const size_t tileX = (firstTile + t) % m_tilesW;
+        const ptrdiff_t y0 = static_cast<ptrdiff_t>(tileY * outTileSize) - m_padTop;
+        const ptrdiff_t x0 = static_cast<ptrdiff_t>(tileX * outTileSize) - m_padLeft;
+        // B^T d: the columns of the tile, the points out of the input are the padding
+        for (size_t x = 0; x < tileSize; x++) {
+            const ptrdiff_t ix = x0 + static_cast<ptrdiff_t>(x);
+            for (size_t y = 0; y < tileSize; y++) {
+                const ptrdiff_t iy = y0 + static_cast<ptrdiff_t>(y);
+                const bool inside = iy >= 0 && ix >= 0 && iy < static_cast<ptrdiff_t>(m_inHeight) &&
+                                    ix < static_cast<ptrdiff_t>(m_inWidth);
+                const size_t point = (n * m_inHeight + static_cast<size_t>(iy)) * m_inWidth + static_cast<size_t>(ix);
+                in[y] = inside ? src + point * IC : zeros;
+                out[y] = tileBuffer + (y * tileSize + x) * IC;
+            }
+            inputTransform(in, out, IC);
+        }
+        // (B^T d) B: the rows, every point is a row of the A matrix of its GEMM
+        for (size_t y = 0; y < tileSize; y++) {
+            for (size_t x = 0; x < tileSize; x++) {
+                in[x] = tileBuffer + (y * tileSize + x) * IC;
+                out[x] = transformedSrc + ((y * tileSize + x) * m_tilesBlock + t) * IC;
+            }
+            inputTransform(in, out, IC);
+        }
+    }
+
+    const auto* packedWeights = m_packedWeights->getDataAs<const uint8_t>();
+    for (size_t p = 0; p < tilePoints; p++) {
+        mlas_sgemm_compute("N",
+                           "N",
+                           static_cast<int64_t>(tiles),
+                           static_cast<int64_t>(OC),
+                           static_cast<int64_t>(IC),
+                           1.0F,
+                           transformedSrc + p * m_tilesBlock * IC,
+                           static_cast<int64_t>(IC),
+                           reinterpret_cast<const float*>(packedWeights + p * m_packedMatrixSize),
+                           static_cast<int64_t>(OC),
+                           0.0F,
+                           gemmDst + p * m_tilesBlock * OC,
+                           static_cast<int64_t>(OC),
+                           nullptr,
+                           1);
+    }
+
+    for (size_t t = 0; t < tiles; t++) {
+        const size_t n = (firstTile + t) / tilesPerImage;
+        const size_t oy0 = (firstTile + t) % tilesPerImage / m_tilesW * outTileSize;
+        const size_t ox0 = (firstTile + t) % m_tilesW * outTileSize;
+        // A^T m: the columns
+        for (size_t x = 0; x < tileSize; x++) {
+            for (size_t y = 0; y < tileSize; y++) {
+                in[y] = gemmDst + ((y * tileSize + x) * m_tilesBlock + t) * OC;
+            }
+            for (size_t y = 0; y < outTileSize; y++) {
+                out[y] = tileBuffer + (y * tileSize + x) * OC;
+            }
+            outputTransform(in, out, OC);
+        }
+        // (A^T m) A: the rows, written to the output with the bias and the activation
+        for (size_t y = 0; y < outTileSize && oy0 + y < m_outHeight; y++) {
+            for (size_t x = 0; x < tileSize; x++) {
+                in[x] = tileBuffer + (y * tileSize + x) * OC;
+            }
+            const size_t width = std::min(outTileSize, m_outWidth - ox0);
+            float* row = dst + ((n * m_outHeight + oy0 + y) * m_outWidth + ox0) * OC;
+            for (size_t x = 0; x < outTileSize; x++) {
+                out[x] = x < width ? row + x * OC : discarded;
+            }
+            outputTransform(in, out, OC);
+            for (size_t i = 0; i < width * OC; i++) {
+                float value = bias != nullptr ? row[i] + bias[i % OC] : row[i];
+                value = value < 0.F ? value * m_negativeSlope : value;
+                row[i] = std::min(std::max(value, m_lowerBound), m_upperBound);
+            }
+        }
+    }
+}
+
+void MlasWinogradConvExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto& biasMemory = memory.at(ARG_BIAS);
+    const auto* bias = biasMemory->getDesc().empty() ? nullptr : biasMemory->getDataAs<const float>();
+    auto* scratch = m_scratch->getDataAs<float>();
+
+    const size_t tiles = m_batch * m_tilesH * m_tilesW;
+    const size_t blocks = div_up(tiles, m_tilesBlock);
+    // the GEMMs of a block run in its thread, the blocks are independent
+    parallel_nt(static_cast<int>(m_threads), [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        for (size_t b = start; b < end; b++) {
+            const size_t firstTile = b * m_tilesBlock;
+            executeBlock(src,
+                         dst,
+                         bias,
+                         firstTile,
+                         std::min(m_tilesBlock, tiles - firstTile),
+                         scratch + static_cast<size_t>(ithr) * m_scratchPerThread);
+        }
+    });
+}
+
+void MlasWinogradConvExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
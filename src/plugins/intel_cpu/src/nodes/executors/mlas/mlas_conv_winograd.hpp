@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#include "cpu_memory.h"
+#include "nodes/executors/convolution_config.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * Convolution executor for fp32 3x3 stride 1 convolutions with the Winograd F(4x4, 3x3) algorithm.
+ * Every 4x4 output tile is computed from a 6x6 input tile: the input tiles are transformed (B^T d B),
+ * multiplied by the transformed weights (G g G^T) as 36 independent GEMMs over the channels
+ * and transformed back (A^T m A), which takes 4x less multiplications than the direct convolution.
+ * The transformed weights are packed for MLAS SGEMM once and shared through the weights cache.
+ * The executor is selected by the channel and spatial thresholds of supports() and acceptsShapes(), which are
+ * higher on AVX-512 where brgconv is faster. The transforms lose a few bits of accuracy, so it's never used in the
+ * ACCURACY execution mode and can be disabled with ENABLE_WINOGRAD_CONVOLUTION.
+ */
+class MlasWinogradConvExecutor : public Executor {
+public:
+    MlasWinogradConvExecutor(const ConvAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::winograd_mlas;
+    }
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const ConvConfig& config);
+    static bool acceptsShapes(const ConvAttrs& attrs, const MemoryArgs& memory);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {{m_packedWeights->getData(), m_packedWeights->getSize()}};
+    }
+
+private:
+    // one block of tiles: input transform -> 36 GEMMs -> output transform with the bias and the activation
+    void executeBlock(const float* src, float* dst, const float* bias, size_t firstTile, size_t tiles, float* scratch)
+        const;
+
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    const size_t m_inChannels;
+    const size_t m_outChannels;
+    const ptrdiff_t m_padTop;
+    const ptrdiff_t m_padLeft;
+    // the packed B matrices of the 36 GEMMs one after another
+    const MemoryCPtr m_packedWeights;
+    const size_t m_packedMatrixSize;
+    // relu (with the negative slope) and clip post ops: min(max(x < 0 ? x * slope : x, lower), upper)
+    float m_negativeSlope = 1.F;
+    float m_lowerBound = std::numeric_limits<float>::lowest();
+    float m_upperBound = std::numeric_limits<float>::max();
+
+    size_t m_batch = 0;
+    size_t m_inHeight = 0;
+    size_t m_inWidth = 0;
+    size_t m_outHeight = 0;
+    size_t m_outWidth = 0;
+    size_t m_tilesH = 0;
+    size_t m_tilesW = 0;
+    // tiles transformed and multiplied at once by a thread
+    size_t m_tilesBlock = 0;
+    size_t m_threads = 0;
+    size_t m_scratchPerThread = 0;
+    MemoryPtr m_scratch;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,275 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mlas_decompress_gemm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "mlas/sgemm.hpp"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+
+// A decompressed block of the weights stays in L2 next to the rows of the activations
+static constexpr size_t maxBlockN = 64;
+static constexpr size_t minBlockN = 16;
+static constexpr size_t maxBlockK = 256;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1U, Dim{1}, std::multiplies<>());
+}
+
+static MemoryCPtr decompressionParam(const MemoryArgs& memory, int argId) {
+    auto it = memory.find(argId);
+    if (it == memory.end() || it->second->getDesc().empty()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+// Number of groups along K of the scales and the zero points ([N, G] or scalar), the larger one is a multiple
+// of the other
+static std::optional<size_t> decompressionGroups(const MemoryArgs& memory, size_t N, size_t K) {
+    std::vector<size_t> paramGroups{1};
+    for (const auto argId : {ARG_WEI | ARG_ATTR_SCALES, ARG_WEI | ARG_ATTR_ZERO_POINTS}) {
+        const auto param = decompressionParam(memory, argId);
+        if (!param) {
+            continue;
+        }
+        if (!param->getShape().isStatic() || !is_supported_convert(param->getPrecision(), f32)) {
+            return std::nullopt;
+        }
+        const auto count = param->getShape().getElementsCount();
+        if (count == 1) {
+            continue;
+        }
+        if (count % N != 0 || K % (count / N) != 0) {
+            return std::nullopt;
+        }
+        paramGroups.push_back(count / N);
+    }
+    const auto groups = *std::max_element(paramGroups.begin(), paramGroups.end());
+    if (std::any_of(paramGroups.begin(), paramGroups.end(), [&](size_t g) {
+            return groups % g != 0;
+        })) {
+        return std::nullopt;
+    }
+    return groups;
+}
+
+// [N, G] ([G, N] for the non transposed weights) or scalar parameter to [groups][N]
+static std::vector<float> expandParam(const MemoryCPtr& param,
+                                      float defaultValue,
+                                      size_t N,
+                                      size_t groups,
+                                      bool weightsTransposed) {
+    std::vector<float> values{defaultValue};
+    if (param) {
+        values.resize(param->getShape().getElementsCount());
+        cpu_convert(param->getData(), values.data(), param->getPrecision(), f32, values.size());
+    }
+    const size_t paramGroups = values.size() == 1 ? 1 : values.size() / N;
+    std::vector<float> expanded(groups * N);
+    for (size_t g = 0; g < groups; g++) {
+        const size_t pg = g * paramGroups / groups;
+        for (size_t n = 0; n < N; n++) {
+            const size_t src = values.size() == 1 ? 0 : (weightsTransposed ? n * paramGroups + pg : pg * N + n);
+            expanded[g * N + n] = values[src];
+        }
+    }
+    return expanded;
+}
+
+static std::array<float, 256> makeLut(ov::element::Type type) {
+    std::array<float, 256> lut{};
+    for (size_t code = 0; code < lut.size(); code++) {
+        const auto bits = static_cast<uint8_t>(code);
+        lut[code] = type == f8e4m3 ? static_cast<float>(ov::float8_e4m3::from_bits(bits))
+                                   : static_cast<float>(ov::float8_e5m2::from_bits(bits));
+    }
+    return lut;
+}
+
+bool MlasDecompressGemmExecutor::supports(const FCConfig& config) {
+    VERIFY(any_of(srcType(config), f32, bf16, f16), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(any_of(weiType(config), f8e4m3, f8e5m2), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(any_of(dstType(config), f32, bf16, f16), UNSUPPORTED_DST_PRECISIONS);
+    VERIFY(config.attrs.constantWeights, "non constant weights are not supported");
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+
+    if (hasBias(config)) {
+        VERIFY(any_of(biaType(config), f32, bf16, f16), UNSUPPORTED_BIAS_PRECISIONS);
+        const auto& biasShape = config.descs.at(ARG_BIAS)->getShape();
+        VERIFY(biasShape.isStatic() && biasShape.getElementsCount() == weiDims(config)[0],
+               "only 'by channel' bias is supported");
+    }
+
+    return true;
+}
+
+bool MlasDecompressGemmExecutor::acceptsShapes([[maybe_unused]] const FCAttrs& attrs, const MemoryArgs& memory) {
+    const auto& weiDims = memory.at(ARG_WEI)->getStaticDims();
+    return decompressionGroups(memory, weiDims[0], weiDims[1]).has_value();
+}
+
+MlasDecompressGemmExecutor::MlasDecompressGemmExecutor(const FCAttrs& attrs,
+                                                       const MemoryArgs& memory,
+                                                       const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      N(memory.at(ARG_WEI)->getStaticDims()[0]),
+      K(memory.at(ARG_WEI)->getStaticDims()[1]),
+      m_weightsTransposed(!attrs.weightsNonTransposed),
+      m_groups(decompressionGroups(memory, N, K).value_or(1)),
+      m_lut(makeLut(memory.at(ARG_WEI)->getPrecision())),
+      m_scales(expandParam(decompressionParam(memory, ARG_WEI | ARG_ATTR_SCALES),
+                           1.F,
+                           N,
+                           m_groups,
+                           m_weightsTransposed)),
+      m_zeroPoints(expandParam(decompressionParam(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS),
+                               0.F,
+                               N,
+                               m_groups,
+                               m_weightsTransposed)),
+      m_bias(memory.at(ARG_BIAS)->getDesc().empty() ? std::vector<float>{}
+                                                     : expandParam(memory.at(ARG_BIAS), 0.F, N, 1, true)) {}
+
+bool MlasDecompressGemmExecutor::update(const MemoryArgs& memory) {
+    M = batchDim(memory.at(ARG_SRC)->getStaticDims());
+
+    // enough blocks of output channels for every thread
+    m_threads = static_cast<size_t>(parallel_get_max_threads());
+    m_blockN = std::clamp(rnd_up(div_up(N, m_threads), minBlockN), minBlockN, maxBlockN);
+    m_blockK = std::min(K, maxBlockK);
+
+    // decompressed weights per thread | f32 activations | f32 output
+    const bool convertSrc = memory.at(ARG_SRC)->getPrecision() != f32;
+    const bool convertDst = memory.at(ARG_DST)->getPrecision() != f32;
+    const size_t scratchSize = m_threads * m_blockN * m_blockK + (convertSrc ? M * K : 0) + (convertDst ? M * N : 0);
+    auto scratchDesc = std::make_shared<CpuBlockedMemoryDesc>(f32, intel_cpu::Shape{scratchSize});
+    m_scratch = m_context->getScratchPad()->createScratchPadMem(scratchDesc);
+
+    return true;
+}
+
+void MlasDecompressGemmExecutor::decompressBlock(size_t n0, size_t nb, size_t k0, size_t kb, float* dst) const {
+    const size_t groupK = K / m_groups;
+    const auto* weights = m_memoryArgs.at(ARG_WEI)->getDataAs<const uint8_t>();
+    if (m_weightsTransposed) {
+        // [nb][kb]
+        for (size_t c = 0; c < nb; c++) {
+            const size_t n = n0 + c;
+            const auto* codes = weights + n * K;
+            for (size_t k = k0; k < k0 + kb;) {
+                const size_t g = k / groupK;
+                const size_t kEnd = std::min(k0 + kb, (g + 1) * groupK);
+                const float scale = m_scales[g * N + n];
+                const float zeroPoint = m_zeroPoints[g * N + n];
+                for (; k < kEnd; k++) {
+                    dst[c * kb + k - k0] = (m_lut[codes[k]] - zeroPoint) * scale;
+                }
+            }
+        }
+    } else {
+        // [kb][nb]
+        for (size_t k = k0; k < k0 + kb; k++) {
+            const auto* codes = weights + k * N + n0;
+            const auto* scales = m_scales.data() + (k / groupK) * N + n0;
+            const auto* zeroPoints = m_zeroPoints.data() + (k / groupK) * N + n0;
+            for (size_t c = 0; c < nb; c++) {
+                dst[(k - k0) * nb + c] = (m_lut[codes[c]] - zeroPoints[c]) * scales[c];
+            }
+        }
+    }
+}
+
+void MlasDecompressGemmExecutor::execute(const MemoryArgs& memory) {
+    if (M == 0) {
+        return;
+    }
+    const auto& srcMemory = memory.at(ARG_SRC);
+    const auto& dstMemory = memory.at(ARG_DST);
+    auto* scratch = m_scratch->getDataAs<float>();
+    auto* blocks = scratch;
+    scratch += m_threads * m_blockN * m_blockK;
+
+    const float* src = nullptr;
+    if (srcMemory->getPrecision() == f32) {
+        src = srcMemory->getDataAs<const float>();
+    } else {
+        cpu_convert(srcMemory->getData(), scratch, srcMemory->getPrecision(), f32, M * K);
+        src = scratch;
+        scratch += M * K;
+    }
+    float* dst = dstMemory->getPrecision() == f32 ? dstMemory->getDataAs<float>() : scratch;
+
+    // the GEMMs of a block of output channels run in its thread, accumulating over the blocks of K
+    const size_t blocksN = div_up(N, m_blockN);
+    parallel_nt(static_cast<int>(m_threads), [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(blocksN, nthr, ithr, start, end);
+        float* block = blocks + static_cast<size_t>(ithr) * m_blockN * m_blockK;
+        for (size_t bn = start; bn < end; bn++) {
+            const size_t n0 = bn * m_blockN;
+            const size_t nb = std::min(m_blockN, N - n0);
+            for (size_t k0 = 0; k0 < K; k0 += m_blockK) {
+                const size_t kb = std::min(m_blockK, K - k0);
+                decompressBlock(n0, nb, k0, kb, block);
+                mlas_sgemm("N",
+                           m_weightsTransposed ? "T" : "N",
+                           static_cast<int64_t>(M),
+                           static_cast<int64_t>(nb),
+                           static_cast<int64_t>(kb),
+                           1.0F,
+                           src + k0,
+                           static_cast<int64_t>(K),
+                           block,
+                           static_cast<int64_t>(m_weightsTransposed ? kb : nb),
+                           k0 == 0 ? 0.0F : 1.0F,
+                           dst + n0,
+                           static_cast<int64_t>(N),
+                           1);
+            }
+            if (!m_bias.empty()) {
+                for (size_t m = 0; m < M; m++) {
+                    for (size_t n = n0; n < n0 + nb; n++) {
+                        dst[m * N + n] += m_bias[n];
+                    }
+                }
+            }
+        }
+    });
+
+    if (dstMemory->getPrecision() != f32) {
+        cpu_convert(dst, dstMemory->getData(), f32, dstMemory->getPrecision(), M * N);
+    }
+}
+
+}  // namespace ov::intel_cpu
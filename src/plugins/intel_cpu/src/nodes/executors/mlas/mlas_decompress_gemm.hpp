@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected executor for f8e4m3 / f8e5m2 weights and the batches above the decompression GEMV (M > 4).
+ * The weights stay compressed: every thread decompresses a block of output channels x a block of K to f32 with
+ * the scales and the zero points and accumulates its product with the activations by MLAS SGEMM.
+ */
+class MlasDecompressGemmExecutor : public Executor {
+public:
+    MlasDecompressGemmExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::gemm_mlas;
+    }
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+    static bool acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory);
+
+private:
+    void decompressBlock(size_t n0, size_t nb, size_t k0, size_t kb, float* dst) const;
+
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    const size_t N;
+    const size_t K;
+    const bool m_weightsTransposed;
+    const size_t m_groups;
+    // f8 code to f32
+    const std::array<float, 256> m_lut;
+    // [G][N]
+    const std::vector<float> m_scales;
+    const std::vector<float> m_zeroPoints;
+    const std::vector<float> m_bias;
+
+    size_t M = 0;
+    size_t m_threads = 0;
+    size_t m_blockN = 0;
+    size_t m_blockK = 0;
+    MemoryPtr m_scratch;
+};
+
+}  // namespace ov::intel_cpu
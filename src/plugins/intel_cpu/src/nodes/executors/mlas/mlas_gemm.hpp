@@ -31,6 +31,10 @@ public:
 
     void moveMemToNumaNode(int numaNodeID) override;
 
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {{packedWeights->getData(), packedWeights->getSize()}};
+    }
+
 private:
     const MemoryArgs& m_memoryArgs;
     const MemoryCPtr packedWeights;
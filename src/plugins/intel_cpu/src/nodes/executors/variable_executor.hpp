@@ -76,6 +76,10 @@ public:
         m_executors[m_implId]->moveMemToNumaNode(numaID);
     }
 
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return m_executors[m_implId] ? m_executors[m_implId]->weightsRegions() : MemoryRegions{};
+    }
+
 private:
     [[nodiscard]] size_t select(const MemoryArgs& memory, const size_t startIdx) const {
         OPENVINO_ASSERT(startIdx < m_suitableImplementations.size(),
@@ -0,0 +1,377 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "conv_inverted_residual.hpp"
+
+#include <algorithm>
+#include <any>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "nodes/common/blocked_desc_creator.h"
+#include "nodes/executors/convolution_config.hpp"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/dnnl/dnnl_convolution_primitive.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/dnnl.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "post_ops.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+// the size of the 3x3 depthwise kernel and its paddings
+static constexpr size_t depthwiseKernel = 3;
+static constexpr ptrdiff_t depthwisePadding = 1;
+
+static const DepthwiseConvolutionPostOp& depthwisePostOp(const PostOps& postOps) {
+    const auto it = std::find_if(postOps.begin(), postOps.end(), [](const std::any& postOp) {
+        return postOp.type() == typeid(DepthwiseConvolutionPostOp);
+    });
+    OPENVINO_ASSERT(it != postOps.end(), "The depthwise convolution post op is expected");
+    return std::any_cast<const DepthwiseConvolutionPostOp&>(*it);
+}
+
+bool ConvInvertedResidualExecutor::supports(const ConvConfig& config) {
+    const auto& attrs = config.attrs;
+    VERIFY(mayiuse(avx2), UNSUPPORTED_ISA);
+    VERIFY(hasPostOp<DepthwiseConvolutionPostOp>(attrs.postOps), UNSUPPORTED_POST_OPS);
+    VERIFY(hasPostOp<PointwiseConvolutionPostOp>(attrs.postOps), UNSUPPORTED_POST_OPS);
+    // int8 blocks carry the per stage scales and zero points, which are not split between the stages
+    VERIFY(any_of(srcType(config), f32, bf16), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(attrs.dqScales.empty() && attrs.inputZeroPointsType == ZeroPointsType::None, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(srcRank(config) == 4U, UNSUPPORTED_SRC_RANK);
+    VERIFY(!attrs.isGrouped && all_of_values(attrs.stride, 1U), UNSUPPORTED_BY_EXECUTOR);
+
+    // the post ops are split by the depthwise and the pointwise convolutions, each one is fused once
+    size_t depthwise = 0;
+    size_t pointwise = 0;
+    for (const auto& postOp : attrs.postOps) {
+        if (postOp.type() == typeid(DepthwiseConvolutionPostOp)) {
+            VERIFY(pointwise == 0, UNSUPPORTED_TYPE_OF_POSTOPS);
+            depthwise++;
+        } else if (postOp.type() == typeid(PointwiseConvolutionPostOp)) {
+            pointwise++;
+        }
+    }
+    VERIFY(depthwise == 1 && pointwise == 1, UNSUPPORTED_NUMBER_OF_POSTOPS);
+
+    const auto& dw = depthwisePostOp(attrs.postOps);
+    VERIFY(all_of(depthwiseKernel, dw.kernel()[0], dw.kernel()[1]), UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(dw.strides()[0] == dw.strides()[1] && any_of(dw.strides()[0], 1U, 2U), UNSUPPORTED_BY_EXECUTOR);
+
+    return true;
+}
+
+ConvInvertedResidualExecutor::ConvInvertedResidualExecutor(const ConvAttrs& attrs,
+                                                           const MemoryArgs& memory,
+                                                           const ExecutorContext::CPtr& context)
+    : m_context(context),
+      m_expandAttrs(attrs),
+      m_depthwiseAttrs(attrs),
+      m_projectAttrs(attrs),
+      m_memoryArgs(memory),
+      m_precision(memory.at(ARG_SRC)->getDescPtr()->getPrecision()),
+      m_stride(depthwisePostOp(attrs.postOps).strides()[0]) {
+    // the post ops of every stage, the post ops preceding the depthwise convolution belong to the expand one
+    PostOps* stagePostOps = &m_expandAttrs.postOps;
+    m_expandAttrs.postOps.clear();
+    m_depthwiseAttrs.postOps.clear();
+    m_projectAttrs.postOps.clear();
+    for (const auto& postOp : attrs.postOps) {
+        if (postOp.type() == typeid(DepthwiseConvolutionPostOp)) {
+            stagePostOps = &m_depthwiseAttrs.postOps;
+        } else if (postOp.type() == typeid(PointwiseConvolutionPostOp)) {
+            stagePostOps = &m_projectAttrs.postOps;
+        } else {
+            stagePostOps->push_back(postOp);
+        }
+    }
+
+    // the paddings of the expand convolution are adjusted to the fused depthwise output by the node
+    m_expandAttrs.paddingL = {0, 0};
+    m_expandAttrs.paddingR = {0, 0};
+    m_expandAttrs.autoPadding = AutoPaddingType::None;
+
+    // the row paddings depend on the band, see depthwiseStage()
+    m_depthwiseAttrs.stride = {m_stride, m_stride};
+    m_depthwiseAttrs.dilation = {0, 0};
+    m_depthwiseAttrs.autoPadding = AutoPaddingType::None;
+    m_depthwiseAttrs.withBias = true;
+    m_depthwiseAttrs.isGrouped = true;
+
+    m_projectAttrs.stride = {1, 1};
+    m_projectAttrs.dilation = {0, 0};
+    m_projectAttrs.paddingL = {0, 0};
+    m_projectAttrs.paddingR = {0, 0};
+    m_projectAttrs.autoPadding = AutoPaddingType::None;
+    m_projectAttrs.withBias = true;
+}
+
+size_t ConvInvertedResidualExecutor::bandBudget() {
+    // the expanded rows and the depthwise output of a band share L2 with the weights and the streamed rows
+    return static_cast<size_t>(dnnl::utils::get_cache_size(2, true)) / 2;
+}
+
+bool ConvInvertedResidualExecutor::update(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getStaticDims();
+    const auto& dstDims = memory.at(ARG_DST)->getStaticDims();
+    m_batch = srcDims[0];
+    m_inChannels = srcDims[1];
+    m_inHeight = srcDims[2];
+    m_inWidth = srcDims[3];
+    m_expandedChannels = memory.at(ARG_WEI)->getStaticDims()[0];
+    m_outChannels = dstDims[1];
+    m_outHeight = dstDims[2];
+    m_outWidth = dstDims[3];
+    // nspc rows are contiguous, so a band of rows is a plain slice of the tensor
+    m_srcRowSize = m_inChannels * m_inWidth * memory.at(ARG_SRC)->getDescPtr()->getPrecision().size();
+    m_dstRowSize = m_outChannels * m_outWidth * memory.at(ARG_DST)->getDescPtr()->getPrecision().size();
+
+    const size_t threads = parallel_get_max_threads();
+    const size_t expandedRowSize = m_expandedChannels * m_inWidth * m_precision.size();
+    const size_t depthwiseRowSize = m_expandedChannels * m_outWidth * m_precision.size();
+    // a band of r output rows reads (r - 1) * stride + kernel expanded rows
+    const size_t haloSize = (depthwiseKernel - m_stride) * expandedRowSize;
+    const size_t budget = bandBudget();
+    const size_t budgetRows =
+        budget > haloSize ? (budget - haloSize) / (m_stride * expandedRowSize + depthwiseRowSize) : 1;
+    // smaller bands when there are not enough of them for all the threads
+    const size_t balancedRows = div_up(m_batch * m_outHeight, threads);
+    m_bandRows = std::clamp<size_t>(std::min(budgetRows, balancedRows), 1, m_outHeight);
+
+    m_bands.clear();
+    const auto stride = static_cast<ptrdiff_t>(m_stride);
+    const auto inHeight = static_cast<ptrdiff_t>(m_inHeight);
+    for (size_t o0 = 0; o0 < m_outHeight; o0 += m_bandRows) {
+        const size_t o1 = std::min(o0 + m_bandRows, m_outHeight);
+        // the input rows of the band, the halo rows are recomputed by the neighbouring bands
+        const ptrdiff_t begin = static_cast<ptrdiff_t>(o0) * stride - depthwisePadding;
+        const ptrdiff_t end = static_cast<ptrdiff_t>(o1 - 1) * stride + depthwisePadding + 1;
+        const ptrdiff_t first = std::max<ptrdiff_t>(begin, 0);
+        const ptrdiff_t last = std::min(end, inHeight);
+        m_bands.push_back(
+            {static_cast<size_t>(first), static_cast<size_t>(last - first), first - begin, end - last, o0, o1 - o0});
+    }
+
+    // the primitives are created for the distinct band shapes only: the first, the middle and the last bands
+    auto* src = memory.at(ARG_SRC)->getData();
+    auto* dst = memory.at(ARG_DST)->getData();
+    const size_t expandedRows = std::min((m_bandRows - 1) * m_stride + depthwiseKernel, m_inHeight);
+    const auto& creator = BlockedDescCreator::getCommonCreators().at(LayoutType::nspc);
+    m_threads.clear();
+    m_threads.resize(std::min(threads, m_batch * m_bands.size()));
+    for (auto& thread : m_threads) {
+        thread.context = m_context->withPrivateScratchPad();
+        thread.expanded = std::make_shared<Memory>(
+            m_context->getEngine(),
+            creator->createSharedDesc(m_precision, Shape(VectorDims{1, m_expandedChannels, expandedRows, m_inWidth})));
+        thread.depthwise = std::make_shared<Memory>(
+            m_context->getEngine(),
+            creator->createSharedDesc(m_precision, Shape(VectorDims{1, m_expandedChannels, m_bandRows, m_outWidth})));
+#if OV_THREAD_USE_TBB
+        thread.arena = std::make_shared<tbb::task_arena>(1);
+#endif
+        for (const auto& band : m_bands) {
+            expandStage(thread, band.srcRows, src);
+            depthwiseStage(thread, band);
+            projectStage(thread, band.rows, dst);
+        }
+    }
+
+    return true;
+}
+
+ConvInvertedResidualExecutor::Stage ConvInvertedResidualExecutor::createStage(const ExecutorContext::CPtr& context,
+                                                                              const ConvAttrs& attrs,
+                                                                              const VectorDims& srcDims,
+                                                                              ov::element::Type srcPrecision,
+                                                                              const VectorDims& dstDims,
+                                                                              ov::element::Type dstPrecision,
+                                                                              const MemoryPtr& weights,
+                                                                              const MemoryPtr& bias,
+                                                                              void* src,
+                                                                              void* dst) const {
+    const auto& creator = BlockedDescCreator::getCommonCreators().at(LayoutType::nspc);
+    const auto& engine = context->getEngine();
+    // views of the band data, which is set before every execution
+    const auto srcMemory =
+        std::make_shared<Memory>(engine, creator->createSharedDesc(srcPrecision, Shape(srcDims)), src);
+    const auto dstMemory =
+        std::make_shared<Memory>(engine, creator->createSharedDesc(dstPrecision, Shape(dstDims)), dst);
+
+    Stage stage{nullptr, {{ARG_SRC, srcMemory}, {ARG_WEI, weights}, {ARG_BIAS, bias}, {ARG_DST, dstMemory}}};
+    stage.executor = CreateDnnlDefault<DnnlConvolutionPrimitive, ConvAttrs>{}(attrs, stage.memory, context);
+    OPENVINO_ASSERT(stage.executor->update(stage.memory),
+                    "Cannot create the convolution of the inverted residual block");
+    if (curNumaNode >= 0) {
+        stage.executor->moveMemToNumaNode(curNumaNode);
+    }
+    return stage;
+}
+
+ConvInvertedResidualExecutor::Stage& ConvInvertedResidualExecutor::expandStage(ThreadData& thread,
+                                                                               size_t rows,
+                                                                               void* src) {
+    if (auto it = thread.expandStages.find(rows); it != thread.expandStages.end()) {
+        return it->second;
+    }
+    auto stage = createStage(thread.context,
+                             m_expandAttrs,
+                             {1, m_inChannels, rows, m_inWidth},
+                             m_memoryArgs.at(ARG_SRC)->getDescPtr()->getPrecision(),
+                             {1, m_expandedChannels, rows, m_inWidth},
+                             m_precision,
+                             m_memoryArgs.at(ARG_WEI),
+                             m_memoryArgs.at(ARG_BIAS),
+                             src,
+                             thread.expanded->getData());
+    return thread.expandStages.emplace(rows, std::move(stage)).first->second;
+}
+
+ConvInvertedResidualExecutor::Stage& ConvInvertedResidualExecutor::depthwiseStage(ThreadData& thread,
+                                                                                  const Band& band) {
+    const DepthwiseKey key{band.srcRows, band.padTop, band.padBottom, band.rows};
+    if (auto it = thread.depthwiseStages.find(key); it != thread.depthwiseStages.end()) {
+        return it->second;
+    }
+    auto attrs = m_depthwiseAttrs;
+    attrs.paddingL = {band.padTop, depthwisePadding};
+    attrs.paddingR = {band.padBottom, depthwisePadding};
+    auto stage = createStage(thread.context,
+                             attrs,
+                             {1, m_expandedChannels, band.srcRows, m_inWidth},
+                             m_precision,
+                             {1, m_expandedChannels, band.rows, m_outWidth},
+                             m_precision,
+                             m_memoryArgs.at(ARG_ATTR_POST_OP_DW | ARG_WEI),
+                             m_memoryArgs.at(ARG_ATTR_POST_OP_DW | ARG_BIAS),
+                             thread.expanded->getData(),
+                             thread.depthwise->getData());
+    return thread.depthwiseStages.emplace(key, std::move(stage)).first->second;
+}
+
+ConvInvertedResidualExecutor::Stage& ConvInvertedResidualExecutor::projectStage(ThreadData& thread,
+                                                                                size_t rows,
+                                                                                void* dst) {
+    if (auto it = thread.projectStages.find(rows); it != thread.projectStages.end()) {
+        return it->second;
+    }
+    auto stage = createStage(thread.context,
+                             m_projectAttrs,
+                             {1, m_expandedChannels, rows, m_outWidth},
+                             m_precision,
+                             {1, m_outChannels, rows, m_outWidth},
+                             m_memoryArgs.at(ARG_DST)->getDescPtr()->getPrecision(),
+                             m_memoryArgs.at(ARG_ATTR_POST_OP_PW | ARG_WEI),
+                             m_memoryArgs.at(ARG_ATTR_POST_OP_PW | ARG_BIAS),
+                             thread.depthwise->getData(),
+                             dst);
+    return thread.projectStages.emplace(rows, std::move(stage)).first->second;
+}
+
+void ConvInvertedResidualExecutor::run(Stage& stage, void* src, void* dst) {
+    const auto& srcMemory = stage.memory.at(ARG_SRC);
+    const auto& dstMemory = stage.memory.at(ARG_DST);
+    srcMemory->getMemoryBlock()->setExtBuff(src, srcMemory->getSize());
+    dstMemory->getMemoryBlock()->setExtBuff(dst, dstMemory->getSize());
+    stage.executor->execute(stage.memory);
+}
+
+void ConvInvertedResidualExecutor::executeBand(ThreadData& thread, const Band& band, uint8_t* src, uint8_t* dst) {
+    auto* bandSrc = src + band.srcRow * m_srcRowSize;
+    auto* bandDst = dst + band.dstRow * m_dstRowSize;
+    auto* expanded = thread.expanded->getData();
+    auto* depthwise = thread.depthwise->getData();
+    run(thread.expandStages.at(band.srcRows), bandSrc, expanded);
+    run(thread.depthwiseStages.at({band.srcRows, band.padTop, band.padBottom, band.rows}), expanded, depthwise);
+    run(thread.projectStages.at(band.rows), depthwise, bandDst);
+}
+
+void ConvInvertedResidualExecutor::execute(const MemoryArgs& memory) {
+    auto* src = memory.at(ARG_SRC)->getDataAs<uint8_t>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<uint8_t>();
+    const size_t bands = m_batch * m_bands.size();
+    // every thread runs all the stages of a contiguous range of bands, so the neighbouring bands of a thread share
+    // the halo input rows
+    parallel_nt(static_cast<int>(m_threads.size()), [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(bands, nthr, ithr, start, end);
+        auto& thread = m_threads[ithr];
+        auto executeBands = [&] {
+            for (size_t i = start; i < end; i++) {
+                const size_t n = i / m_bands.size();
+                executeBand(thread,
+                            m_bands[i % m_bands.size()],
+                            src + n * m_inHeight * m_srcRowSize,
+                            dst + n * m_outHeight * m_dstRowSize);
+            }
+        };
+#if OV_THREAD_USE_TBB
+        thread.arena->execute(executeBands);
+#else
+        // the primitives called from a parallel region run on the calling thread
+        executeBands();
+#endif
+    });
+}
+
+impl_desc_type ConvInvertedResidualExecutor::implType() const {
+    return mayiuse(avx512_core) ? impl_desc_type::jit_inverted_residual_avx512
+                                : impl_desc_type::jit_inverted_residual_avx2;
+}
+
+void ConvInvertedResidualExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    for (auto& thread : m_threads) {
+        for (auto* stages : {&thread.expandStages, &thread.projectStages}) {
+            for (auto& [rows, stage] : *stages) {
+                stage.executor->moveMemToNumaNode(numaNodeID);
+            }
+        }
+        for (auto& [key, stage] : thread.depthwiseStages) {
+            stage.executor->moveMemToNumaNode(numaNodeID);
+        }
+    }
+}
+
+MemoryRegions ConvInvertedResidualExecutor::weightsRegions() const {
+    // the stages of the same convolution share the weights
+    MemoryRegions regions;
+    if (m_threads.empty()) {
+        return regions;
+    }
+    const auto& thread = m_threads.front();
+    for (const auto* stages : {&thread.expandStages, &thread.projectStages}) {
+        if (!stages->empty()) {
+            const auto stageRegions = stages->begin()->second.executor->weightsRegions();
+            regions.insert(regions.end(), stageRegions.begin(), stageRegions.end());
+        }
+    }
+    if (!thread.depthwiseStages.empty()) {
+        const auto stageRegions = thread.depthwiseStages.begin()->second.executor->weightsRegions();
+        regions.insert(regions.end(), stageRegions.begin(), stageRegions.end());
+    }
+    return regions;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "nodes/executors/convolution_config.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Convolution executor for the inverted residual block fused by the graph optimizer:
+ * 1x1 expand convolution -> 3x3 depthwise convolution (DepthwiseConvolutionPostOp) -> 1x1 project convolution
+ * (PointwiseConvolutionPostOp).
+ * The block is executed by bands of the output rows. Every thread runs the three stages of its bands one after
+ * another, so the expanded rows of a band (including the halo rows of the depthwise kernel) and the depthwise output
+ * of the band are produced and consumed in the L2 of the same core and the expanded tensor is never written to the
+ * memory. Every stage of a band is a single threaded oneDNN convolution over nspc row slices of the tensors, the
+ * primitives are created once per band shape and thread. The block is fused only with
+ * ENABLE_INVERTED_RESIDUAL_FUSION.
+ */
+class ConvInvertedResidualExecutor : public Executor {
+public:
+    ConvInvertedResidualExecutor(const ConvAttrs& attrs,
+                                 const MemoryArgs& memory,
+                                 const ExecutorContext::CPtr& context);
+
+    bool update(const MemoryArgs& memory) override;
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    [[nodiscard]] MemoryRegions weightsRegions() const override;
+
+    static bool supports(const ConvConfig& config);
+
+    // the L2 of one core used by the band of a thread, the graph optimizer fuses the block only when the expanded
+    // tensor doesn't fit the budgets of all the threads of the stream
+    static size_t bandBudget();
+
+private:
+    // a oneDNN convolution over the row slices of the band, src and dst point to the band data before the execution
+    struct Stage {
+        ExecutorPtr executor;
+        MemoryArgs memory;
+    };
+    // the input and output rows of the band and the row paddings of its depthwise convolution
+    struct Band {
+        size_t srcRow;
+        size_t srcRows;
+        ptrdiff_t padTop;
+        ptrdiff_t padBottom;
+        size_t dstRow;
+        size_t rows;
+    };
+    // rows of the depthwise input, top and bottom row paddings, rows of the output
+    using DepthwiseKey = std::tuple<size_t, ptrdiff_t, ptrdiff_t, size_t>;
+    // the band buffers and the stages of a thread, the primitives of the thread use a private scratchpad
+    struct ThreadData {
+        ExecutorContext::CPtr context;
+        MemoryPtr expanded;
+        MemoryPtr depthwise;
+        std::map<size_t, Stage> expandStages;
+        std::map<DepthwiseKey, Stage> depthwiseStages;
+        std::map<size_t, Stage> projectStages;
+#if OV_THREAD_USE_TBB
+        // keeps the parallel loops of the primitives on the thread executing the band
+        std::shared_ptr<tbb::task_arena> arena;
+#endif
+    };
+
+    Stage createStage(const ExecutorContext::CPtr& context,
+                      const ConvAttrs& attrs,
+                      const VectorDims& srcDims,
+                      ov::element::Type srcPrecision,
+                      const VectorDims& dstDims,
+                      ov::element::Type dstPrecision,
+                      const MemoryPtr& weights,
+                      const MemoryPtr& bias,
+                      void* src,
+                      void* dst) const;
+    Stage& expandStage(ThreadData& thread, size_t rows, void* src);
+    Stage& depthwiseStage(ThreadData& thread, const Band& band);
+    Stage& projectStage(ThreadData& thread, size_t rows, void* dst);
+    void executeBand(ThreadData& thread, const Band& band, uint8_t* src, uint8_t* dst);
+    static void run(Stage& stage, void* src, void* dst);
+
+    const ExecutorContext::CPtr m_context;
+    ConvAttrs m_expandAttrs;
+    ConvAttrs m_depthwiseAttrs;
+    ConvAttrs m_projectAttrs;
+    const MemoryArgs& m_memoryArgs;
+    ov::element::Type m_precision;
+
+    size_t m_stride = 1;
+    size_t m_inChannels = 0;
+    size_t m_expandedChannels = 0;
+    size_t m_outChannels = 0;
+    size_t m_batch = 0;
+    size_t m_inHeight = 0;
+    size_t m_inWidth = 0;
+    size_t m_outHeight = 0;
+    size_t m_outWidth = 0;
+    size_t m_srcRowSize = 0;
+    size_t m_dstRowSize = 0;
+    // output rows processed at once by a thread
+    size_t m_bandRows = 0;
+
+    std::vector<Band> m_bands;
+    std::vector<ThreadData> m_threads;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,474 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gemv_decompress_fc.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/gemv_decompress_kernel.hpp"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+// Above this M the weights are reused enough for the brgemm / oneDNN / MLAS kernels to be compute bound
+static constexpr size_t maxGemvRows = kernel::jit_gemv_decompress_kernel<avx2>::max_m_block;
+// Upper bound of the K block for per channel scales, the K ranges of the split are multiples of the block
+static constexpr size_t maxPerChannelBlockK = 256;
+// every block of K is a multiple of the largest K unroll of the kernel
+static constexpr size_t blockKMultiple = 4;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1U, Dim{1}, std::multiplies<>());
+}
+
+static size_t panelSize() {
+    return mayiuse(avx512_core) ? kernel::gemv_decompress_panel_size<avx512_core>()
+                                : kernel::gemv_decompress_panel_size<avx2>();
+}
+
+static MemoryCPtr decompressionParam(const MemoryArgs& memory, int argId) {
+    auto it = memory.find(argId);
+    if (it == memory.end() || it->second->getDesc().empty()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+// Number of groups along K shared by the scales and the zero points ([N, G] or scalar)
+static std::optional<size_t> decompressionGroups(const MemoryArgs& memory, size_t N, size_t K) {
+    size_t groups = 1;
+    std::vector<size_t> paramGroups;
+    for (const auto argId : {ARG_WEI | ARG_ATTR_SCALES, ARG_WEI | ARG_ATTR_ZERO_POINTS}) {
+        const auto param = decompressionParam(memory, argId);
+        if (!param) {
+            continue;
+        }
+        if (!param->getShape().isStatic() || !is_supported_convert(param->getPrecision(), f32)) {
+            return std::nullopt;
+        }
+        const auto count = param->getShape().getElementsCount();
+        if (count == 1) {
+            continue;
+        }
+        if (count % N != 0 || K % (count / N) != 0) {
+            return std::nullopt;
+        }
+        paramGroups.push_back(count / N);
+        groups = std::max(groups, count / N);
+    }
+    if (std::any_of(paramGroups.begin(), paramGroups.end(), [&](size_t g) {
+            return groups % g != 0;
+        })) {
+        return std::nullopt;
+    }
+    if (groups > 1 && (K / groups) % blockKMultiple != 0) {
+        return std::nullopt;
+    }
+    return groups;
+}
+
+// Per channel parameters are applied per virtual block of K, so the K split is not limited to a single range
+static size_t blockSize(size_t K, size_t groups) {
+    if (groups > 1) {
+        return K / groups;
+    }
+    size_t block = blockKMultiple;
+    for (size_t b = blockKMultiple; b <= std::min(K, maxPerChannelBlockK); b += blockKMultiple) {
+        if (K % b == 0) {
+            block = b;
+        }
+    }
+    return block;
+}
+
+static ov::element::Type packedType(ov::element::Type weiType) {
+    switch (weiType) {
+    case u8:
+    case i8:
+        return u8;
+    case u4:
+    case i4:
+        return u4;
+    case nf4:
+    case f8e4m3:
+    case f8e5m2:
+        return weiType;
+    default:
+        OPENVINO_THROW("Unsupported weights precision for the decompression GEMV: ", weiType);
+    }
+}
+
+// Signed weights are shifted to the unsigned range, the shift is added to the zero points
+static float weightsShift(ov::element::Type weiType) {
+    switch (weiType) {
+    case i8:
+        return 128.F;
+    case i4:
+        return 8.F;
+    default:
+        return 0.F;
+    }
+}
+
+// f8e4m3 weights are decoded scaled by 2^-8 (see jit_gemv_decompress_kernel), the scales compensate it
+static float weightsScale(ov::element::Type weiType) {
+    return weiType == f8e4m3 ? 256.F : 1.F;
+}
+
+static size_t packedRowBytes(ov::element::Type type, size_t panel) {
+    return any_of(type, u4, nf4) ? panel / 2 : panel;
+}
+
+static size_t packedWeightsSize(ov::element::Type type, size_t N, size_t K) {
+    const size_t bytes = any_of(type, u4, nf4) ? N * K / 2 : N * K;
+    // scales follow the weights
+    return rnd_up(bytes, 64);
+}
+
+static std::vector<float> toF32(const MemoryCPtr& param) {
+    const auto count = param->getShape().getElementsCount();
+    std::vector<float> values(count);
+    cpu_convert(param->getData(), values.data(), param->getPrecision(), f32, count);
+    return values;
+}
+
+static MemoryPtr prepareWeightMemory(const MemoryArgs& memory,
+                                     const ExecutorContext::CPtr& context,
+                                     size_t N,
+                                     size_t K,
+                                     size_t panel,
+                                     size_t groups,
+                                     bool withZeroPoints,
+                                     bool weightsTransposed) {
+    DEBUG_LOG("DecompressGemvFCExecutor: pack weights");
+    const auto& weightsMemory = memory.at(ARG_WEI);
+    const auto scalesMemory = decompressionParam(memory, ARG_WEI | ARG_ATTR_SCALES);
+    const auto zpMemory = decompressionParam(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+    const auto weiType = weightsMemory->getPrecision();
+    const auto type = packedType(weiType);
+    const size_t panels = N / panel;
+    const size_t rowBytes = packedRowBytes(type, panel);
+    const size_t weightsSize = packedWeightsSize(type, N, K);
+    const size_t paramsCount = N * groups;
+
+    auto create = [&]() {
+        const size_t packedSize = weightsSize + paramsCount * sizeof(float) * (withZeroPoints ? 2 : 1);
+        MemoryPtr packed =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(u8, intel_cpu::Shape{packedSize}));
+        auto* packedWeights = packed->getDataAs<uint8_t>();
+        auto* packedScales = reinterpret_cast<float*>(packedWeights + weightsSize);
+        auto* packedZeroPoints = withZeroPoints ? packedScales + paramsCount : nullptr;
+
+        const auto* weights = weightsMemory->getDataAs<const uint8_t>();
+        const auto code = [&](size_t n, size_t k) -> uint8_t {
+            const size_t i = weightsTransposed ? n * K + k : k * N + n;
+            switch (weiType) {
+            case u8:
+            case f8e4m3:
+            case f8e5m2:
+                return weights[i];
+            case i8:
+                return static_cast<uint8_t>(weights[i] ^ 0x80);
+            default: {
+                // 4-bit values are packed along the flattened index, the odd ones in the high nibbles
+                const auto nibble = static_cast<uint8_t>((i % 2 != 0 ? weights[i / 2] >> 4 : weights[i / 2]) & 0xF);
+                return weiType == i4 ? static_cast<uint8_t>(nibble ^ 0x8) : nibble;
+            }
+            }
+        };
+
+        parallel_for(panels, [&](size_t p) {
+            auto* dst = packedWeights + p * K * rowBytes;
+            const size_t n0 = p * panel;
+            for (size_t k = 0; k < K; k++, dst += rowBytes) {
+                if (rowBytes == panel) {
+                    for (size_t c = 0; c < panel; c++) {
+                        dst[c] = code(n0 + c, k);
+                    }
+                } else {
+                    for (size_t c = 0; c < rowBytes; c++) {
+                        dst[c] = static_cast<uint8_t>(code(n0 + c, k) | (code(n0 + rowBytes + c, k) << 4));
+                    }
+                }
+            }
+        });
+
+        // [N, G] ([G, N] for the non transposed weights) or scalar source parameters to [panel][G][panel size]
+        const auto packParam = [&](const std::vector<float>& values, float shift, float factor, float* dst) {
+            const size_t paramGroups = values.size() == 1 ? 1 : values.size() / N;
+            for (size_t n = 0; n < N; n++) {
+                for (size_t g = 0; g < groups; g++) {
+                    const size_t pg = g * paramGroups / groups;
+                    const size_t src = values.size() == 1 ? 0 : (weightsTransposed ? n * paramGroups + pg : pg * N + n);
+                    dst[((n / panel) * groups + g) * panel + n % panel] = (values[src] + shift) * factor;
+                }
+            }
+        };
+        const float scale = weightsScale(weiType);
+        packParam(scalesMemory ? toF32(scalesMemory) : std::vector<float>{1.F}, 0.F, scale, packedScales);
+        if (withZeroPoints) {
+            packParam(zpMemory ? toF32(zpMemory) : std::vector<float>{0.F},
+                      weightsShift(weiType),
+                      1.F / scale,
+                      packedZeroPoints);
+        }
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        auto dataId = [](const MemoryCPtr& mem) {
+            return std::to_string(mem ? reinterpret_cast<uint64_t>(mem->getData()) : 0);
+        };
+        const std::string string_hash = "gemv_decompress_" + weiType.to_string() + "_" + std::to_string(N) + "_" +
+                                        std::to_string(K) + "_" + std::to_string(panel) + "_" +
+                                        std::to_string(groups) + "_" + std::to_string(weightsTransposed) + "_" +
+                                        dataId(weightsMemory) + "_" + dataId(scalesMemory) + "_" + dataId(zpMemory);
+        DEBUG_LOG("DecompressGemvFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("DecompressGemvFCExecutor: Weights cache is not available");
+    return create();
+}
+
+bool DecompressGemvFCExecutor::supports(const FCConfig& config) {
+    VERIFY(mayiuse(avx2), UNSUPPORTED_ISA);
+    VERIFY(any_of(srcType(config), f32, bf16, f16), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(any_of(weiType(config), u8, i8, u4, i4, nf4, f8e4m3, f8e5m2), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(any_of(dstType(config), f32, bf16, f16), UNSUPPORTED_DST_PRECISIONS);
+    VERIFY(config.attrs.constantWeights, "non constant weights are not supported");
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+
+    const auto& wei = weiDims(config);
+    VERIFY(supportsWeightsShape(wei[0], wei[1], 1), UNSUPPORTED_BY_EXECUTOR);
+
+    if (hasBias(config)) {
+        VERIFY(any_of(biaType(config), f32, bf16, f16), UNSUPPORTED_BIAS_PRECISIONS);
+        const auto& biasShape = config.descs.at(ARG_BIAS)->getShape();
+        VERIFY(biasShape.isStatic() && biasShape.getElementsCount() == wei[0], "only 'by channel' bias is supported");
+    }
+
+    return true;
+}
+
+bool DecompressGemvFCExecutor::supportsWeightsShape(size_t N, size_t K, size_t groups) {
+    return N % panelSize() == 0 && K % blockKMultiple == 0 && K % groups == 0 &&
+           (groups == 1 || (K / groups) % blockKMultiple == 0);
+}
+
+bool DecompressGemvFCExecutor::acceptsShapes([[maybe_unused]] const FCAttrs& attrs, const MemoryArgs& memory) {
+    const auto& weiDims = memory.at(ARG_WEI)->getStaticDims();
+    if (!decompressionGroups(memory, weiDims[0], weiDims[1])) {
+        return false;
+    }
+    const auto& srcShape = memory.at(ARG_SRC)->getShape();
+    if (!srcShape.isStatic()) {
+        return true;
+    }
+    return batchDim(srcShape.getStaticDims()) <= maxGemvRows;
+}
+
+DecompressGemvFCExecutor::DecompressGemvFCExecutor(const FCAttrs& attrs,
+                                                   const MemoryArgs& memory,
+                                                   const ExecutorContext::CPtr& context)
+    : N(memory.at(ARG_WEI)->getStaticDims()[0]),
+      K(memory.at(ARG_WEI)->getStaticDims()[1]),
+      m_panelSize(panelSize()),
+      m_groups(decompressionGroups(memory, N, K).value_or(1)),
+      m_blockK(blockSize(K, m_groups)),
+      m_packedType(packedType(memory.at(ARG_WEI)->getPrecision())),
+      m_withZeroPoints(decompressionParam(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS) ||
+                       weightsShift(memory.at(ARG_WEI)->getPrecision()) != 0.F),
+      m_bias(memory.at(ARG_BIAS)->getDesc().empty() ? std::vector<float>{} : toF32(memory.at(ARG_BIAS))),
+      m_packed(prepareWeightMemory(memory,
+                                   context,
+                                   N,
+                                   K,
+                                   m_panelSize,
+                                   m_groups,
+                                   m_withZeroPoints,
+                                   !attrs.weightsNonTransposed)),
+      m_weightsSize(packedWeightsSize(m_packedType, N, K)),
+      m_finished(N / m_panelSize) {}
+
+impl_desc_type DecompressGemvFCExecutor::implType() const {
+    return mayiuse(avx512_core) ? impl_desc_type::jit_gemv_avx512 : impl_desc_type::jit_gemv_avx2;
+}
+
+std::shared_ptr<kernel::JitKernelBase> DecompressGemvFCExecutor::getKernel(size_t rows) {
+    auto& ker = m_kernels[rows];
+    if (!ker) {
+        const kernel::jit_gemv_decompress_compile_params jcp{m_packedType, rows, m_withZeroPoints};
+        if (mayiuse(avx512_core)) {
+            ker = std::make_shared<kernel::jit_gemv_decompress_kernel<avx512_core>>(jcp);
+        } else {
+            ker = std::make_shared<kernel::jit_gemv_decompress_kernel<avx2>>(jcp);
+        }
+        ker->create_kernel();
+    }
+    return ker;
+}
+
+bool DecompressGemvFCExecutor::update(const MemoryArgs& memory) {
+    M = batchDim(memory.at(ARG_SRC)->getStaticDims());
+    OPENVINO_ASSERT(M <= maxGemvRows, "DecompressGemvFCExecutor does not support M = ", M);
+    if (M == 0) {
+        return true;
+    }
+
+    // split K until every thread has a range of its own, the ranges consist of whole blocks
+    const size_t panels = N / m_panelSize;
+    const size_t blocks = K / m_blockK;
+    const auto threads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t kSplit = std::min(blocks, div_up(threads, panels));
+    m_blocksPerSplit = div_up(blocks, kSplit);
+    m_kSplit = div_up(blocks, m_blocksPerSplit);
+
+    m_kernel = getKernel(M);
+    m_src.resize(K * M);
+    m_srcSums.resize(blocks * M);
+    m_partials.resize(panels * m_kSplit * M * m_panelSize);
+
+    return true;
+}
+
+template <typename T>
+void DecompressGemvFCExecutor::prepareSrc(const T* src) {
+    parallel_for(K / m_blockK, [&](size_t b) {
+        for (size_t m = 0; m < M; m++) {
+            float sum = 0.F;
+            for (size_t k = b * m_blockK; k < (b + 1) * m_blockK; k++) {
+                const auto value = static_cast<float>(src[m * K + k]);
+                m_src[k * M + m] = value;
+                sum += value;
+            }
+            m_srcSums[b * M + m] = sum;
+        }
+    });
+}
+
+template <typename T>
+void DecompressGemvFCExecutor::reducePanel(size_t panel, T* dst) const {
+    const auto* partials = m_partials.data() + panel * m_kSplit * M * m_panelSize;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t c = 0; c < m_panelSize; c++) {
+            const size_t n = panel * m_panelSize + c;
+            float value = m_bias.empty() ? 0.F : m_bias[n];
+            for (size_t s = 0; s < m_kSplit; s++) {
+                value += partials[(s * M + m) * m_panelSize + c];
+            }
+            dst[m * N + n] = static_cast<T>(value);
+        }
+    }
+}
+
+void DecompressGemvFCExecutor::execute(const MemoryArgs& memory) {
+    if (M == 0) {
+        return;
+    }
+    const auto& srcMemory = memory.at(ARG_SRC);
+    const auto& dstMemory = memory.at(ARG_DST);
+
+    switch (srcMemory->getPrecision()) {
+    case f32:
+        prepareSrc(srcMemory->getDataAs<const float>());
+        break;
+    case bf16:
+        prepareSrc(srcMemory->getDataAs<const ov::bfloat16>());
+        break;
+    case f16:
+        prepareSrc(srcMemory->getDataAs<const ov::float16>());
+        break;
+    default:
+        OPENVINO_THROW("DecompressGemvFCExecutor: unsupported src precision ", srcMemory->getPrecision());
+    }
+
+    const auto reduce = [&](size_t panel) {
+        switch (dstMemory->getPrecision()) {
+        case f32:
+            reducePanel(panel, dstMemory->getDataAs<float>());
+            break;
+        case bf16:
+            reducePanel(panel, dstMemory->getDataAs<ov::bfloat16>());
+            break;
+        case f16:
+            reducePanel(panel, dstMemory->getDataAs<ov::float16>());
+            break;
+        default:
+            OPENVINO_THROW("DecompressGemvFCExecutor: unsupported dst precision ", dstMemory->getPrecision());
+        }
+    };
+
+    const size_t panels = N / m_panelSize;
+    const size_t blocks = K / m_blockK;
+    const size_t rowBytes = packedRowBytes(m_packedType, m_panelSize);
+    const size_t paramsCount = N * m_groups;
+    const auto* packedWeights = m_packed->getDataAs<const uint8_t>();
+    const auto* packedScales = reinterpret_cast<const float*>(packedWeights + m_weightsSize);
+    const auto* packedZeroPoints = m_withZeroPoints ? packedScales + paramsCount : nullptr;
+
+    parallel_for2d(panels, m_kSplit, [&](size_t p, size_t s) {
+        const size_t b0 = s * m_blocksPerSplit;
+        const size_t b1 = std::min(blocks, b0 + m_blocksPerSplit);
+        const size_t params = (p * m_groups + (m_groups > 1 ? b0 : 0)) * m_panelSize;
+
+        kernel::jit_gemv_decompress_call_args args{};
+        args.src = m_src.data() + b0 * m_blockK * M;
+        args.xsum = m_srcSums.data() + b0 * M;
+        args.wei = packedWeights + (p * K + b0 * m_blockK) * rowBytes;
+        args.scales = packedScales + params;
+        args.zero_points = packedZeroPoints ? packedZeroPoints + params : nullptr;
+        args.dst = m_partials.data() + (p * m_kSplit + s) * M * m_panelSize;
+        args.scale_stride = m_groups > 1 ? m_panelSize * sizeof(float) : 0;
+        args.blocks = b1 - b0;
+        args.block_k = m_blockK;
+        (*m_kernel)(&args);
+
+        // the last K range of the panel reduces the partial sums, the counter is reset for the next inference
+        if (m_kSplit == 1 || m_finished[p].fetch_add(1, std::memory_order_acq_rel) + 1 == m_kSplit) {
+            m_finished[p].store(0, std::memory_order_relaxed);
+            reduce(p);
+        }
+    });
+}
+
+void DecompressGemvFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_packed, numaNodeID);
+}
+
+}  // namespace ov::intel_cpu
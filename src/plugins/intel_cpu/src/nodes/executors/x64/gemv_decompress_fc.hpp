@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected executor for the decode phase of LLMs: M <= 4 rows against u8 / i8 / u4 / i4 / nf4 / f8e4m3 / f8e5m2
+ * weights with per channel or grouped scales and zero points.
+ * Such a layer is bound by the weights bandwidth, so the work is split over the panels of output channels and
+ * over K, until every core streams its own contiguous range of the pre-packed weights
+ * (see jit_gemv_decompress_call_args). The partial sums of a panel are reduced by the thread finishing the panel
+ * last, without any barrier.
+ */
+class DecompressGemvFCExecutor : public Executor {
+public:
+    DecompressGemvFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+    static bool acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory);
+    // [N, K] weights split into `groups` blocks along K which the packed layout can hold
+    static bool supportsWeightsShape(size_t N, size_t K, size_t groups);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {{m_packed->getData(), m_weightsSize}};
+    }
+
+private:
+    std::shared_ptr<kernel::JitKernelBase> getKernel(size_t M);
+    template <typename T>
+    void prepareSrc(const T* src);
+    template <typename T>
+    void reducePanel(size_t panel, T* dst) const;
+
+    const size_t N;
+    const size_t K;
+    const size_t m_panelSize;
+    const size_t m_groups;
+    const size_t m_blockK;
+    const ov::element::Type m_packedType;
+    const bool m_withZeroPoints;
+    const std::vector<float> m_bias;
+    // packed weights | f32 scales | f32 zero points
+    const MemoryCPtr m_packed;
+    const size_t m_weightsSize;
+
+    size_t M = 0;
+    size_t m_kSplit = 1;
+    size_t m_blocksPerSplit = 0;
+    std::shared_ptr<kernel::JitKernelBase> m_kernel;
+    std::unordered_map<size_t, std::shared_ptr<kernel::JitKernelBase>> m_kernels;
+    // activations transposed to [K][M] and their sums per block of K
+    std::vector<float> m_src;
+    std::vector<float> m_srcSums;
+    // [panel][k split][M][panel size] partial sums
+    std::vector<float> m_partials;
+    // number of finished K ranges per panel
+    std::vector<std::atomic<size_t>> m_finished;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
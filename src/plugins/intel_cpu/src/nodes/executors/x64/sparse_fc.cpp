@@ -0,0 +1,289 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc.hpp"
+
+#include <algorithm>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "nodes/kernels/x64/sparse_fc_kernel.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::element;
+
+// The sparse kernels save the weights bandwidth at the cost of a broadcast of the activations per weights step, while
+// the dense brgemm kernels reuse every weights vector for up to 28 rows. Above 32 rows (two row blocks of the AVX-512
+// kernel, four of the AVX2 one) the FullyConnected is compute bound and the dense kernels win even at 50% sparsity.
+// See the FCStructuredSparseBenchmark functional test
+static constexpr size_t maxSparseFCRows = 32;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1U, Dim{1}, std::multiplies<>());
+}
+
+static size_t kStep(FCSparsityPattern pattern) {
+    return pattern == FCSparsityPattern::Block1x16 ? 1 : 4;
+}
+
+namespace {
+
+// Packed weights: [panels + 1] step prefix (u64) | step values (f32) | step offsets (i32) | 2:4 metadata (u8)
+struct PackedWeightsView {
+    const uint64_t* stepsBegin;
+    const float* values;
+    const int32_t* offsets;
+    const uint8_t* meta;
+
+    PackedWeightsView(const MemoryCPtr& packed, FCSparsityPattern pattern, size_t panels) {
+        stepsBegin = packed->getDataAs<const uint64_t>();
+        const auto totalSteps = stepsBegin[panels];
+        values = reinterpret_cast<const float*>(stepsBegin + panels + 1);
+        offsets = reinterpret_cast<const int32_t*>(values + totalSteps * kernel::sparse_fc_step_values(pattern));
+        meta = pattern == FCSparsityPattern::Structured2x4 ? reinterpret_cast<const uint8_t*>(offsets + totalSteps)
+                                                           : nullptr;
+    }
+};
+
+}  // namespace
+
+static MemoryPtr prepareWeightMemory(const MemoryPtr& weightsMemory,
+                                     const ExecutorContext::CPtr& context,
+                                     FCSparsityPattern pattern,
+                                     size_t N,
+                                     size_t K) {
+    DEBUG_LOG("SparseFCExecutor: compress weights");
+    const size_t panelSize = kernel::sparse_fc_panel_size(pattern);
+    const size_t stepValues = kernel::sparse_fc_step_values(pattern);
+    const size_t kStepSize = kStep(pattern);
+    const size_t panels = N / panelSize;
+    const size_t steps = K / kStepSize;
+
+    auto create = [&]() {
+        const auto* weights = weightsMemory->getDataAs<const float>();
+        auto isZeroStep = [&](size_t p, size_t s) {
+            for (size_t n = p * panelSize; n < (p + 1) * panelSize; n++) {
+                const auto* row = weights + n * K + s * kStepSize;
+                if (std::any_of(row, row + kStepSize, [](float w) {
+                        return w != 0.0F;
+                    })) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<uint64_t> stepsBegin(panels + 1, 0);
+        parallel_for(panels, [&](size_t p) {
+            uint64_t nonZeroSteps = 0;
+            for (size_t s = 0; s < steps; s++) {
+                nonZeroSteps += isZeroStep(p, s) ? 0 : 1;
+            }
+            stepsBegin[p + 1] = nonZeroSteps;
+        });
+        std::partial_sum(stepsBegin.begin(), stepsBegin.end(), stepsBegin.begin());
+        const auto totalSteps = stepsBegin[panels];
+
+        const size_t metaSize = pattern == FCSparsityPattern::Structured2x4 ? panelSize : 0;
+        const size_t packedSize = (panels + 1) * sizeof(uint64_t) +
+                                  totalSteps * (stepValues * sizeof(float) + sizeof(int32_t) + metaSize);
+        MemoryPtr packed =
+            std::make_shared<Memory>(context->getEngine(), CpuBlockedMemoryDesc(i8, intel_cpu::Shape{packedSize}));
+        std::copy(stepsBegin.begin(), stepsBegin.end(), packed->getDataAs<uint64_t>());
+        const PackedWeightsView view(packed, pattern, panels);
+        auto* values = const_cast<float*>(view.values);
+        auto* offsets = const_cast<int32_t*>(view.offsets);
+        auto* meta = const_cast<uint8_t*>(view.meta);
+
+        DEBUG_LOG("SparseFCExecutor: non-zero steps ", totalSteps, " of ", panels * steps);
+
+        parallel_for(panels, [&](size_t p) {
+            auto step = stepsBegin[p];
+            for (size_t s = 0; s < steps; s++) {
+                if (isZeroStep(p, s)) {
+                    continue;
+                }
+                const size_t k0 = s * kStepSize;
+                auto* stepValuesPtr = values + step * stepValues;
+                offsets[step] = static_cast<int32_t>(k0 * sizeof(float));
+                for (size_t n = 0; n < panelSize; n++) {
+                    const auto* row = weights + (p * panelSize + n) * K + k0;
+                    switch (pattern) {
+                    case FCSparsityPattern::Block1x16:
+                        stepValuesPtr[n] = row[0];
+                        break;
+                    case FCSparsityPattern::Block4x4:
+                        std::copy(row, row + kStepSize, stepValuesPtr + n * kStepSize);
+                        break;
+                    case FCSparsityPattern::Structured2x4: {
+                        // positions of the (at most) two non-zero values, the rest of the positions are zero
+                        uint8_t idx[2] = {0, 1};
+                        size_t nonZeros = 0;
+                        for (uint8_t i = 0; i < kStepSize; i++) {
+                            if (row[i] != 0.0F) {
+                                OPENVINO_ASSERT(nonZeros < 2, "Weights do not satisfy 2:4 structured sparsity");
+                                idx[nonZeros++] = i;
+                            }
+                        }
+                        if (nonZeros == 1 && idx[1] <= idx[0]) {
+                            idx[1] = idx[0] == 0 ? 1 : 0;
+                        }
+                        stepValuesPtr[n] = row[idx[0]];
+                        stepValuesPtr[panelSize + n] = row[idx[1]];
+                        meta[step * panelSize + n] = static_cast<uint8_t>(idx[0] | (idx[1] << 2));
+                        break;
+                    }
+                    default:
+                        OPENVINO_THROW("Unsupported sparsity pattern");
+                    }
+                }
+                step++;
+            }
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = "sparse_fc_" + std::to_string(static_cast<int>(pattern)) + "_" +
+                                        std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("SparseFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("SparseFCExecutor: Weights cache is not available");
+    return create();
+}
+
+bool SparseFCExecutor::supports(const FCConfig& config) {
+    const auto pattern = config.attrs.sparsityPattern;
+    VERIFY(pattern != FCSparsityPattern::None, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(mayiuse(avx2), UNSUPPORTED_ISA);
+    VERIFY(all_of(f32, srcType(config), weiType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(!config.attrs.weightsNonTransposed, "non transposed weights are not supported");
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+
+    const auto& wei = weiDims(config);
+    VERIFY(wei[0] % kernel::sparse_fc_panel_size(pattern) == 0 && wei[1] % 4 == 0, UNSUPPORTED_BY_EXECUTOR);
+
+    if (hasBias(config)) {
+        VERIFY(biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+        const auto& biasShape = config.descs.at(ARG_BIAS)->getShape();
+        VERIFY(biasShape.isStatic() && biasShape.getElementsCount() == wei[0], "only 'by channel' bias is supported");
+    }
+
+    return true;
+}
+
+bool SparseFCExecutor::acceptsShapes([[maybe_unused]] const FCAttrs& attrs, const MemoryArgs& memory) {
+    const auto& srcShape = memory.at(ARG_SRC)->getShape();
+    if (!srcShape.isStatic()) {
+        return true;
+    }
+    return batchDim(srcShape.getStaticDims()) <= maxSparseFCRows;
+}
+
+SparseFCExecutor::SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_pattern(attrs.sparsityPattern),
+      N(memory.at(ARG_WEI)->getStaticDims()[0]),
+      K(memory.at(ARG_WEI)->getStaticDims()[1]),
+      m_packedWeights(prepareWeightMemory(memory.at(ARG_WEI), context, m_pattern, N, K)),
+      m_withBias(!memory.at(ARG_BIAS)->getDesc().empty()) {}
+
+impl_desc_type SparseFCExecutor::implType() const {
+    return mayiuse(avx512_core) ? impl_desc_type::jit_sparse_avx512 : impl_desc_type::jit_sparse_avx2;
+}
+
+std::shared_ptr<kernel::JitKernelBase> SparseFCExecutor::getKernel(size_t mBlock) {
+    auto& ker = m_kernels[mBlock];
+    if (!ker) {
+        const kernel::jit_sparse_fc_compile_params jcp{m_pattern, mBlock, m_withBias};
+        if (mayiuse(avx512_core)) {
+            ker = std::make_shared<kernel::jit_sparse_fc_kernel<avx512_core>>(jcp);
+        } else {
+            ker = std::make_shared<kernel::jit_sparse_fc_kernel<avx2>>(jcp);
+        }
+        ker->create_kernel();
+    }
+    return ker;
+}
+
+bool SparseFCExecutor::update(const MemoryArgs& memory) {
+    M = batchDim(memory.at(ARG_SRC)->getStaticDims());
+
+    const size_t maxMBlock = mayiuse(avx512_core) ? kernel::jit_sparse_fc_kernel<avx512_core>::max_m_block
+                                                  : kernel::jit_sparse_fc_kernel<avx2>::max_m_block;
+    m_mBlock = std::max<size_t>(std::min(M, maxMBlock), 1);
+    m_mainKernel = getKernel(m_mBlock);
+    m_tailKernel = M % m_mBlock != 0 ? getKernel(M % m_mBlock) : nullptr;
+
+    return true;
+}
+
+void SparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+
+    const size_t panelSize = kernel::sparse_fc_panel_size(m_pattern);
+    const size_t stepValues = kernel::sparse_fc_step_values(m_pattern);
+    const size_t panels = N / panelSize;
+    const PackedWeightsView weights(m_packedWeights, m_pattern, panels);
+
+    parallel_for2d(div_up(M, m_mBlock), panels, [&](size_t mb, size_t p) {
+        const size_t m0 = mb * m_mBlock;
+        const auto& ker = m0 + m_mBlock <= M ? m_mainKernel : m_tailKernel;
+        const auto step0 = weights.stepsBegin[p];
+
+        kernel::jit_sparse_fc_call_args args{};
+        args.src = src + m0 * K;
+        args.wei = weights.values + step0 * stepValues;
+        args.offsets = weights.offsets + step0;
+        args.meta = weights.meta ? weights.meta + step0 * panelSize : nullptr;
+        args.bias = bias ? bias + p * panelSize : nullptr;
+        args.dst = dst + m0 * N + p * panelSize;
+        args.src_stride = K * sizeof(float);
+        args.dst_stride = N * sizeof(float);
+        args.steps = weights.stepsBegin[p + 1] - step0;
+        (*ker)(&args);
+    });
+}
+
+void SparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (m_withBias) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
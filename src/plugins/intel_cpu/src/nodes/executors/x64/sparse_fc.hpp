@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected executor for f32 weights with a structured sparsity pattern (2:4, 1x16 or 4x4 blocks).
+ * The weights are compressed into panels of non-zero steps (see jit_sparse_fc_compile_params) once
+ * and shared through the weights cache, so the kernel skips the zero blocks entirely.
+ */
+class SparseFCExecutor : public Executor {
+public:
+    SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+    static bool acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {{m_packedWeights->getData(), m_packedWeights->getSize()}};
+    }
+
+private:
+    std::shared_ptr<kernel::JitKernelBase> getKernel(size_t mBlock);
+
+    const MemoryArgs& m_memoryArgs;
+    const FCSparsityPattern m_pattern;
+    const size_t N;
+    const size_t K;
+    const MemoryCPtr m_packedWeights;
+    const bool m_withBias;
+    size_t M = 0;
+    size_t m_mBlock = 1;
+    // kernels are compiled per number of rows, so the dynamic M does not trigger recompilation of the known blocks
+    std::unordered_map<size_t, std::shared_ptr<kernel::JitKernelBase>> m_kernels;
+    std::shared_ptr<kernel::JitKernelBase> m_mainKernel;
+    std::shared_ptr<kernel::JitKernelBase> m_tailKernel;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
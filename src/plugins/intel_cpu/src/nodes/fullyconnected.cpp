@@ -51,6 +51,9 @@
 #include "transformations/utils/utils.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/gemv_decompress_fc.hpp"
+#endif
 #if defined(OV_CPU_WITH_KLEIDIAI)
 #    include "openvino/core/shape.hpp"
 #    include "utils/arm_isa_support.h"
@@ -156,6 +159,17 @@ bool FullyConnected::isSupportedCompressedOperation([[maybe_unused]] const std::
             return false;
         }
 
+        // f8 weights are decompressed by the GEMV executor (M <= 4) and the MLAS decompression GEMM executor only,
+        // which do not depend on the oneDNN limitations
+        if (any_of(op->get_input_element_type(WEIGHTS), ov::element::f8e4m3, ov::element::f8e5m2)) {
+#    if defined(OV_CPU_WITH_MLAS)
+            return op->get_input_partial_shape(WEIGHTS).rank().get_length() == 2 &&
+                   DecompressGemvFCExecutor::supportsWeightsShape(OC, IC, G);
+#    else
+            return false;
+#    endif
+        }
+
         if (ov::with_cpu_x86_avx512_core_amx() && config.inferencePrecision == ov::element::bf16) {
             // OneDNN AMX IP implementation has limited shapes support due to performance considerations. As a
             // current solution conditions below are copied from OneDNN to make sure correct IP impl will be
@@ -437,6 +451,10 @@ void FullyConnected::executeDynamicImpl(const dnnl::stream& strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the executor of the f8 weights does not apply post ops
+    if (any_of(getOriginalInputPrecisionAtPort(WEIGHTS), ov::element::f8e4m3, ov::element::f8e5m2)) {
+        return false;
+    }
     if (node->getType() == Type::FakeQuantize) {
         auto* fq = dynamic_cast<FakeQuantize*>(node.get());
         if (!fq) {
@@ -476,6 +494,10 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::jit_sparse_avx512,
+        impl_desc_type::jit_sparse_avx2,
+        impl_desc_type::jit_gemv_avx512,
+        impl_desc_type::jit_gemv_avx2,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgconv_avx512_1x1,
         impl_desc_type::brgemm_avx512,
@@ -569,10 +591,94 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     return sparseRate >= minSparseRate;
 }
 
+// Returns true if the rate of zero blockN x blockK blocks of the weights [N, K] is at least minRate.
+// Called for the sampled rows only, so the dense weights still cost up to (1 - minRate) of the sample to reject
+static bool hasZeroBlocks(const float* weights, size_t N, size_t K, size_t blockN, size_t blockK, float minRate) {
+    const size_t blocksCount = (N / blockN) * (K / blockK);
+    const auto maxNonZeroBlocks = static_cast<size_t>(static_cast<float>(blocksCount) * (1.F - minRate));
+    size_t nonZeroBlocks = 0;
+    for (size_t n = 0; n < N; n += blockN) {
+        for (size_t k = 0; k < K; k += blockK) {
+            bool isZero = true;
+            for (size_t bn = 0; bn < blockN && isZero; bn++) {
+                const auto* row = weights + (n + bn) * K + k;
+                isZero = std::all_of(row, row + blockK, [](float w) {
+                    return w == 0.F;
+                });
+            }
+            if (!isZero && ++nonZeroBlocks > maxNonZeroBlocks) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static FCSparsityPattern detectSparsityPattern(const NodePtr& weightsInput, const ov::element::Type inputType) {
+    // Skipping the zero blocks pays off only if at least a half of the blocks are zero
+    static constexpr float minZeroBlocksRate = 0.5F;
+    // The block patterns are detected on the first rows only, so the check never reads the whole weights of a dense FC.
+    // The block sparse packing skips exactly the zero blocks found, so the sampled rate is only a heuristic
+    static constexpr size_t sampledRows = 256;
+
+    if (!ov::with_cpu_x86_avx2()) {
+        return FCSparsityPattern::None;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode) {
+        return FCSparsityPattern::None;
+    }
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+
+    const auto& weiDims = weiMemory->getShape().getStaticDims();
+    if (weiDims.size() != 2 || weiDims[1] % 4 != 0 || weiMemory->getPrecision() != f32 || inputType != f32) {
+        return FCSparsityPattern::None;
+    }
+
+    const auto* const weights = weiMemory->getDataAs<const float>();
+    const auto N = weiDims[0];
+    const auto K = weiDims[1];
+
+    // either all the rows or a multiple of 16 rows, so the sample consists of whole blocks of both block patterns
+    const auto sampleN = std::min(N, sampledRows);
+
+    // 2:4 sparsity is exact: every group of 4 consecutive values along K contains at least 2 zeros.
+    // The rest of the rows is checked only if the sampled ones are 2:4 sparse
+    const auto is2x4Rows = [&](size_t beginRow, size_t endRow) {
+        for (size_t i = beginRow * K; i < endRow * K; i += 4) {
+            if (std::count(weights + i, weights + i + 4, 0.F) < 2) {
+                return false;
+            }
+        }
+        return true;
+    };
+    const bool is2x4 = N % 16 == 0 && is2x4Rows(0, sampleN) && is2x4Rows(sampleN, N);
+
+    FCSparsityPattern pattern = FCSparsityPattern::None;
+    if (is2x4) {
+        pattern = FCSparsityPattern::Structured2x4;
+    } else if (N % 16 == 0 && hasZeroBlocks(weights, sampleN, K, 16, 1, minZeroBlocksRate)) {
+        pattern = FCSparsityPattern::Block1x16;
+    } else if (N % 4 == 0 && hasZeroBlocks(weights, sampleN, K, 4, 4, minZeroBlocksRate)) {
+        pattern = FCSparsityPattern::Block4x4;
+    }
+
+    DEBUG_LOG("Structured sparsity pattern = ", static_cast<int>(pattern));
+
+    return pattern;
+}
+
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    if (context->getConfig().fcStructuredSparsity && !attrs.sparseWeights && !tp_cfg.enable_tensor_parallel) {
+        attrs.sparsityPattern =
+            detectSparsityPattern(getParentEdgeAt(WEIGHTS)->getParent(), getOriginalInputPrecisionAtPort(DATA));
+    }
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
 
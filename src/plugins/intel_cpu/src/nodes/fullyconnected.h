@@ -84,6 +84,10 @@ public:
         return !isInputTensorAtPortEmpty(0);
     }
 
+    MemoryRegions getWeightsRegions() const override {
+        return executor ? executor->weightsRegions() : MemoryRegions{};
+    }
+
     void prepareParams() override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
     bool canBeExecutedInInt8() const override;
@@ -1,14 +1,18 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
 #include "utils/plain_tensor.hpp"
 
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -45,6 +49,37 @@ void attn_copy(TA* a, TB* b, size_t n) {
     }
 }
 
+// float8 <- float, saturated to the largest finite value since f8e4m3 has no infinity and overflows to NaN
+template <typename TF8, typename T>
+static void attn_copy_f8(TF8* a, const T* b, size_t n) {
+    const auto max = static_cast<float>(std::numeric_limits<TF8>::max());
+    for (size_t i = 0; i < n; i++) {
+        a[i] = TF8(std::clamp(static_cast<float>(b[i]), -max, max));
+    }
+}
+
+template <typename TF8>
+static void attn_memcpy2d_f8(void* src,
+                             TF8* dst,
+                             ov::element::Type src_type,
+                             size_t src_stride,
+                             size_t dst_stride,
+                             size_t width,
+                             size_t height) {
+    for (size_t j = 0; j < height; j++, dst += dst_stride) {
+        const size_t offset = j * src_stride;
+        if (src_type == ov::element::f32) {
+            attn_copy_f8(dst, reinterpret_cast<float*>(src) + offset, width);
+        } else if (src_type == ov::element::bf16) {
+            attn_copy_f8(dst, reinterpret_cast<ov::bfloat16*>(src) + offset, width);
+        } else if (src_type == ov::element::f16) {
+            attn_copy_f8(dst, reinterpret_cast<ov::float16*>(src) + offset, width);
+        } else {
+            OPENVINO_THROW("unsupport src type: ", src_type, " for f8 dst type in attn_memcpy2d_kernel");
+        }
+    }
+}
+
 template <typename T, typename T2>
 void attn_memcpy_kernel(const ov::intel_cpu::PlainTensor& k_input,
                         const ov::intel_cpu::PlainTensor& v_input,
@@ -237,6 +272,10 @@ void attn_memcpy2d_kernel(void* src,
             dst_f += dst_stride;
             src_f += src_stride;
         }
+    } else if (dst_type == ov::element::f8e4m3) {
+        attn_memcpy2d_f8(src, reinterpret_cast<ov::float8_e4m3*>(dst), src_type, src_stride, dst_stride, width, height);
+    } else if (dst_type == ov::element::f8e5m2) {
+        attn_memcpy2d_f8(src, reinterpret_cast<ov::float8_e5m2*>(dst), src_type, src_stride, dst_stride, width, height);
     } else {
         OPENVINO_THROW("unsupport src type: ", src_type, ", dst type: ", dst_type, " in attn_memcpy2d_kernel");
     }
@@ -25,7 +25,7 @@ void paged_attn_memcpy(const ov::intel_cpu::PlainTensor& k_input,
                        const ov::intel_cpu::CpuParallelPtr& cpu_parallel);
 
 // Per-tensor (K or V) copy into cache at position L0, parallelized over B×H.
-// Handles same-precision memcpy and f32→f16/bf16 SIMD conversion.
+// Handles same-precision memcpy, f32→f16/bf16 SIMD conversion and the saturating conversion to f8.
 void attn_memcpy2d(const ov::intel_cpu::PlainTensor& src,
                    const ov::intel_cpu::PlainTensor& dst,
                    size_t L0,
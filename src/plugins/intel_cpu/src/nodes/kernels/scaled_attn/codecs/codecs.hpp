@@ -203,7 +203,7 @@ struct U4Decoder {
     }
 };
 
-// Raw decoder: typed load + convert for uncompressed cache (f32/f16/bf16). Stateless.
+// Raw decoder: typed load + convert for uncompressed cache (f32/f16/bf16/f8). Stateless.
 // Ignores params — raw data needs no dequantization.
 template <typename KT>
 struct RawDecoder {
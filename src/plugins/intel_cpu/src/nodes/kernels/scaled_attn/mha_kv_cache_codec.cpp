@@ -540,6 +540,12 @@ static void dispatch_codec(const CacheSpec& spec,
         case ov::element::f32:
             process_tokens(RecordView<RawDecoder<float>>{{}});
             break;
+        case ov::element::f8e4m3:
+            process_tokens(RecordView<RawDecoder<ov::float8_e4m3>>{{}});
+            break;
+        case ov::element::f8e5m2:
+            process_tokens(RecordView<RawDecoder<ov::float8_e5m2>>{{}});
+            break;
         default:
             OPENVINO_THROW("Unsupported SCALAR precision: ", spec.precision);
         }
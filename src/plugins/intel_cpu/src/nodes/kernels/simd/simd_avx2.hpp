@@ -106,6 +106,20 @@ inline vec<float, isa::avx2> load(const ov::bfloat16* p, vec<float, isa::avx2>*
 inline vec<float, isa::avx2> load(const uint8_t* p, vec<float, isa::avx2>* /*tag*/) {
     return {_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))))};
 }
+// f8 → f32 through f16: e5m2 is the upper byte of an f16, e4m3 is moved under the f16 exponent and rescaled by
+// 2^8 (the difference of the exponent biases). The e4m3 NaN code is patched to an f16 NaN before the conversion.
+inline vec<float, isa::avx2> load(const ov::float8_e5m2* p, vec<float, isa::avx2>* /*tag*/) {
+    auto raw = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    return {_mm256_cvtph_ps(_mm_slli_epi16(raw, 8))};
+}
+inline vec<float, isa::avx2> load(const ov::float8_e4m3* p, vec<float, isa::avx2>* /*tag*/) {
+    // the sign extension moves the sign to bit 15 after the shift, bit 14 (f16 exponent MSB) is cleared
+    auto raw = _mm_cvtepi8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    auto bits = _mm_and_si128(_mm_slli_epi16(raw, 7), _mm_set1_epi16(static_cast<int16_t>(0xBF80)));
+    auto nan = _mm_cmpeq_epi16(_mm_and_si128(raw, _mm_set1_epi16(0x7F)), _mm_set1_epi16(0x7F));
+    bits = _mm_or_si128(bits, _mm_and_si128(nan, _mm_set1_epi16(0x7E00)));
+    return {_mm256_mul_ps(_mm256_cvtph_ps(bits), _mm256_set1_ps(256.0F))};
+}
 inline vec<float, isa::avx2> partial_load(uint32_t k, const float* p, vec<float, isa::avx2>* /*tag*/) {
     const __m256i bit_masks = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
     __m256i kmask =
@@ -103,6 +103,18 @@ inline vec<float, isa::avx512> load(const ov::bfloat16* p, vec<float, isa::avx51
 inline vec<float, isa::avx512> load(const uint8_t* p, vec<float, isa::avx512>* /*tag*/) {
     return {_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))))};
 }
+// f8 → f32 through f16, see the AVX2 version
+inline vec<float, isa::avx512> load(const ov::float8_e5m2* p, vec<float, isa::avx512>* /*tag*/) {
+    auto raw = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    return {_mm512_cvtph_ps(_mm256_slli_epi16(raw, 8))};
+}
+inline vec<float, isa::avx512> load(const ov::float8_e4m3* p, vec<float, isa::avx512>* /*tag*/) {
+    auto raw = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    auto bits = _mm256_and_si256(_mm256_slli_epi16(raw, 7), _mm256_set1_epi16(static_cast<int16_t>(0xBF80)));
+    auto nan = _mm256_cmpeq_epi16(_mm256_and_si256(raw, _mm256_set1_epi16(0x7F)), _mm256_set1_epi16(0x7F));
+    bits = _mm256_or_si256(bits, _mm256_and_si256(nan, _mm256_set1_epi16(0x7E00)));
+    return {_mm512_mul_ps(_mm512_cvtph_ps(bits), _mm512_set1_ps(256.0F))};
+}
 inline vec<float, isa::avx512> partial_load(uint32_t k, const float* p, vec<float, isa::avx512>* /*tag*/) {
     return {_mm512_maskz_loadu_ps(static_cast<__mmask16>(k), p)};
 }
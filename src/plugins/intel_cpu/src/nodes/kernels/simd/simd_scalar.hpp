@@ -11,6 +11,8 @@
 
 #include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
 #include "simd_common.hpp"
 
 namespace ov::Extensions::Cpu::XARCH::simd {
@@ -86,6 +88,12 @@ inline vec<float, isa::scalar> load(const ov::float16* p, vec<float, isa::scalar
 inline vec<float, isa::scalar> load(const ov::bfloat16* p, vec<float, isa::scalar>* /*tag*/) {
     return {static_cast<float>(*p)};
 }
+inline vec<float, isa::scalar> load(const ov::float8_e4m3* p, vec<float, isa::scalar>* /*tag*/) {
+    return {static_cast<float>(*p)};
+}
+inline vec<float, isa::scalar> load(const ov::float8_e5m2* p, vec<float, isa::scalar>* /*tag*/) {
+    return {static_cast<float>(*p)};
+}
 inline vec<float, isa::scalar> load(const uint8_t* p, vec<float, isa::scalar>* /*tag*/) {
     return {static_cast<float>(*p)};
 }
@@ -23,6 +23,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <openvino/core/except.hpp>
 
+#include "cache/jit_kernel_registry.h"
 #include "dnnl_extension_utils.h"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
@@ -319,7 +320,11 @@ void BrgemmKernel::init_brgemm(brgemmCtx& ctx,
     ctx.has_post_ops = false;
 
     brgemm_kernel_t* brgKernel_ = nullptr;
-    status = brgemm_kernel_create(&brgKernel_, brgDesc);
+    JitKernelRegistry::instance().codegen("brgemm", [&]() {
+        status = brgemm_kernel_create(&brgKernel_, brgDesc);
+        const auto* generator = brgKernel_ ? brgKernel_->get_jit_generator() : nullptr;
+        return generator ? generator->getSize() : 0;
+    });
     if (status != dnnl_success) {
         THROW_ERROR("cannot be executed due to invalid brgconv params");
     }
@@ -0,0 +1,227 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gemv_decompress_kernel.hpp"
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/nf4.hpp"
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace ov::intel_cpu::kernel {
+
+#define GET_OFF(field) offsetof(jit_gemv_decompress_call_args, field)
+
+// the weights stream is prefetched ahead of the hardware prefetcher, which restarts on every short K range
+static constexpr size_t prefetch_distance = 1024;
+
+template <cpu_isa_t isa>
+jit_gemv_decompress_kernel<isa>::jit_gemv_decompress_kernel(const jit_gemv_decompress_compile_params& jcp)
+    : JitKernel(jit_name(), jcp, isa) {
+    for (size_t i = 0; i < m_nf4_lut.size(); i++) {
+        m_nf4_lut[i] = ConvertNF4::dequantize(static_cast<uint8_t>(i));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_gemv_decompress_kernel<isa>::nf4_lookup(const Vmm& vmm) {
+    if constexpr (isa == avx512_core) {
+        vpermps(vmm, vmm, vmm_lut_lo);
+    } else {
+        // vpermps selects by the lowest 3 bits of the code, the 4th bit chooses between the halves of the table
+        vpcmpgtd(vmm_x, vmm, vmm_seven);
+        vpermps(vmm_tmp, vmm, vmm_lut_hi);
+        vpermps(vmm, vmm, vmm_lut_lo);
+        vblendvps(vmm, vmm, vmm_tmp, vmm_x);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_gemv_decompress_kernel<isa>::load_f8(const Vmm& vmm, size_t offset) {
+    const Vmm_half half(vmm.getIdx());
+    if (m_jcp.wei_type == ov::element::f8e5m2) {
+        // f8e5m2 is the upper byte of an f16
+        vpmovzxbw(half, ptr[reg_wei + offset]);
+        vpsllw(half, half, 8);
+    } else {
+        // the sign extension moves the sign to bit 15 after the shift, bit 14 (f16 exponent MSB) is cleared
+        vpmovsxbw(half, ptr[reg_wei + offset]);
+        vpsllw(half, half, 7);
+        vpand(half, half, Vmm_half(vmm_f8_mask.getIdx()));
+    }
+    vcvtph2ps(vmm, half);
+}
+
+template <cpu_isa_t isa>
+void jit_gemv_decompress_kernel<isa>::load_weights(size_t offset) {
+    if (any_of(m_jcp.wei_type, ov::element::f8e4m3, ov::element::f8e5m2)) {
+        load_f8(vmm_w(0), offset);
+        load_f8(vmm_w(1), offset + vec_size);
+        return;
+    }
+    if (m_jcp.wei_type == ov::element::u8) {
+        vpmovzxbd(vmm_w(0), ptr[reg_wei + offset]);
+        vpmovzxbd(vmm_w(1), ptr[reg_wei + offset + vec_size]);
+    } else {
+        vpmovzxbd(vmm_w(0), ptr[reg_wei + offset]);
+        uni_vpsrld(vmm_w(1), vmm_w(0), 4);
+        uni_vpand(vmm_w(0), vmm_w(0), vmm_mask);
+    }
+    for (size_t j = 0; j < 2; j++) {
+        if (m_jcp.wei_type == ov::element::nf4) {
+            nf4_lookup(vmm_w(j));
+        } else {
+            uni_vcvtdq2ps(vmm_w(j), vmm_w(j));
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_gemv_decompress_kernel<isa>::generate() {
+    OPENVINO_ASSERT(m_jcp.m_block > 0 && m_jcp.m_block <= max_m_block,
+                    "Unsupported M block for the decompression GEMV kernel: ",
+                    m_jcp.m_block);
+    OPENVINO_ASSERT(any_of(m_jcp.wei_type,
+                           ov::element::u8,
+                           ov::element::u4,
+                           ov::element::nf4,
+                           ov::element::f8e4m3,
+                           ov::element::f8e5m2),
+                    "Unsupported weights precision for the decompression GEMV kernel: ",
+                    m_jcp.wei_type);
+    const auto m_block = m_jcp.m_block;
+    const auto unroll = k_unroll(m_block);
+    const bool is_4bit = any_of(m_jcp.wei_type, ov::element::u4, ov::element::nf4);
+    const size_t row_bytes = is_4bit ? panel_size / 2 : panel_size;
+    auto dst_addr = [&](size_t m, size_t j) {
+        return ptr[reg_dst + (m * panel_size + j * vec_size) * sizeof(float)];
+    };
+
+    this->preamble();
+
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_xsum, ptr[reg_params + GET_OFF(xsum)]);
+    mov(reg_wei, ptr[reg_params + GET_OFF(wei)]);
+    mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+    if (m_jcp.with_zero_points) {
+        mov(reg_zp, ptr[reg_params + GET_OFF(zero_points)]);
+    }
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_scale_stride, ptr[reg_params + GET_OFF(scale_stride)]);
+    mov(reg_blocks, ptr[reg_params + GET_OFF(blocks)]);
+    mov(reg_block_k, ptr[reg_params + GET_OFF(block_k)]);
+
+    if (is_4bit) {
+        mov(reg_tmp.cvt32(), 0xf);
+        vmovd(Xmm(vmm_mask.getIdx()), reg_tmp.cvt32());
+        vpbroadcastd(vmm_mask, Xmm(vmm_mask.getIdx()));
+    }
+    if (m_jcp.wei_type == ov::element::f8e4m3) {
+        mov(reg_tmp.cvt32(), 0xbf80bf80);
+        vmovd(Xmm(vmm_f8_mask.getIdx()), reg_tmp.cvt32());
+        vpbroadcastd(vmm_f8_mask, Xmm(vmm_f8_mask.getIdx()));
+    }
+    if (m_jcp.wei_type == ov::element::nf4) {
+        mov(reg_tmp, reinterpret_cast<size_t>(m_nf4_lut.data()));
+        uni_vmovups(vmm_lut_lo, ptr[reg_tmp]);
+        if constexpr (isa == avx2) {
+            uni_vmovups(vmm_lut_hi, ptr[reg_tmp + vec_bytes]);
+            mov(reg_tmp.cvt32(), 7);
+            vmovd(Xmm(vmm_seven.getIdx()), reg_tmp.cvt32());
+            vpbroadcastd(vmm_seven, Xmm(vmm_seven.getIdx()));
+        }
+    }
+
+    uni_vpxor(vmm_tmp, vmm_tmp, vmm_tmp);
+    for (size_t m = 0; m < m_block; m++) {
+        for (size_t j = 0; j < 2; j++) {
+            uni_vmovups(dst_addr(m, j), vmm_tmp);
+        }
+    }
+
+    Label block_loop;
+    Label block_end;
+    Label k_loop;
+    test(reg_blocks, reg_blocks);
+    jz(block_end, T_NEAR);
+    L(block_loop);
+    {
+        for (size_t u = 0; u < unroll; u++) {
+            for (size_t m = 0; m < m_block; m++) {
+                for (size_t j = 0; j < 2; j++) {
+                    uni_vpxor(vmm_acc(u, m, j), vmm_acc(u, m, j), vmm_acc(u, m, j));
+                }
+            }
+        }
+
+        mov(reg_k, reg_block_k);
+        align(16);
+        L(k_loop);
+        {
+            prefetcht0(ptr[reg_wei + prefetch_distance]);
+            for (size_t u = 0; u < unroll; u++) {
+                load_weights(u * row_bytes);
+                for (size_t m = 0; m < m_block; m++) {
+                    vbroadcastss(vmm_x, ptr[reg_src + (u * m_block + m) * sizeof(float)]);
+                    for (size_t j = 0; j < 2; j++) {
+                        vfmadd231ps(vmm_acc(u, m, j), vmm_x, vmm_w(j));
+                    }
+                }
+            }
+            add(reg_wei, unroll * row_bytes);
+            add(reg_src, unroll * m_block * sizeof(float));
+            sub(reg_k, unroll);
+            jnz(k_loop, T_NEAR);
+        }
+
+        for (size_t u = 1; u < unroll; u++) {
+            for (size_t m = 0; m < m_block; m++) {
+                for (size_t j = 0; j < 2; j++) {
+                    vaddps(vmm_acc(0, m, j), vmm_acc(0, m, j), vmm_acc(u, m, j));
+                }
+            }
+        }
+
+        // dst += scale * (dot - zp * xsum)
+        for (size_t m = 0; m < m_block; m++) {
+            if (m_jcp.with_zero_points) {
+                vbroadcastss(vmm_x, ptr[reg_xsum + m * sizeof(float)]);
+            }
+            for (size_t j = 0; j < 2; j++) {
+                if (m_jcp.with_zero_points) {
+                    vfnmadd231ps(vmm_acc(0, m, j), vmm_x, ptr[reg_zp + j * vec_bytes]);
+                }
+                uni_vmovups(vmm_tmp, dst_addr(m, j));
+                vfmadd231ps(vmm_tmp, vmm_acc(0, m, j), ptr[reg_scales + j * vec_bytes]);
+                uni_vmovups(dst_addr(m, j), vmm_tmp);
+            }
+        }
+
+        add(reg_xsum, m_block * sizeof(float));
+        add(reg_scales, reg_scale_stride);
+        if (m_jcp.with_zero_points) {
+            add(reg_zp, reg_scale_stride);
+        }
+        dec(reg_blocks);
+        jnz(block_loop, T_NEAR);
+    }
+    L(block_end);
+
+    this->postamble();
+}
+
+template struct jit_gemv_decompress_kernel<cpu_isa_t::avx512_core>;
+template struct jit_gemv_decompress_kernel<cpu_isa_t::avx2>;
+
+}  // namespace ov::intel_cpu::kernel
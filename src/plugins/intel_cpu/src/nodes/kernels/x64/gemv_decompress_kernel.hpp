@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "jit_kernel_base.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::kernel {
+
+/**
+ * Pre-packed compressed weights consumed by the kernel. The output channels are split into panels of
+ * gemv_decompress_panel_size() channels, every panel is stored as K consecutive rows, so a range of K is
+ * a single contiguous stream:
+ *  - u8, f8:  panel bytes per row, byte i holds the channel i
+ *  - u4, nf4: panel / 2 bytes per row, byte i holds the channel i in the low nibble and
+ *             the channel i + panel / 2 in the high nibble
+ * Signed weights are stored shifted to the unsigned range (the shift is folded into the zero points), nf4 weights
+ * keep their codes and are decoded with a lookup table. f8 weights keep their bits and are converted through f16,
+ * the f8e4m3 values are decoded scaled by 2^-8 (the difference of the exponent biases), which is folded into
+ * the scales and the zero points.
+ * Scales and zero points are f32 [panel][group][channel] and are applied once per block of K:
+ *   dst[m][n] += scale[n] * (sum_k(x[m][k] * w[n][k]) - zp[n] * sum_k(x[m][k]))
+ */
+struct jit_gemv_decompress_compile_params {
+    ov::element::Type wei_type = ov::element::dynamic;  // u8, u4, nf4, f8e4m3 or f8e5m2
+    size_t m_block = 0UL;
+    bool with_zero_points = false;
+};
+
+struct jit_gemv_decompress_call_args {
+    const float* src;     // [K][M] activations of the block range
+    const float* xsum;    // [blocks][M] sums of the activations per block
+    const void* wei;      // packed weights of the panel at the first row of the range
+    const float* scales;
+    const float* zero_points;
+    float* dst;           // [M][panel] f32 partial sums, overwritten
+    size_t scale_stride;  // bytes between the scales of the consecutive blocks, 0 for per channel scales
+    size_t blocks;
+    size_t block_k;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+constexpr size_t gemv_decompress_panel_size() {
+    return 2 * dnnl::impl::cpu::x64::cpu_isa_traits_t<isa>::vlen / sizeof(float);
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_gemv_decompress_kernel
+    : public JitKernel<jit_gemv_decompress_compile_params, jit_gemv_decompress_call_args> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gemv_decompress_kernel)
+
+    static constexpr size_t vec_size = dnnl::impl::cpu::x64::cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    static constexpr size_t panel_size = gemv_decompress_panel_size<isa>();
+    static constexpr size_t max_m_block = 4;
+
+    // rows of K processed per loop iteration, the partial sums of every row use their own accumulators
+    static constexpr size_t k_unroll(size_t m_block) {
+        return m_block == 3 ? 1 : 4 / m_block;
+    }
+
+    explicit jit_gemv_decompress_kernel(const jit_gemv_decompress_compile_params& jcp);
+
+private:
+    using Xmm = Xbyak::Xmm;
+    using Vmm = std::conditional_t<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>;
+    using Vmm_half = std::conditional_t<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Xmm, Xbyak::Ymm>;
+
+    static constexpr size_t vec_bytes = vec_size * sizeof(float);
+
+    void generate() override;
+    // loads the panel row at the offset into vmm_w(0) and vmm_w(1) as f32
+    void load_weights(size_t offset);
+    void nf4_lookup(const Vmm& vmm);
+    void load_f8(const Vmm& vmm, size_t offset);
+
+    // two vectors of the panel per row of M per unrolled row of K
+    Vmm vmm_acc(size_t u, size_t m, size_t j) const {
+        return Vmm(static_cast<int>((u * m_jcp.m_block + m) * 2 + j));
+    }
+    Vmm vmm_w(size_t j) const {
+        return Vmm(static_cast<int>(8 + j));
+    }
+
+    const Vmm vmm_x = Vmm(10);
+    const Vmm vmm_mask = Vmm(11);
+    const Vmm vmm_lut_lo = Vmm(12);
+    const Vmm vmm_lut_hi = Vmm(13);
+    // f8e4m3 to f16 bits mask, shares the register with the nf4 table
+    const Vmm vmm_f8_mask = Vmm(12);
+    const Vmm vmm_seven = Vmm(14);
+    const Vmm vmm_tmp = Vmm(15);
+
+    // nf4 codes to f32, referenced by the generated code
+    std::array<float, 16> m_nf4_lut{};
+
+    const Xbyak::Reg64 reg_params = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_wei = r9;
+    const Xbyak::Reg64 reg_scales = r10;
+    const Xbyak::Reg64 reg_zp = r11;
+    const Xbyak::Reg64 reg_xsum = r12;
+    const Xbyak::Reg64 reg_dst = r13;
+    const Xbyak::Reg64 reg_blocks = r14;
+    const Xbyak::Reg64 reg_k = r15;
+    const Xbyak::Reg64 reg_scale_stride = rax;
+    const Xbyak::Reg64 reg_block_k = rdx;
+    const Xbyak::Reg64 reg_tmp = rbx;
+};
+
+}  // namespace ov::intel_cpu::kernel
@@ -20,6 +20,7 @@
 #    include <common/c_types_map.hpp>
 #    include <cpu/x64/cpu_isa_traits.hpp>
 
+#    include "cache/jit_kernel_registry.h"
 #    include "cpu/x64/jit_generator.hpp"
 #    include "registers_pool.hpp"
 #endif  // OPENVINO_ARCH_X86_64
@@ -214,7 +215,7 @@ public:
     ~JitKernel() override = default;
 
     dnnl::impl::status_t create_kernel() override {
-        const dnnl::impl::status_t code = jit_generator_t::create_kernel();
+        const dnnl::impl::status_t code = createJitKernel(*this);
         OPENVINO_ASSERT(code == dnnl::impl::status::success,
                         "Could not create kernel. Error code: ",
                         std::to_string(code),
@@ -252,6 +253,7 @@ public:
 
             if (res) {
                 res->create_kernel();
+                res = JitKernelRegistry::instance().deduplicate(res->name(), res->jit_ker(), res->getSize(), res);
             }
         } catch (...) {
             return nullptr;
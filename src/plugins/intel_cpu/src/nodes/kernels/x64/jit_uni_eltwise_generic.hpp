@@ -11,6 +11,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <vector>
 
+#include "cache/jit_kernel_registry.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_quantization_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -34,7 +35,7 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public dnnl::imp
                             const dnnl::post_ops& post_ops);
 
     void create_ker() override {
-        jit_generator_t::create_kernel();
+        createJitKernel(*this);
         ker_ = jit_kernel_cast<decltype(ker_)>(jit_ker());
     }
 
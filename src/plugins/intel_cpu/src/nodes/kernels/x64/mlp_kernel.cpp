@@ -299,7 +299,7 @@ class FP16ToBF16Kernel : public dnnl::impl::cpu::x64::jit_generator_t {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(FP16ToBF16Kernel)
     FP16ToBF16Kernel() : jit_generator_t("FP16ToBF16Kernel") {
-        create_kernel();
+        createJitKernel(*this);
     }
 
     void generate() override {
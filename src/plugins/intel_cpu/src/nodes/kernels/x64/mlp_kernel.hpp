@@ -13,8 +13,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
+#include "cache/jit_kernel_registry.h"
 #include "cpu/x64/jit_generator.hpp"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "openvino/core/except.hpp"
@@ -122,7 +124,7 @@ public:
             m_prefetch_Blines = 32768 * sizeof(ov::bfloat16) / 64 / M_hint;
         }
 
-        create_kernel();
+        createJitKernel(*this);
     }
 
     // M can change w/o code-regeneration
@@ -441,6 +443,10 @@ struct WeightBuffer {
     T* get(int work_id) {
         return reinterpret_cast<T*>(buffer.ptr<int8_t>() + offsets[work_id]);
     }
+    // the weights of all the works, placed back to back
+    [[nodiscard]] std::pair<const void*, size_t> region() const {
+        return {buffer.ptr_v(), buffer ? buffer.size(0) : 0};
+    }
 };
 
 struct ScratchBuffAllocator {
@@ -511,7 +517,7 @@ public:
         : jit_generator_t(jit_name()),
           m_act_alg(act_alg),
           m_to_f16(to_f16) {
-        create_kernel();
+        createJitKernel(*this);
     }
 
     void generate() override;
@@ -546,7 +552,7 @@ public:
         : jit_generator_t(jit_name()),
           m_do_reduce2(do_reduce2),
           m_to_f16(to_f16) {
-        create_kernel();
+        createJitKernel(*this);
     }
 
     void generate() override;
@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_kernel.hpp"
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace ov::intel_cpu::kernel {
+
+#define GET_OFF(field) offsetof(jit_sparse_fc_call_args, field)
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel<isa>::broadcast_4(const Vmm& vmm_dst, const Xbyak::Address& addr) {
+    if constexpr (isa == avx512_core) {
+        vbroadcastf32x4(vmm_dst, addr);
+    } else {
+        vbroadcastf128(vmm_dst, addr);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel<isa>::reduce_4x4(size_t m) {
+    if constexpr (isa == avx512_core) {
+        // every 128-bit lane r holds w[n0 + r][k0 + i] * x[k0 + i] partial sums:
+        // sum the lane up and compress the lanes 0, 4, 8, 12 to the lowest Xmm
+        const Vmm vmm_acc = acc(m, 0);
+        vpermilps(vmm_tmp, vmm_acc, 0b10110001);
+        vaddps(vmm_acc, vmm_acc, vmm_tmp);
+        vpermilps(vmm_tmp, vmm_acc, 0b01001110);
+        vaddps(vmm_acc, vmm_acc, vmm_tmp);
+        vcompressps(vmm_tmp | k1 | T_z, vmm_acc);
+        vmovaps(Xmm(vmm_acc.getIdx()), Xmm(vmm_tmp.getIdx()));
+    } else {
+        // acc(m, 0) holds the rows 0 and 1, acc(m, 1) holds the rows 2 and 3
+        const Vmm vmm_acc = acc(m, 0);
+        vhaddps(vmm_acc, vmm_acc, acc(m, 1));
+        vhaddps(vmm_acc, vmm_acc, vmm_acc);
+        // [s0, s2, s0, s2 | s1, s3, s1, s3] -> [s0, s1, s2, s3]
+        vextractf128(Xmm(vmm_tmp.getIdx()), vmm_acc, 1);
+        vunpcklps(Xmm(vmm_acc.getIdx()), Xmm(vmm_acc.getIdx()), Xmm(vmm_tmp.getIdx()));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_sparse_fc_kernel<isa>::generate() {
+    OPENVINO_ASSERT(m_jcp.m_block > 0 && m_jcp.m_block <= max_m_block,
+                    "Unsupported M block for the sparse FullyConnected kernel: ",
+                    m_jcp.m_block);
+    OPENVINO_ASSERT(m_jcp.pattern != FCSparsityPattern::None, "Sparsity pattern is not set");
+    const auto pattern = m_jcp.pattern;
+    const auto m_block = m_jcp.m_block;
+
+    this->preamble();
+
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_wei, ptr[reg_params + GET_OFF(wei)]);
+    mov(reg_off, ptr[reg_params + GET_OFF(offsets)]);
+    mov(reg_meta, ptr[reg_params + GET_OFF(meta)]);
+    mov(reg_steps, ptr[reg_params + GET_OFF(steps)]);
+    mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+
+    for (size_t m = 0; m < m_block; m++) {
+        for (size_t j = 0; j < n_vecs; j++) {
+            uni_vpxor(acc(m, j), acc(m, j), acc(m, j));
+        }
+    }
+    if (pattern == FCSparsityPattern::Structured2x4) {
+        mov(reg_k_off.cvt32(), 3);
+        vmovd(Xmm(vmm_mask3.getIdx()), reg_k_off.cvt32());
+        vpbroadcastd(vmm_mask3, Xmm(vmm_mask3.getIdx()));
+    }
+
+    Label loop;
+    Label loop_end;
+    test(reg_steps, reg_steps);
+    jz(loop_end, T_NEAR);
+    align(16);
+    L(loop);
+    {
+        movsxd(reg_k_off, dword[reg_off]);
+        mov(reg_x, reg_src);
+        add(reg_x, reg_k_off);
+
+        if (pattern == FCSparsityPattern::Structured2x4) {
+            // decode positions of both non-zero values inside the group of 4 into the dword permutation indices
+            for (size_t j = 0; j < n_vecs; j++) {
+                vpmovzxbd(vmm_idx0(j), ptr[reg_meta + j * vec_size]);
+                uni_vpsrld(vmm_idx1(j), vmm_idx0(j), 2);
+                uni_vpand(vmm_idx0(j), vmm_idx0(j), vmm_mask3);
+            }
+        }
+
+        for (size_t m = 0; m < m_block; m++) {
+            switch (pattern) {
+            case FCSparsityPattern::Block1x16:
+                vbroadcastss(vmm_x, ptr[reg_x]);
+                for (size_t j = 0; j < n_vecs; j++) {
+                    vfmadd231ps(acc(m, j), vmm_x, ptr[reg_wei + j * vec_bytes]);
+                }
+                break;
+            case FCSparsityPattern::Block4x4:
+                broadcast_4(vmm_x, ptr[reg_x]);
+                for (size_t j = 0; j < n_vecs; j++) {
+                    vfmadd231ps(acc(m, j), vmm_x, ptr[reg_wei + j * vec_bytes]);
+                }
+                break;
+            case FCSparsityPattern::Structured2x4:
+                broadcast_4(vmm_x, ptr[reg_x]);
+                for (size_t j = 0; j < n_vecs; j++) {
+                    vpermps(vmm_perm, vmm_idx0(j), vmm_x);
+                    vfmadd231ps(acc(m, j), vmm_perm, ptr[reg_wei + j * vec_bytes]);
+                    vpermps(vmm_perm, vmm_idx1(j), vmm_x);
+                    vfmadd231ps(acc(m, j), vmm_perm, ptr[reg_wei + (n_vecs + j) * vec_bytes]);
+                }
+                break;
+            default:
+                OPENVINO_THROW("Unsupported sparsity pattern");
+            }
+            if (m + 1 < m_block) {
+                add(reg_x, reg_src_stride);
+            }
+        }
+
+        add(reg_wei, sparse_fc_step_values(pattern) * sizeof(float));
+        add(reg_off, sizeof(int32_t));
+        if (pattern == FCSparsityPattern::Structured2x4) {
+            add(reg_meta, sparse_fc_panel_size(pattern));
+        }
+        dec(reg_steps);
+        jnz(loop, T_NEAR);
+    }
+    L(loop_end);
+
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+    if (m_jcp.with_bias) {
+        mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+    }
+    if (pattern == FCSparsityPattern::Block4x4 && isa == avx512_core) {
+        mov(reg_k_off.cvt32(), 0x1111);
+        kmovw(k1, reg_k_off.cvt32());
+    }
+
+    for (size_t m = 0; m < m_block; m++) {
+        if (pattern == FCSparsityPattern::Block4x4) {
+            reduce_4x4(m);
+            const Xmm xmm_acc = Xmm(acc(m, 0).getIdx());
+            if (m_jcp.with_bias) {
+                vaddps(xmm_acc, xmm_acc, ptr[reg_bias]);
+            }
+            vmovups(ptr[reg_dst], xmm_acc);
+        } else {
+            for (size_t j = 0; j < n_vecs; j++) {
+                if (m_jcp.with_bias) {
+                    vaddps(acc(m, j), acc(m, j), ptr[reg_bias + j * vec_bytes]);
+                }
+                vmovups(ptr[reg_dst + j * vec_bytes], acc(m, j));
+            }
+        }
+        if (m + 1 < m_block) {
+            add(reg_dst, reg_dst_stride);
+        }
+    }
+
+    this->postamble();
+}
+
+template struct jit_sparse_fc_kernel<cpu_isa_t::avx512_core>;
+template struct jit_sparse_fc_kernel<cpu_isa_t::avx2>;
+
+}  // namespace ov::intel_cpu::kernel
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "jit_kernel_base.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+
+namespace ov::intel_cpu::kernel {
+
+/**
+ * Compressed weights layout consumed by the kernel. The weights are split into panels of output channels
+ * (16 for Structured2x4 and Block1x16, 4 for Block4x4). Every panel is a sequence of non-zero steps along K:
+ *  - Block1x16:     offset of k,      16 values w[n0 + i][k]
+ *  - Block4x4:      offset of k0,     16 values w[n0 + r][k0 + i] stored as [r][i]
+ *  - Structured2x4: offset of k0,     16 values of the first non-zero + 16 values of the second non-zero,
+ *                   16 bytes of metadata (idx0 | idx1 << 2) with the positions of the values inside [k0, k0 + 4)
+ * Offsets are in bytes of the source row, so the kernel adds them to the row pointer directly.
+ */
+struct jit_sparse_fc_compile_params {
+    FCSparsityPattern pattern = FCSparsityPattern::None;
+    size_t m_block = 0UL;
+    bool with_bias = false;
+};
+
+struct jit_sparse_fc_call_args {
+    const float* src;
+    const float* wei;
+    const int32_t* offsets;
+    const uint8_t* meta;
+    const float* bias;
+    float* dst;
+    size_t src_stride;
+    size_t dst_stride;
+    size_t steps;
+};
+
+constexpr size_t sparse_fc_panel_size(FCSparsityPattern pattern) {
+    return pattern == FCSparsityPattern::Block4x4 ? 4 : 16;
+}
+
+constexpr size_t sparse_fc_step_values(FCSparsityPattern pattern) {
+    return pattern == FCSparsityPattern::Structured2x4 ? 32 : 16;
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_sparse_fc_kernel : public JitKernel<jit_sparse_fc_compile_params, jit_sparse_fc_call_args> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sparse_fc_kernel)
+
+    static constexpr size_t vec_size = dnnl::impl::cpu::x64::cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    // accumulators of 16 output channels per row occupy the first 8 vector registers
+    static constexpr size_t max_m_block = 8 / (16 / vec_size);
+
+    explicit jit_sparse_fc_kernel(const jit_sparse_fc_compile_params& jcp) : JitKernel(jit_name(), jcp, isa) {}
+
+private:
+    using Xmm = Xbyak::Xmm;
+    using Vmm = std::conditional_t<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>;
+
+    static constexpr size_t vec_bytes = vec_size * sizeof(float);
+    static constexpr size_t n_vecs = 16 / vec_size;
+
+    void generate() override;
+    void broadcast_4(const Vmm& vmm_dst, const Xbyak::Address& addr);
+    // reduces the Block4x4 accumulators of one row into 4 output channels in the lowest Xmm of acc(m, 0)
+    void reduce_4x4(size_t m);
+
+    Vmm acc(size_t m, size_t j) const {
+        return Vmm(static_cast<int>(m * n_vecs + j));
+    }
+
+    const Vmm vmm_x = Vmm(8);
+    const Vmm vmm_perm = Vmm(9);
+    const Vmm vmm_mask3 = Vmm(10);
+    const Vmm vmm_tmp = Vmm(15);
+    Vmm vmm_idx0(size_t j) const {
+        return Vmm(static_cast<int>(11 + j));
+    }
+    Vmm vmm_idx1(size_t j) const {
+        return Vmm(static_cast<int>(13 + j));
+    }
+
+    const Xbyak::Reg64 reg_params = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_wei = r9;
+    const Xbyak::Reg64 reg_off = r10;
+    const Xbyak::Reg64 reg_meta = r11;
+    const Xbyak::Reg64 reg_steps = r12;
+    const Xbyak::Reg64 reg_src_stride = r13;
+    const Xbyak::Reg64 reg_x = r14;
+    const Xbyak::Reg64 reg_k_off = r15;
+    const Xbyak::Reg64 reg_dst = rax;
+    const Xbyak::Reg64 reg_dst_stride = rdx;
+    const Xbyak::Reg64 reg_bias = rbx;
+};
+
+}  // namespace ov::intel_cpu::kernel
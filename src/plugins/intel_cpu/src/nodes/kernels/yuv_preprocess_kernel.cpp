@@ -0,0 +1,336 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess_kernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "scaled_attn/common.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vec_len = vec_len_f32_avx512;
+using vec_t = __m512;
+inline vec_t vset1(float a) {
+    return _mm512_set1_ps(a);
+}
+inline vec_t vload(const float* a) {
+    return _mm512_loadu_ps(a);
+}
+inline void vstore(float* a, vec_t v) {
+    _mm512_storeu_ps(a, v);
+}
+inline vec_t vfmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+inline vec_t vfnmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fnmadd_ps(a, b, c);
+}
+inline vec_t vmul(vec_t a, vec_t b) {
+    return _mm512_mul_ps(a, b);
+}
+inline vec_t vsub(vec_t a, vec_t b) {
+    return _mm512_sub_ps(a, b);
+}
+inline vec_t vclip(vec_t a, vec_t lo, vec_t hi) {
+    return _mm512_min_ps(_mm512_max_ps(a, lo), hi);
+}
+inline vec_t vround(vec_t a) {
+    return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+// saturation and truncation of Convert to u8
+inline void vstore_u8(uint8_t* a, vec_t v) {
+    const auto clipped = vclip(v, _mm512_setzero_ps(), vset1(255.F));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(a), _mm512_cvtusepi32_epi8(_mm512_cvttps_epi32(clipped)));
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vec_len = vec_len_f32_avx2;
+using vec_t = __m256;
+inline vec_t vset1(float a) {
+    return _mm256_set1_ps(a);
+}
+inline vec_t vload(const float* a) {
+    return _mm256_loadu_ps(a);
+}
+inline void vstore(float* a, vec_t v) {
+    _mm256_storeu_ps(a, v);
+}
+inline vec_t vfmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+inline vec_t vfnmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fnmadd_ps(a, b, c);
+}
+inline vec_t vmul(vec_t a, vec_t b) {
+    return _mm256_mul_ps(a, b);
+}
+inline vec_t vsub(vec_t a, vec_t b) {
+    return _mm256_sub_ps(a, b);
+}
+inline vec_t vclip(vec_t a, vec_t lo, vec_t hi) {
+    return _mm256_min_ps(_mm256_max_ps(a, lo), hi);
+}
+inline vec_t vround(vec_t a) {
+    return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+// saturation and truncation of Convert to u8
+inline void vstore_u8(uint8_t* a, vec_t v) {
+    const auto i32 = _mm256_cvttps_epi32(vclip(v, _mm256_setzero_ps(), vset1(255.F)));
+    const auto i16 = _mm_packus_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(a), _mm_packus_epi16(i16, i16));
+}
+#endif
+
+// BT.601 limited range coefficients, the same as ColorConvert uses
+constexpr float y_scale = 1.164F;
+constexpr float r_v = 1.596F;
+constexpr float g_u = 0.391F;
+constexpr float g_v = 0.813F;
+constexpr float b_u = 2.018F;
+
+inline float clip_color(float a, bool round) {
+    return std::min(std::max(round ? std::nearbyint(a) : a, 0.F), 255.F);
+}
+
+// Gathers the source pixels of one tap into contiguous buffers
+template <typename T>
+void gather_tap(const T* y,
+                const T* u,
+                const T* v,
+                const int32_t* x,
+                const int32_t* c,
+                size_t width,
+                float* ys,
+                float* us,
+                float* vs) {
+    for (size_t i = 0; i < width; i++) {
+        ys[i] = static_cast<float>(y[x[i]]);
+        us[i] = static_cast<float>(u[c[i]]);
+        vs[i] = static_cast<float>(v[c[i]]);
+    }
+}
+
+// Decodes the gathered pixels and accumulates them into the RGB planes with the tap weight: the vertical weight
+// times the horizontal weight of every column (1 - wx for the first horizontal tap, wx for the second one)
+void accumulate_tap(const float* ys,
+                    const float* us,
+                    const float* vs,
+                    const float* wx,
+                    bool second_x,
+                    float wy,
+                    bool first_tap,
+                    bool round,
+                    size_t width,
+                    float* r,
+                    float* g,
+                    float* b) {
+    size_t i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto v16 = vset1(16.F);
+    const auto v128 = vset1(128.F);
+    const auto vzero = vset1(0.F);
+    const auto v255 = vset1(255.F);
+    const auto vone = vset1(1.F);
+    const auto vwy = vset1(wy);
+    for (; i + vec_len <= width; i += vec_len) {
+        const auto c = vmul(vsub(vload(ys + i), v16), vset1(y_scale));
+        const auto d = vsub(vload(us + i), v128);
+        const auto e = vsub(vload(vs + i), v128);
+        auto vr = vfmadd(e, vset1(r_v), c);
+        auto vg = vfnmadd(e, vset1(g_v), vfnmadd(d, vset1(g_u), c));
+        auto vb = vfmadd(d, vset1(b_u), c);
+        if (round) {
+            vr = vround(vr);
+            vg = vround(vg);
+            vb = vround(vb);
+        }
+        vr = vclip(vr, vzero, v255);
+        vg = vclip(vg, vzero, v255);
+        vb = vclip(vb, vzero, v255);
+
+        auto w = vwy;
+        if (wx) {
+            const auto vwx = vload(wx + i);
+            w = vmul(w, second_x ? vwx : vsub(vone, vwx));
+        }
+        if (first_tap) {
+            vstore(r + i, vmul(vr, w));
+            vstore(g + i, vmul(vg, w));
+            vstore(b + i, vmul(vb, w));
+        } else {
+            vstore(r + i, vfmadd(vr, w, vload(r + i)));
+            vstore(g + i, vfmadd(vg, w, vload(g + i)));
+            vstore(b + i, vfmadd(vb, w, vload(b + i)));
+        }
+    }
+#endif
+    for (; i < width; i++) {
+        const float c = (ys[i] - 16.F) * y_scale;
+        const float d = us[i] - 128.F;
+        const float e = vs[i] - 128.F;
+        const float vr = clip_color(c + r_v * e, round);
+        const float vg = clip_color(c - g_u * d - g_v * e, round);
+        const float vb = clip_color(c + b_u * d, round);
+        float w = wy;
+        if (wx) {
+            w *= second_x ? wx[i] : 1.F - wx[i];
+        }
+        r[i] = first_tap ? vr * w : r[i] + vr * w;
+        g[i] = first_tap ? vg * w : g[i] + vg * w;
+        b[i] = first_tap ? vb * w : b[i] + vb * w;
+    }
+}
+
+// x * scale + shift in place
+void normalize(float* a, float scale, float shift, size_t width) {
+    size_t i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto vscale = vset1(scale);
+    const auto vshift = vset1(shift);
+    for (; i + vec_len <= width; i += vec_len) {
+        vstore(a + i, vfmadd(vload(a + i), vscale, vshift));
+    }
+#endif
+    for (; i < width; i++) {
+        a[i] = a[i] * scale + shift;
+    }
+}
+
+inline uint8_t to_u8(float a) {
+    return static_cast<uint8_t>(std::trunc(std::min(std::max(a, 0.F), 255.F)));
+}
+
+void store_planar(const float* src, void* dst, ov::element::Type dst_precision, size_t width) {
+    switch (dst_precision) {
+    case ov::element::f32:
+        std::copy_n(src, width, static_cast<float*>(dst));
+        break;
+    case ov::element::bf16:
+        cvt_copy(static_cast<ov::bfloat16*>(dst), src, 1, width, width, width);
+        break;
+    case ov::element::u8: {
+        auto* u8 = static_cast<uint8_t*>(dst);
+        size_t i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; i + vec_len <= width; i += vec_len) {
+            vstore_u8(u8 + i, vload(src + i));
+        }
+#endif
+        for (; i < width; i++) {
+            u8[i] = to_u8(src[i]);
+        }
+        break;
+    }
+    default:
+        OPENVINO_THROW("YuvPreprocess doesn't support output precision ", dst_precision);
+    }
+}
+
+template <typename T>
+void store_interleaved(const float* const* planes, T* dst, size_t width) {
+    for (size_t i = 0; i < width; i++) {
+        for (size_t c = 0; c < 3; c++) {
+            if constexpr (std::is_same_v<T, uint8_t>) {
+                dst[i * 3 + c] = to_u8(planes[c][i]);
+            } else {
+                dst[i * 3 + c] = static_cast<T>(planes[c][i]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void yuv_preprocess_row_impl(const ov::Extensions::Cpu::YuvPreprocessRow& row, ov::element::Type dst_precision) {
+    const size_t width = row.width;
+    float* r = row.scratch;
+    float* g = r + width;
+    float* b = g + width;
+    float* ys = b + width;
+    float* us = ys + width;
+    float* vs = us + width;
+
+    const size_t rows = row.linear ? 2 : 1;
+    const size_t cols = row.linear ? 2 : 1;
+    for (size_t ry = 0; ry < rows; ry++) {
+        const float wy = row.linear ? (ry == 0 ? 1.F - row.wy : row.wy) : 1.F;
+        for (size_t cx = 0; cx < cols; cx++) {
+            gather_tap(static_cast<const T*>(row.y[ry]),
+                       static_cast<const T*>(row.u[ry]),
+                       static_cast<const T*>(row.v[ry]),
+                       cx == 0 ? row.x0 : row.x1,
+                       cx == 0 ? row.c0 : row.c1,
+                       width,
+                       ys,
+                       us,
+                       vs);
+            accumulate_tap(ys,
+                           us,
+                           vs,
+                           row.linear ? row.wx : nullptr,
+                           cx == 1,
+                           wy,
+                           ry == 0 && cx == 0,
+                           row.round_color,
+                           width,
+                           r,
+                           g,
+                           b);
+        }
+    }
+
+    // the decoded planes are in RGB order
+    float* planes[3] = {row.bgr ? b : r, g, row.bgr ? r : b};
+    for (size_t c = 0; c < 3; c++) {
+        normalize(planes[c], row.scale[c], row.shift[c], width);
+    }
+
+    if (row.pixel_stride == 1) {
+        for (size_t c = 0; c < 3; c++) {
+            auto* dst = static_cast<uint8_t*>(row.dst) + c * row.channel_stride * dst_precision.size();
+            store_planar(planes[c], dst, dst_precision, width);
+        }
+        return;
+    }
+    switch (dst_precision) {
+    case ov::element::f32:
+        store_interleaved(planes, static_cast<float*>(row.dst), width);
+        break;
+    case ov::element::bf16:
+        store_interleaved(planes, static_cast<ov::bfloat16*>(row.dst), width);
+        break;
+    case ov::element::u8:
+        store_interleaved(planes, static_cast<uint8_t*>(row.dst), width);
+        break;
+    default:
+        OPENVINO_THROW("YuvPreprocess doesn't support output precision ", dst_precision);
+    }
+}
+
+}  // namespace
+
+void yuv_preprocess_row(const ov::Extensions::Cpu::YuvPreprocessRow& row,
+                        ov::element::Type src_precision,
+                        ov::element::Type dst_precision) {
+    if (src_precision == ov::element::u8) {
+        yuv_preprocess_row_impl<uint8_t>(row, dst_precision);
+    } else {
+        yuv_preprocess_row_impl<float>(row, dst_precision);
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
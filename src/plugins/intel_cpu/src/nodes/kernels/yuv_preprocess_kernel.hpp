@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::Extensions::Cpu {
+
+/**
+ * One output row of the fused YUV decoding, resize and normalization. The row interpolates two source rows (a single
+ * one for the nearest resize), every output column reads the source pixels of its horizontal taps.
+ */
+struct YuvPreprocessRow {
+    const void* y[2];   // luma rows of the vertical taps
+    const void* u[2];   // U rows of the vertical taps, interleaved UV rows for NV12
+    const void* v[2];   // V rows of the vertical taps, U rows + 1 for NV12
+    float wy;           // weight of the second vertical tap
+    const int32_t* x0;  // luma offsets of the first horizontal tap of every output column
+    const int32_t* x1;  // luma offsets of the second horizontal tap
+    const int32_t* c0;  // chroma offsets of the first horizontal tap
+    const int32_t* c1;  // chroma offsets of the second horizontal tap
+    const float* wx;    // weights of the second horizontal tap
+    size_t width;       // output width
+    bool linear;
+    bool bgr;
+    bool round_color;  // colors are rounded to integers before the resize
+    const float* scale;
+    const float* shift;
+    void* dst;
+    size_t channel_stride;  // in elements, 1 for the interleaved output
+    size_t pixel_stride;    // in elements, 1 for the planar output
+    float* scratch;         // 6 * width floats
+};
+
+}  // namespace ov::Extensions::Cpu
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * Computes one output row of YuvPreprocess. The source pixels are gathered into contiguous buffers, the color
+ * conversion, the interpolation and the normalization are computed by full vectors over the output columns.
+ * @param src_precision u8 or f32 image planes
+ * @param dst_precision f32, bf16 or u8 output (the latter is saturated and truncated as Convert does)
+ */
+void yuv_preprocess_row(const ov::Extensions::Cpu::YuvPreprocessRow& row,
+                        ov::element::Type src_precision,
+                        ov::element::Type dst_precision);
+
+}  // namespace ov::Extensions::Cpu::XARCH
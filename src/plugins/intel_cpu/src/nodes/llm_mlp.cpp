@@ -420,6 +420,10 @@ struct LLMMLP::Executor : public LLMMLP::ExecutorBase {
         m_N = N;
     }
 
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {gate_up.wbuffer.region(), down.wbuffer.region()};
+    }
+
     void setM(int M) {
         uint8_t* cur_scratch_base = nullptr;
         if (m_scratchMem) {
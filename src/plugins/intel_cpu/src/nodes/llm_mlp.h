@@ -12,6 +12,7 @@
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/executors/executor.hpp"
 #include "openvino/core/node.hpp"
 #include "transformations/cpu_opset/x64/op/llm_mlp.hpp"
 
@@ -34,6 +35,9 @@ public:
     }
     void initSupportedPrimitiveDescriptors() override;
     void execute(const dnnl::stream& strm) override;
+    MemoryRegions getWeightsRegions() const override {
+        return m_executor ? m_executor->weightsRegions() : MemoryRegions{};
+    }
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                      std::string& errorMessage,
                                      uint64_t fcDynamicQuantizationGroupSize = 0) noexcept;
@@ -41,6 +45,9 @@ public:
 private:
     struct ExecutorBase {
         virtual void execute() = 0;
+        [[nodiscard]] virtual MemoryRegions weightsRegions() const {
+            return {};
+        }
         virtual ~ExecutorBase() = default;
     };
     std::shared_ptr<ExecutorBase> m_executor;
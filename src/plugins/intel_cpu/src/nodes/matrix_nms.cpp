@@ -8,7 +8,6 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -19,6 +18,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_candidates.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/enum_names.hpp"
 #include "openvino/core/except.hpp"
@@ -193,13 +193,10 @@ size_t MatrixNms::nmsMatrix(const float* boxesData,
                             BoxInfo* filterBoxes,
                             const int64_t batchIdx,
                             const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    // The candidate list is local, per-thread buffers can't be used here because of the nested parallel loop below.
+    NmsCandidates candidates;
+    int64_t originalSize = static_cast<int64_t>(candidates.filter<false>(scoresData, m_numBoxes, m_scoreThreshold));
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
     if (originalSize <= 0) {
         return 0;
     }
@@ -207,12 +204,11 @@ size_t MatrixNms::nmsMatrix(const float* boxesData,
         originalSize = m_nmsTopk;
     }
 
-    std::partial_sort(candidateIndex.begin(),
-                      candidateIndex.begin() + originalSize,
-                      end,
-                      [&scoresData](int32_t a, int32_t b) {
-                          return scoresData[a] > scoresData[b];
-                      });
+    candidates.sort_until(static_cast<size_t>(originalSize));
+    std::vector<int32_t> candidateIndex(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        candidateIndex[i] = candidates.get(i).second;
+    }
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
@@ -617,6 +617,12 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                                   const VectorDims& roisnumStrides,
                                   const bool shared) {
     const auto& cpu_parallel = context->getCpuParallel();
+    const auto threads_num = static_cast<size_t>(parallel_get_max_threads());
+    if (m_candidates.size() < threads_num) {
+        m_candidates.resize(threads_num);
+        m_selectedBoxes.resize(threads_num);
+    }
+    // The body doesn't spawn nested parallel work, so the per-thread buffers are never shared between classes.
     cpu_parallel->parallel_for2d(m_numBatches, m_numClasses, [&](size_t batch_idx, size_t class_idx) {
         /*
         // nms over a class over an image
@@ -635,49 +641,27 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* scoresPtr =
                 slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
+            auto& candidates = get_thread_nms_buffer(m_candidates);
+            auto& selected = get_thread_nms_buffer(m_selectedBoxes);
             int cur_numBoxes = shared ? static_cast<int>(m_numBoxes) : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold) {  // align with ref
-                    sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-                }
-            }
+            // align with ref: the boxes with score equal to the threshold are kept
+            const size_t sortedBoxSize =
+                candidates.filter<true>(scoresPtr, static_cast<size_t>(cur_numBoxes), m_scoreThreshold);
 
             int io_selection_size = 0;
-            if (!sorted_boxes.empty()) {
-                parallel_sort(sorted_boxes.begin(),
-                              sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                              });
-                auto offset = static_cast<int>(batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk);
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first,
-                                                        static_cast<int>(batch_idx),
-                                                        static_cast<int>(class_idx),
-                                                        sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size())
-                                      ? static_cast<int>(sorted_boxes.size())
-                                      : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                                                          &boxesPtr[m_filtBoxes[offset + idx].box_index * 4],
-                                                          m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first,
-                                                                                static_cast<int>(batch_idx),
-                                                                                static_cast<int>(class_idx),
-                                                                                sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+            const int max_out_box = (static_cast<size_t>(m_nmsRealTopk) > sortedBoxSize)
+                                        ? static_cast<int>(sortedBoxSize)
+                                        : m_nmsRealTopk;
+            selected.reset(static_cast<size_t>(max_out_box), static_cast<float>(!m_normalized));
+            auto offset = static_cast<int>(batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk);
+            for (int box_idx = 0; box_idx < max_out_box; box_idx++) {
+                const auto [score, idx] = candidates.get(box_idx);
+                const float* box = &boxesPtr[idx * 4];
+                if (io_selection_size == 0 || !selected.suppresses(box[0], box[1], box[2], box[3], m_iouThreshold)) {
+                    selected.push(box[0], box[1], box[2], box[3]);
+                    m_filtBoxes[offset + io_selection_size] =
+                        filteredBoxes(score, static_cast<int>(batch_idx), static_cast<int>(class_idx), idx);
+                    io_selection_size++;
                 }
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -9,10 +9,12 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/common/nms_candidates.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 
@@ -99,6 +101,9 @@ private:
     };
 
     std::vector<filteredBoxes> m_filtBoxes;  // rois after nms for each class in each image
+    // Per-thread buffers of the nms loop without eta.
+    std::vector<NmsCandidates> m_candidates;
+    std::vector<NmsSelectedBoxes> m_selectedBoxes;
 
     void checkPrecision(ov::element::Type prec,
                         const std::vector<ov::element::Type>& precList,
@@ -9,6 +9,7 @@
 #include "non_max_suppression.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -519,99 +520,80 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
                                             std::vector<FilteredBox>& filtBoxes) {
     const auto& cpu_parallel = context->getCpuParallel();
     auto max_out_box = static_cast<int>(m_output_boxes_per_class);
+    const auto threads_num = static_cast<size_t>(parallel_get_max_threads());
+    if (m_candidates.size() < threads_num) {
+        m_candidates.resize(threads_num);
+        m_selected_boxes.resize(threads_num);
+    }
+    // The ref path compares corner boxes, the jit kernel decodes the boxes itself and gets them as is.
+    auto decode = [&](const float* box) {
+        if (m_jit_kernel) {
+            return std::array<float, 4>{box[0], box[1], box[2], box[3]};
+        }
+        if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+            // box format: x_center, y_center, width, height
+            return std::array<float, 4>{box[1] - box[3] / 2.F,
+                                        box[0] - box[2] / 2.F,
+                                        box[1] + box[3] / 2.F,
+                                        box[0] + box[2] / 2.F};
+        }
+        // box format: y1, x1, y2, x2
+        return std::array<float, 4>{(std::min)(box[0], box[2]),
+                                    (std::min)(box[1], box[3]),
+                                    (std::max)(box[0], box[2]),
+                                    (std::max)(box[1], box[3])};
+    };
+
+    // The body doesn't spawn nested parallel work, so the per-thread buffers are never shared between classes.
     cpu_parallel->parallel_for2d(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
         const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        sorted_boxes.reserve(m_boxes_num);
-        for (size_t box_idx = 0; box_idx < m_boxes_num; box_idx++) {
-            if (scoresPtr[box_idx] > m_score_threshold) {
-                sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-            }
+        auto& candidates = get_thread_nms_buffer(m_candidates);
+        auto& selected = get_thread_nms_buffer(m_selected_boxes);
+        const size_t sortedBoxSize = candidates.filter<false>(scoresPtr, m_boxes_num, m_score_threshold);
+        selected.reset(std::min(sortedBoxSize, m_output_boxes_per_class));
+
+#if defined(OPENVINO_ARCH_X86_64)
+        auto arg = kernel::NmsCallArgs();
+        arg.iou_threshold = (&m_iou_threshold);
+        arg.score_threshold = (&m_score_threshold);
+        arg.scale = (&m_scale);
+        // box start index do not change for hard supresion
+        for (size_t i = 0; i < 4; i++) {
+            arg.selected_boxes_coord[i] = selected.coord(i);
         }
+#endif  // OPENVINO_ARCH_X86_64
 
         int io_selection_size = 0;
-        const size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0LU) {
-            parallel_sort(sorted_boxes.begin(),
-                          sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
-            filtBoxes[offset + 0] = FilteredBox(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            if (sortedBoxSize > 1LU) {
+        int offset = batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
+        for (size_t candidate_idx = 0; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
+             candidate_idx++) {
+            const auto [score, box_idx] = candidates.get(candidate_idx);
+            const float* box = &boxesPtr[box_idx * m_coord_num];
+            int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
+            if (io_selection_size > 0) {
                 if (m_jit_kernel) {
 #if defined(OPENVINO_ARCH_X86_64)
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0F);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0F);
-
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * m_coord_num];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 3];
-
-                    auto arg = kernel::NmsCallArgs();
-                    arg.iou_threshold = (&m_iou_threshold);
-                    arg.score_threshold = (&m_score_threshold);
-                    arg.scale = (&m_scale);
-                    // box start index do not change for hard supresion
-                    arg.selected_boxes_coord[0] = static_cast<float*>(boxCoord0.data());
-                    arg.selected_boxes_coord[1] = static_cast<float*>(boxCoord1.data());
-                    arg.selected_boxes_coord[2] = static_cast<float*>(boxCoord2.data());
-                    arg.selected_boxes_coord[3] = static_cast<float*>(boxCoord3.data());
-
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
-                         candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = (&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num]);
-                        arg.candidate_status = (&candidateStatus);
-                        (*m_jit_kernel)(&arg);
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num];
-                            boxCoord1[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 1];
-                            boxCoord2[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 2];
-                            boxCoord3[io_selection_size] =
-                                boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num + 3];
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
+                    arg.selected_boxes_num = io_selection_size;
+                    arg.candidate_box = box;
+                    arg.candidate_status = (&candidateStatus);
+                    (*m_jit_kernel)(&arg);
 #endif  // OPENVINO_ARCH_X86_64
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
-                         candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(
-                                &boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * m_coord_num]);
-                            if (iou >= m_iou_threshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
-
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
+                    const auto [ymin, xmin, ymax, xmax] = decode(box);
+                    if (selected.suppresses(ymin, xmin, ymax, xmax, m_iou_threshold)) {
+                        candidateStatus = NMSCandidateStatus::SUPPRESSED;
                     }
                 }
             }
+
+            if (candidateStatus == NMSCandidateStatus::SELECTED) {
+                const auto [ymin, xmin, ymax, xmax] = decode(box);
+                selected.push(ymin, xmin, ymax, xmax);
+                filtBoxes[offset + io_selection_size] = FilteredBox(score, batch_idx, class_idx, box_idx);
+                io_selection_size++;
+            }
         }
 
         m_num_filtered_boxes[batch_idx][class_idx] = io_selection_size;
@@ -8,6 +8,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_shape.h"
 #include "cpu_types.h"
@@ -15,6 +16,7 @@
 #include "kernels/x64/jit_kernel_base.hpp"
 #include "kernels/x64/non_max_suppression.hpp"
 #include "node.h"
+#include "nodes/common/nms_candidates.h"
 #include "nodes/kernels/x64/jit_kernel_base.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
@@ -154,6 +156,9 @@ private:
     const std::string outType = "output";
     bool m_defined_outputs[NMS_VALID_OUTPUTS + 1] = {false, false, false};
     std::vector<FilteredBox> m_filtered_boxes;
+    // Per-thread buffers of the hard suppression loop.
+    std::vector<NmsCandidates> m_candidates;
+    std::vector<NmsSelectedBoxes> m_selected_boxes;
 
     std::shared_ptr<kernel::JitKernelBase> m_jit_kernel;
 };
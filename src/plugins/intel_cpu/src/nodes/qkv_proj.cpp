@@ -224,6 +224,10 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         }
     }
 
+    [[nodiscard]] MemoryRegions weightsRegions() const override {
+        return {wbuffer.region()};
+    }
+
     void execute() override {
         static ReduceAdd2bh jit_cvt(false, std::is_same_v<T, ov::float16>);
 
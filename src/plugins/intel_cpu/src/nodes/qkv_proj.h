@@ -12,6 +12,7 @@
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/executors/executor.hpp"
 #include "openvino/core/node.hpp"
 #include "transformations/cpu_opset/x64/op/qkv_proj.hpp"
 
@@ -37,6 +38,9 @@ public:
     }
     void initSupportedPrimitiveDescriptors() override;
     void execute(const dnnl::stream& strm) override;
+    MemoryRegions getWeightsRegions() const override {
+        return m_executor ? m_executor->weightsRegions() : MemoryRegions{};
+    }
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                      std::string& errorMessage,
                                      int concurrency = 0,
@@ -45,6 +49,9 @@ public:
 private:
     struct ExecutorBase {
         virtual void execute() = 0;
+        [[nodiscard]] virtual MemoryRegions weightsRegions() const {
+            return {};
+        }
         virtual ~ExecutorBase() = default;
     };
     std::shared_ptr<ExecutorBase> m_executor;
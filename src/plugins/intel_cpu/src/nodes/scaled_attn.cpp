@@ -93,8 +93,14 @@ static bool is_quantized_cache(ov::element::Type prec) {
     return prec == ov::element::u8 || prec == ov::element::u4;
 }
 
+// OV_CPU_LEGACY_ATTN reverts single token decoding to kernel_single_token, which has no f8 cache support.
+[[maybe_unused]] static bool force_legacy_attention() {
+    static const bool force_legacy = std::getenv("OV_CPU_LEGACY_ATTN") != nullptr;
+    return force_legacy;
+}
+
 // Compress and write cur tensor into the KV cache (dst) at position L0.
-// Handles encoded (TurboQ), quantized (u8/u4 with scale/zp), or raw (f32/f16/bf16 memcpy).
+// Handles encoded (TurboQ), quantized (u8/u4 with scale/zp), or raw (f32/f16/bf16 memcpy, f8 conversion).
 // ws: per-thread f32 scratch for the codec path.
 static void compress_cache(const PlainTensor& cur,
                            PlainTensor& dst,
@@ -1604,8 +1610,7 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 #if defined(OPENVINO_ARCH_ARM) || defined(OPENVINO_ARCH_ARM64)
             const bool use_new_pipeline = false;
 #else
-            static const bool force_legacy = std::getenv("OV_CPU_LEGACY_ATTN") != nullptr;
-            const bool use_new_pipeline = !force_legacy;
+            const bool use_new_pipeline = !force_legacy_attention();
 #endif
             if (use_new_pipeline) {
                 mha_kv_cache(q_input,
@@ -1883,8 +1888,10 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
                                    ov::element::f16,
                                    ov::element::bf16,
                                    ov::element::u8,
-                                   ov::element::u4),
-                            "supports key/value cache precision f32, f16, bf16, u8, u4 but gets ",
+                                   ov::element::u4,
+                                   ov::element::f8e4m3,
+                                   ov::element::f8e5m2),
+                            "supports key/value cache precision f32, f16, bf16, u8, u4, f8e4m3, f8e5m2 but gets ",
                             prec);
         }
     }
@@ -2993,6 +3000,17 @@ static ov::element::Type side_cache_precision(bool is_turbo,
     if (side_hint == ov::element::u8 || side_hint == ov::element::u4 || side_hint == ov::element::f16) {
         return side_hint == ov::element::f16 && !enableKVCacheFP16 ? rtPrecision : side_hint;
     }
+#if defined(OPENVINO_ARCH_X86_64)
+    // f8 cache is stored without scales and decoded by the single token codec pipeline, which is x86 only
+    if (any_of(side_hint, ov::element::f8e4m3, ov::element::f8e5m2)) {
+        OPENVINO_ASSERT(!force_legacy_attention(),
+                        "SDPA key/value cache precision ",
+                        side_hint,
+                        " is not supported by the legacy attention path, unset OV_CPU_LEGACY_ATTN or use another "
+                        "kv cache precision");
+        return side_hint;
+    }
+#endif
     return enableKVCacheFP16 ? ov::element::f16 : rtPrecision;
 }
 
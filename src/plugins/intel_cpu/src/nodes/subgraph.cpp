@@ -3,16 +3,23 @@
 //
 #include "subgraph.h"
 
+#include <algorithm>
+#include <chrono>
 #include <climits>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
+#include <sstream>
+#include <string>
 
 #include "common/primitive_hashing_utils.hpp"
+#include "cpu_memory.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
@@ -34,12 +41,14 @@
 #include "snippets/pass/analyze_broadcastable_inputs.hpp"
 #include "snippets/pass/canonicalization.hpp"
 #include "snippets/pass/hash.hpp"
+#include "snippets/pass/norm_fc_tokenization.hpp"
 #include "snippets/pass/positioned_pass.hpp"
 #include "snippets/shape_types.hpp"
 #include "transformations/cpu_opset/common/pass/convert_to_swish_cpu.hpp"
 #include "transformations/snippets/common/pass/lowered/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/common/pass/mul_add_to_fma.hpp"
 #include "transformations/snippets/common/shape_inference.hpp"
+#include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
 #if defined(OPENVINO_ARCH_X86_64)
@@ -96,6 +105,7 @@
 #    include "snippets/lowered/pass/insert_loops.hpp"
 #    include "snippets/pass/fuse_transpose_brgemm.hpp"
 #    include "transformations/snippets/common/pass/enforce_precision.hpp"
+#    include "transformations/snippets/x64/op/brgemm_cpu.hpp"
 #    include "transformations/snippets/x64/pass/brgemm_to_brgemm_cpu.hpp"
 #    include "transformations/snippets/x64/pass/eliminate_brgemm_copy_b.hpp"
 #    include "transformations/snippets/x64/pass/fuse_brgemm_cpu_postops.hpp"
@@ -728,13 +738,16 @@ Subgraph::getControlFlowPasses() {  // NOLINT(readability-convert-member-functio
 
     SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
                                            ov::snippets::lowered::pass::MarkLoops,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking);
+                                           ov::intel_cpu::pass::BrgemmCPUBlocking,
+                                           brgemm_blocking);
     SNIPPETS_REGISTER_PASS_RELATIVE_ARM64(Place::After,
                                           ov::snippets::lowered::pass::MarkLoops,
                                           ov::intel_cpu::pass::GemmCPUBlocking);
-    SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking,
-                                           ov::intel_cpu::pass::ParallelizeGatedMlpNLoops);
+    SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(
+        Place::After,
+        ov::intel_cpu::pass::BrgemmCPUBlocking,
+        ov::intel_cpu::pass::ParallelizeGatedMlpNLoops,
+        ov::snippets::pass::TokenizeNormFCSnippets::is_norm_fc_subgraph(subgraph_attrs->snippet));
 #ifdef SNIPPETS_DEBUG_CAPS
     const auto& debug_config = subgraph_attrs->snippet->get_debug_config();
     if (debug_config.perf_count_mode != snippets::DebugCapsConfig::PerfCountMode::Disabled) {
@@ -866,6 +879,13 @@ void Subgraph::optimizeIR() {
     }
     subgraph->shape_infer(in_shapes);
 
+#if defined(OPENVINO_ARCH_X86_64)
+    selectBrgemmBlocking();
+#endif
+    lowerControlFlow(subgraph);
+}
+
+void Subgraph::lowerControlFlow(const std::shared_ptr<snippets::op::Subgraph>& snippet) {
     const auto control_flow_config = std::make_shared<ov::snippets::lowered::pass::PassConfig>();
     const auto control_flow_passes = getControlFlowPasses();
 
@@ -873,19 +893,159 @@ void Subgraph::optimizeIR() {
     // Note: temporary disabled. Re-enable after ticket 132833 is resolved
     control_flow_config->disable<ov::snippets::lowered::pass::OptimizeDomain>();
 
-    subgraph->set_tile_rank(std::min(2UL, subgraph->infer_master_shape().size()));
+    snippet->set_tile_rank(std::min(2UL, snippet->infer_master_shape().size()));
 #endif
 
     // Note: minimal JIT work amount is a predefined value that describes the number of kernel iterations (work
     // amount) needed to cover kernel call overhead. It is used for balancing between parallel and JIT work amounts
     // in domain optimization.
-    subgraph->control_flow_transformations(static_cast<size_t>(parallel_get_max_threads()),
-                                           256,
-                                           std::make_shared<snippets::CPUShapeInferSnippetsFactory>(),
-                                           control_flow_config,
-                                           control_flow_passes);
+    snippet->control_flow_transformations(static_cast<size_t>(parallel_get_max_threads()),
+                                          256,
+                                          std::make_shared<snippets::CPUShapeInferSnippetsFactory>(),
+                                          control_flow_config,
+                                          control_flow_passes);
 }
 
+#if defined(OPENVINO_ARCH_X86_64)
+void Subgraph::selectBrgemmBlocking() {
+    const auto& config = context->getConfig();
+    const auto& snippet = subgraph_attrs->snippet;
+    if (!config.snippetsBrgemmBlockingTuning || snippet->is_dynamic()) {
+        return;
+    }
+    bool kn_blocking = true;
+    bool has_brgemm = false;
+    for (const auto& op : snippet->body_ptr()->get_ops()) {
+        if (const auto brgemm = ov::as_type_ptr<ov::intel_cpu::BrgemmCPU>(op)) {
+            has_brgemm = true;
+            kn_blocking &=
+                ov::intel_cpu::pass::BrgemmCPUBlocking::is_kn_blocking_supported(brgemm->get_input_element_type(1));
+        }
+    }
+    if (!has_brgemm) {
+        return;
+    }
+
+    auto& database = BrgemmBlockingDatabase::get(config.cacheDir);
+    const auto key = getBrgemmBlockingKey();
+    if (const auto blocks = database.find(key)) {
+        brgemm_blocking = blocks;
+        return;
+    }
+
+    // The heuristic blocking competes with the candidates. N block is defined by the weights repacking,
+    // and K can be blocked only for the precisions supported by the K,N blocking (see BrgemmCPUBlocking)
+    std::vector<BrgemmBlockSizes> candidates{BrgemmBlockSizes{}};
+    for (const size_t m_blk : {16, 32, 64}) {
+        if (!kn_blocking) {
+            candidates.push_back({m_blk, 0, 0});
+            continue;
+        }
+        for (const size_t k_blk : {256, 512, 1024}) {
+            candidates.push_back({m_blk, 0, k_blk});
+        }
+    }
+
+    std::optional<BrgemmBlockSizes> best;
+    auto best_time = std::numeric_limits<double>::max();
+    for (const auto& candidate : candidates) {
+        try {
+            const auto time = benchmarkBrgemmBlocking(candidate);
+            if (time < best_time) {
+                best_time = time;
+                best = candidate;
+            }
+        } catch (const std::exception& e) {
+            DEBUG_LOG("Brgemm blocking candidate is skipped for node ", getName(), ": ", e.what());
+        }
+    }
+    brgemm_blocking.reset();
+    if (!best) {
+        return;
+    }
+    database.store(key, *best);
+    if (!(*best == BrgemmBlockSizes{})) {
+        brgemm_blocking = best;
+    }
+}
+
+std::string Subgraph::getBrgemmBlockingKey() const {
+    // Note: the key has no spaces since it is stored as the first field of the database entry
+    std::ostringstream key;
+    key << static_cast<int>(host_isa) << '_' << subgraph_attrs->bodyHash << "_t" << parallel_get_max_threads();
+    for (size_t i = 0; i < input_num; i++) {
+        key << "_i" << subgraph_attrs->inMemPrecs[i];
+        for (const auto dim : in_shapes[i]) {
+            key << 'x' << dim;
+        }
+    }
+    for (const auto& precision : subgraph_attrs->outMemPrecs) {
+        key << "_o" << precision;
+    }
+    return key.str();
+}
+
+double Subgraph::benchmarkBrgemmBlocking(const BrgemmBlockSizes& blocks) {
+    constexpr size_t benchmark_runs = 3;
+
+    // The candidate is lowered from the copy of the body after the data flow transformations,
+    // since some of them (e.g. constant weights repacking) must not be applied twice
+    brgemm_blocking = blocks;
+    const auto snippet = subgraph_attrs->snippet->clone();
+    std::vector<snippets::VectorDimsRef> shapes(in_shapes.begin(), in_shapes.end());
+    snippet->shape_infer(shapes);
+    lowerControlFlow(snippet);
+
+    auto attrs = std::make_shared<SubgraphAttrs>(*subgraph_attrs);
+    attrs->snippet = snippet;
+    const auto snippet_config = ov::as_type_ptr<CPURuntimeConfig>(snippet->update_runtime_config());
+    const auto code_gen = std::make_shared<SubgraphCodeGenerator>(attrs, snippet_config, external_ptrs_idces);
+    SubgraphBaseExecutor::BufferScratchpadAllocator allocator = [this](size_t size) {
+        return getScratchPadMem(std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, intel_cpu::Shape{size}));
+    };
+    initStartOffsets();
+    SubgraphStaticExecutor executor(snippet_config,
+                                    external_ptrs_idces,
+                                    input_num,
+                                    attrs,
+                                    code_gen,
+                                    start_offset_in,
+                                    start_offset_out,
+                                    allocator,
+                                    context->getSnippetsParamsCache());
+
+    // The node memory may be shared with the other nodes or the states, so the candidates are run on their own
+    // tensors. They are filled with 0x3C bytes, which is a small normal value in every float type and a non-zero
+    // integer, so the timings are not biased by the zero data. The constant inputs (e.g. the repacked weights) are
+    // only read and are used as is.
+    const auto constant_inputs = getConstantInputIndexes();
+    std::vector<MemoryPtr> src(input_num);
+    std::vector<MemoryPtr> dst(output_num);
+    for (size_t i = 0; i < input_num; i++) {
+        if (constant_inputs.count(i)) {
+            src[i] = srcMemPtrs[i];
+            continue;
+        }
+        src[i] = std::make_shared<Memory>(getEngine(), srcMemPtrs[i]->getDescPtr());
+        std::memset(src[i]->getData(), 0x3C, src[i]->getSize());
+    }
+    for (size_t i = 0; i < output_num; i++) {
+        dst[i] = std::make_shared<Memory>(getEngine(), dstMemPtrs[i]->getDescPtr());
+    }
+
+    const dnnl::stream strm(getEngine());
+    // warm-up run
+    executor.execute(strm, src, dst);
+    auto best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < benchmark_runs; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        executor.execute(strm, src, dst);
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+#endif
+
 void Subgraph::prepareParams() {
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64) || defined(OPENVINO_ARCH_RISCV64)
     const auto& cache = context->getSnippetsParamsCache();
@@ -9,7 +9,9 @@
 #include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -25,6 +27,7 @@
 #include "snippets/lowered/pass/pass.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/pass/manager.hpp"
+#include "utils/brgemm_blocking_database.hpp"
 
 #if defined(OPENVINO_ARCH_ARM64)
 #    include "cpu/aarch64/cpu_isa_traits.hpp"
@@ -68,6 +71,12 @@ private:
     void initPluginBlockedShapes() const;
     void updateIsDynamic();
     void optimizeIR();
+    void lowerControlFlow(const std::shared_ptr<snippets::op::Subgraph>& snippet);
+#if defined(OPENVINO_ARCH_X86_64)
+    void selectBrgemmBlocking();
+    std::string getBrgemmBlockingKey() const;
+    double benchmarkBrgemmBlocking(const BrgemmBlockSizes& blocks);
+#endif
 
     snippets::op::Subgraph::BlockedShapeVector getSnippetsBlockedShapes() const;
     std::pair<std::vector<ov::element::Type>, std::vector<ov::element::Type>> getIOPrecisions() const;
@@ -116,6 +125,8 @@ private:
     std::set<size_t> external_ptrs_idces;
 
     bool is_dynamic = false;
+    // Brgemm block sizes chosen by the blocking tuner, the blocking heuristic is used if not set
+    std::optional<BrgemmBlockSizes> brgemm_blocking;
     // Bitmask of inputs pre-packed at compile time (constant weights via RepackMatMulWeights).
     // Cached once in initConstantRepackedMask() right after optimizeIR(), because
     // BrgemmExternalRepackingAdjuster erases already-repacked entries from input_repackers at runtime.
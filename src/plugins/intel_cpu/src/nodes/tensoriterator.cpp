@@ -34,6 +34,7 @@
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
 #include "nodes/node_config.h"
+#include "onednn/dnnl.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -306,15 +307,20 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<>());
     chunk_unit_in_byte = abs_stride * len;
 
-    if (!mem_holder_buffer) {  // else reuse buffer holder of last inference
-        // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations.
+    // the previous inference is the best guess of the iterations count if it isn't known in advance
+    iter_count_hint = num_execs;
+    num_execs = 0;
+
+    // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations,
+    // the buffer holder of the last inference is reused if it's large enough
+    const auto estimated_size = count * chunk_unit_in_byte * static_cast<size_t>(estimate_iters());
+    if (!mem_holder_buffer || mem_holder_buffer->getSize() < estimated_size) {
         mem_holder_buffer = create_buffer(eng);
     }
 
     // reset chunk_offset_in_byte since the first execution
     chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
     chunk_offset_in_byte = stride > 0 ? 0 : (chunk_stride_in_byte - chunk_unit_in_byte);
-    num_execs = 0;
 }
 
 bool DynamicBuffer::check_buffer() const {
@@ -330,17 +336,24 @@ bool DynamicBuffer::check_buffer() const {
     return false;
 }
 
-MemoryPtr DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto abs_stride = std::abs(map_rule.stride);
+int DynamicBuffer::estimate_iters() const {
+    // the trip count is used as the upper boundary unless it's too large to be a realistic one (e.g. INT_MAX
+    // in the while loops), since the buffer grows anyway when the estimation is exceeded
+    constexpr size_t max_preallocated_size = size_t{256} * 1024 * 1024;
+    if (max_iter_count != -1 &&
+        count * chunk_unit_in_byte * static_cast<size_t>(max_iter_count) <= max_preallocated_size) {
+        return std::max(max_iter_count, num_execs + 1);
+    }
 
-    const auto estimate_iters = [&]() {
-        if (max_iter_count != -1) {
-            return max_iter_count;
-        }
+    // in case of no idea of memory upper boundary
+    if (num_execs == 0) {
+        return std::max(iter_count_hint, 1);
+    }
+    return 2 * num_execs;  // growth factor 2
+}
 
-        // in case of no idea of memory upper boundary
-        return (num_execs == 0) ? 1 : 2 * num_execs;  // growth factor 2
-    };
+MemoryPtr DynamicBuffer::create_buffer(const dnnl::engine& eng) {
+    const auto abs_stride = std::abs(map_rule.stride);
     const auto estimated_iters = estimate_iters();
     const Shape _shape = Shape({count, static_cast<size_t>(abs_stride * estimated_iters), len / elem_size});
     auto _descCreator = BlockedDescCreator::getCommonCreators().at(LayoutType::ncsp);
@@ -445,6 +458,14 @@ void DynamicBuffer::copy(const uint8_t* src,
                          const size_t count,
                          const size_t len,
                          const std::shared_ptr<CpuParallel>& cpu_parallel) {
+    // the chunk of a single iteration is usually small, so the threads are not worth waking up for it
+    const size_t l2_cache_size = dnnl::utils::get_cache_size(2, true);
+    if (count * len < l2_cache_size) {
+        for (size_t i = 0; i < count; i++) {
+            cpu_memcpy(&dst[i * dst_stride], &src[i * src_stride], len);
+        }
+        return;
+    }
     cpu_parallel->parallel_for(count, [&](const size_t i) {
         cpu_memcpy(&dst[i * dst_stride], &src[i * src_stride], len);
     });
@@ -815,6 +836,17 @@ void TensorIterator::prepareBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
+    // a body input shares the desc of the body output it was redefined to, so the mappers created for them are reused
+    // until one of the memories is redefined again
+    const bool descs_changed = back_mappers.size() != backEdges.size() ||
+                               std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& map_rule) {
+                                   return output_mem[map_rule.from]->getDescPtr() !=
+                                          input_mems[map_rule.to].front()->getDescPtr();
+                               });
+    if (!descs_changed) {
+        return;
+    }
+
     back_mappers.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
@@ -89,6 +89,7 @@ private:
 
     /* methods for resize and refill buffer */
     [[nodiscard]] bool check_buffer() const;
+    [[nodiscard]] int estimate_iters() const;
     MemoryPtr create_buffer(const dnnl::engine& eng);
     void move_buffer(const MemoryPtr& new_buffer);
     void move_data();
@@ -110,6 +111,7 @@ private:
     size_t chunk_unit_in_byte = 0LU;  // the amount of bytes copied per each count per each execution (iteration)
     int num_execs = 0LU;              // number of executions happened
     int max_iter_count = -1;          // estimated maximum iter count
+    int iter_count_hint = 0;          // number of executions happened during the previous inference
 
     /* invariable states */
     MemoryPtr from;
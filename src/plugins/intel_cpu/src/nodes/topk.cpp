@@ -5,10 +5,12 @@
 #include "topk.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -16,10 +18,12 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
@@ -30,6 +34,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/topk.hpp"
@@ -2092,6 +2097,9 @@ void TopK::prepareParams() {
                     src_dims[axis],
                     ").");
 
+    data_precision = srcMemPtr->getDesc().getPrecision();
+    radix_select = can_use_radix_select();
+
     if (jit_mode) {
         if (!preset_params_done) {
             preset_params();
@@ -2171,7 +2179,8 @@ void TopK::createPrimitive() {
         updateLastInputDims();
     }
 
-    if (jit_mode) {
+    // static shapes selected by radix select don't need the sorting kernel
+    if (jit_mode && (isDynamicNode() || !radix_select)) {
         if (!preset_params_done) {
             preset_params();
             preset_params_done = true;
@@ -2238,7 +2247,9 @@ void TopK::execute([[maybe_unused]] const dnnl::stream& strm) {
     auto* dst_data = dstMemPtr->getDataAs<uint8_t>();
     auto* dst_idx = dstIndexesMemPtr->getDataAs<uint8_t>();
 
-    if (jit_mode) {
+    if (radix_select) {
+        radix_select_process(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2475,6 +2486,233 @@ void TopK::calc_dims_size(const VectorDims& layout_dims) {
     }
 }
 
+namespace {
+// Radix select processes 8 bits of the key per pass, so 4 passes resolve a 32 bit key.
+constexpr uint32_t radix_bits = 8;
+constexpr uint32_t radix_bins = 1U << radix_bits;
+constexpr uint32_t radix_key_bits = 32;
+// Minimal chunk of the axis processed by a thread, when a row is split between threads.
+constexpr size_t radix_min_chunk = 4096;
+
+using RadixHistogram = std::array<uint32_t, radix_bins>;
+using RadixItem = std::pair<uint32_t, int32_t>;  // {key, index}
+
+// Maps a value to an unsigned key of the same order.
+template <typename T>
+inline uint32_t to_radix_key(T value) {
+    if constexpr (std::is_same_v<T, int32_t>) {
+        return static_cast<uint32_t>(value) ^ 0x80000000U;
+    } else {
+        uint32_t bits = 0;
+        if constexpr (std::is_same_v<T, ov::bfloat16>) {
+            bits = static_cast<uint32_t>(value.to_bits()) << 16;
+        } else {
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+        return (bits & 0x80000000U) != 0 ? ~bits : (bits | 0x80000000U);
+    }
+}
+
+inline uint32_t radix_digit(uint32_t key, uint32_t shift) {
+    return (key >> shift) & (radix_bins - 1);
+}
+
+// Finds the bin which contains the k-th largest key and the number of keys in the higher bins.
+inline std::pair<uint32_t, size_t> find_radix_bin(const RadixHistogram& histogram, size_t k) {
+    size_t above = 0;
+    uint32_t bin = radix_bins - 1;
+    for (; bin > 0 && above + histogram[bin] < k; bin--) {
+        above += histogram[bin];
+    }
+    return {bin, above};
+}
+
+/**
+ * Selects top K of each row of the [rows, n] tensor:
+ * 1. the histogram of the most significant digit of the keys is collected, splitting the row between threads if there
+ *    are fewer rows than threads, and the digit of the K-th key is found;
+ * 2. the keys of the higher digits are selected and the keys of the found digit are compacted as candidates;
+ * 3. the candidates are refined with the next digits until the K-th key is found exactly, the candidates equal to it
+ *    are taken in the order of indices, so the selection is stable;
+ * 4. the K survivors are sorted.
+ */
+template <typename T>
+void radix_select(const T* src,
+                  T* dst,
+                  int32_t* dst_idx,
+                  size_t rows,
+                  size_t n,
+                  size_t k,
+                  bool mode_max,
+                  bool sort_index,
+                  const CpuParallel& cpu_parallel) {
+    const auto nthr = static_cast<size_t>(cpu_parallel.get_num_worker_threads());
+    const size_t chunks = rows >= nthr ? 1 : std::max<size_t>(1, std::min(div_up(nthr, rows), n / radix_min_chunk));
+    const size_t chunk_size = div_up(n, chunks);
+    // min mode selects the largest inverted keys
+    const uint32_t flip = mode_max ? 0U : ~0U;
+    constexpr uint32_t first_shift = radix_key_bits - radix_bits;
+
+    std::vector<RadixHistogram> histograms(rows * chunks);
+    cpu_parallel.parallel_for2d(rows, chunks, [&](size_t r, size_t c) {
+        auto& histogram = histograms[r * chunks + c];
+        histogram.fill(0);
+        const T* row = src + r * n;
+        for (size_t i = c * chunk_size; i < std::min(n, (c + 1) * chunk_size); i++) {
+            histogram[radix_digit(to_radix_key(row[i]) ^ flip, first_shift)]++;
+        }
+    });
+
+    // {selected, candidates} offsets of each chunk in the row items
+    std::vector<std::pair<size_t, size_t>> offsets(rows * chunks);
+    std::vector<std::vector<RadixItem>> items(rows);
+    std::vector<std::pair<uint32_t, size_t>> bins(rows);
+    cpu_parallel.parallel_for(rows, [&](size_t r) {
+        RadixHistogram histogram{};
+        for (size_t c = 0; c < chunks; c++) {
+            for (uint32_t bin = 0; bin < radix_bins; bin++) {
+                histogram[bin] += histograms[r * chunks + c][bin];
+            }
+        }
+        const auto [bin, above] = find_radix_bin(histogram, k);
+        bins[r] = {bin, above};
+        size_t selected = 0;
+        size_t candidates = above;
+        for (size_t c = 0; c < chunks; c++) {
+            const auto& local = histograms[r * chunks + c];
+            offsets[r * chunks + c] = {selected, candidates};
+            selected += std::accumulate(local.begin() + bin + 1, local.end(), size_t{0});
+            candidates += local[bin];
+        }
+        items[r].resize(candidates);
+    });
+
+    cpu_parallel.parallel_for2d(rows, chunks, [&](size_t r, size_t c) {
+        const T* row = src + r * n;
+        const auto bin = bins[r].first;
+        auto [selected, candidates] = offsets[r * chunks + c];
+        auto& row_items = items[r];
+        for (size_t i = c * chunk_size; i < std::min(n, (c + 1) * chunk_size); i++) {
+            const auto key = to_radix_key(row[i]) ^ flip;
+            const auto digit = radix_digit(key, first_shift);
+            if (digit > bin) {
+                row_items[selected++] = {key, static_cast<int32_t>(i)};
+            } else if (digit == bin) {
+                row_items[candidates++] = {key, static_cast<int32_t>(i)};
+            }
+        }
+    });
+
+    cpu_parallel.parallel_for(rows, [&](size_t r) {
+        auto& row_items = items[r];
+        size_t selected = bins[r].second;
+        std::vector<RadixItem> equal;
+        for (uint32_t shift = first_shift; shift > 0 && row_items.size() > k;) {
+            shift -= radix_bits;
+            RadixHistogram histogram{};
+            for (size_t i = selected; i < row_items.size(); i++) {
+                histogram[radix_digit(row_items[i].first, shift)]++;
+            }
+            const auto [bin, above] = find_radix_bin(histogram, k - selected);
+            // candidates keep the order of indices, the ones of higher digits are selected
+            equal.clear();
+            size_t end = selected;
+            for (size_t i = selected; i < row_items.size(); i++) {
+                const auto digit = radix_digit(row_items[i].first, shift);
+                if (digit > bin) {
+                    row_items[end++] = row_items[i];
+                } else if (digit == bin) {
+                    equal.push_back(row_items[i]);
+                }
+            }
+            std::copy(equal.begin(), equal.end(), row_items.begin() + end);
+            row_items.resize(end + equal.size());
+            selected = end;
+        }
+        // the remaining candidates are equal, so the ones with the lowest indices are taken
+        row_items.resize(k);
+
+        if (sort_index) {
+            std::sort(row_items.begin(), row_items.end(), [](const RadixItem& a, const RadixItem& b) {
+                return a.second < b.second;
+            });
+        } else {
+            std::sort(row_items.begin(), row_items.end(), [](const RadixItem& a, const RadixItem& b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+        }
+        const T* row = src + r * n;
+        for (size_t i = 0; i < k; i++) {
+            dst[r * k + i] = row[row_items[i].second];
+            dst_idx[r * k + i] = row_items[i].second;
+        }
+    });
+}
+}  // namespace
+
+// Radix select scans the axis a constant number of times regardless of K, so it is preferred over the sorting networks
+// and the heap sort for the long axes (e.g. LLM vocabularies), unless K is small enough for the in-register bubble sort
+// or so large that sorting of the survivors dominates. The axis has to be dense, i.e. the innermost one of a planar
+// layout.
+bool TopK::can_use_radix_select() const {
+    constexpr size_t min_axis_dim = 4096;
+    constexpr size_t min_top_k = 8;
+    constexpr size_t max_top_k_ratio = 16;
+
+    const auto rank = src_dims.size();
+    const bool dense_axis = (layout == TopKLayoutType::topk_ncsp && axis == rank - 1) ||
+                            (layout == TopKLayoutType::topk_nspc && axis == 1 && rank > 2);
+    const auto k = static_cast<size_t>(top_k);
+    return dense_axis && any_of(data_precision, ov::element::f32, ov::element::bf16, ov::element::i32) &&
+           src_dims[axis] >= min_axis_dim && k >= min_top_k && k * max_top_k_ratio <= src_dims[axis];
+}
+
+void TopK::radix_select_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr) const {
+    const auto& cpu_parallel = *context->getCpuParallel();
+    const auto n = src_dims[axis];
+    const auto rows = std::accumulate(src_dims.begin(), src_dims.end(), size_t{1}, std::multiplies<>()) / n;
+    const auto k = static_cast<size_t>(top_k);
+    auto* dst_idx = reinterpret_cast<int32_t*>(out_idx_ptr);
+
+    switch (data_precision) {
+    case ov::element::f32:
+        radix_select(reinterpret_cast<const float*>(in_ptr),
+                     reinterpret_cast<float*>(out_ptr),
+                     dst_idx,
+                     rows,
+                     n,
+                     k,
+                     mode_max,
+                     sort_index,
+                     cpu_parallel);
+        break;
+    case ov::element::bf16:
+        radix_select(reinterpret_cast<const ov::bfloat16*>(in_ptr),
+                     reinterpret_cast<ov::bfloat16*>(out_ptr),
+                     dst_idx,
+                     rows,
+                     n,
+                     k,
+                     mode_max,
+                     sort_index,
+                     cpu_parallel);
+        break;
+    case ov::element::i32:
+        radix_select(reinterpret_cast<const int32_t*>(in_ptr),
+                     reinterpret_cast<int32_t*>(out_ptr),
+                     dst_idx,
+                     rows,
+                     n,
+                     k,
+                     mode_max,
+                     sort_index,
+                     cpu_parallel);
+        break;
+    default:
+        CPU_NODE_THROW("doesn't support radix select for precision: ", data_precision);
+    }
+}
+
 void TopK::topk_ref(const float* in_ptr, float* out_ptr, int32_t* dst_idx) {
     if (mode_max) {
         topk_ref_process(in_ptr, out_ptr, dst_idx, src_dims, [](float x, float y) -> bool {
@@ -102,6 +102,8 @@ public:
 private:
     void topk_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr);
     void topk_ref(const float* in_ptr, float* out_ptr, int32_t* dst_idx);
+    bool can_use_radix_select() const;
+    void radix_select_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr) const;
     inline void topk_kernel_process(const uint8_t* in_p,
                                     uint8_t* out_p,
                                     uint8_t* out_idx_p,
@@ -138,6 +140,8 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    bool radix_select = false;
+    ov::element::Type data_precision;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
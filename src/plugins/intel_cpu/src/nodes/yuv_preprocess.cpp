@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "kernels/yuv_preprocess_kernel.hpp"
+#include "node.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+bool YuvPreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                         std::string& errorMessage) noexcept {
+    try {
+        if (!ov::as_type_ptr<const YuvPreprocessNode>(op)) {
+            errorMessage = "Only YuvPreprocess from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+YuvPreprocess::YuvPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    m_config = ov::as_type_ptr<const YuvPreprocessNode>(op)->get_config();
+    m_linear = m_config.resize_mode == "linear";
+}
+
+bool YuvPreprocess::created() const {
+    return getType() == Type::YuvPreprocess;
+}
+
+void YuvPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    m_precision = getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    // bf16 comes either from the fused Convert or from the enforced inference precision
+    m_dst_precision = getOriginalOutputPrecisionAtPort(0);
+    if (none_of(m_dst_precision, ov::element::f32, ov::element::bf16, ov::element::u8)) {
+        m_dst_precision = ov::element::f32;
+    }
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, m_precision});
+
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, m_dst_precision}}, impl_desc_type::ref_any);
+}
+
+void YuvPreprocess::computeTaps(Taps& taps, size_t src_size, size_t dst_size) const {
+    taps.first.resize(dst_size);
+    taps.second.resize(dst_size);
+    taps.weight.resize(dst_size);
+
+    const float scale = static_cast<float>(dst_size) / static_cast<float>(src_size);
+    const auto last = static_cast<float>(src_size - 1);
+    for (size_t i = 0; i < dst_size; i++) {
+        // half_pixel coordinate transformation
+        float coord = dst_size > 1 ? (static_cast<float>(i) + 0.5F) / scale - 0.5F : 0.F;
+        if (m_linear) {
+            coord = std::min(std::max(coord, 0.F), last);
+            taps.first[i] = static_cast<int32_t>(coord);
+            taps.second[i] = std::min(taps.first[i] + 1, static_cast<int32_t>(src_size - 1));
+            taps.weight[i] = coord - static_cast<float>(taps.first[i]);
+        } else {
+            // round_prefer_floor
+            const float floor = std::floor(coord);
+            coord = coord == floor + 0.5F ? floor : std::round(coord);
+            taps.first[i] = static_cast<int32_t>(std::min(std::max(coord, 0.F), last));
+            taps.second[i] = taps.first[i];
+            taps.weight[i] = 0.F;
+        }
+    }
+}
+
+void YuvPreprocess::prepareParams() {
+    const auto& srcDims = getSrcMemoryAtPort(0)->getStaticDims();
+    // A single plane image keeps both luma and chroma: [N, H * 3 / 2, W, 1]
+    m_src_height = getOriginalInputsNumber() == 1 ? srcDims[1] * 2 / 3 : srcDims[1];
+    m_src_width = srcDims[2];
+    CPU_NODE_ASSERT(m_src_height % 2 == 0 && m_src_width % 2 == 0, "expects even image height and width");
+
+    computeTaps(m_rows, m_src_height, static_cast<size_t>(m_config.height));
+    computeTaps(m_cols, m_src_width, static_cast<size_t>(m_config.width));
+
+    // Chroma is either interleaved UV of NV12 or separate U and V planes of I420.
+    const int32_t uv_step = m_config.i420 ? 1 : 2;
+    const auto dst_width = static_cast<size_t>(m_config.width);
+    m_uv_first.resize(dst_width);
+    m_uv_second.resize(dst_width);
+    for (size_t i = 0; i < dst_width; i++) {
+        m_uv_first[i] = m_cols.first[i] / 2 * uv_step;
+        m_uv_second[i] = m_cols.second[i] / 2 * uv_step;
+    }
+
+    m_threads_num = parallel_get_max_threads();
+    m_scratch.resize(m_threads_num * 6 * dst_width);
+}
+
+void YuvPreprocess::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const size_t batch = getSrcMemoryAtPort(0)->getStaticDims()[0];
+    const size_t width = m_src_width;
+    const size_t plane_size = m_src_height * m_src_width;
+    const size_t src_size = m_precision.size();
+
+    const auto* y_base = getSrcDataAtPortAs<const uint8_t>(0);
+    const uint8_t* u_base = nullptr;
+    const uint8_t* v_base = nullptr;
+    size_t y_batch_stride = plane_size;
+    size_t uv_batch_stride = 0;
+    if (getOriginalInputsNumber() == 1) {
+        y_batch_stride = plane_size * 3 / 2;
+        uv_batch_stride = y_batch_stride;
+        u_base = y_base + plane_size * src_size;
+        v_base = m_config.i420 ? u_base + plane_size / 4 * src_size : u_base + src_size;
+    } else {
+        u_base = getSrcDataAtPortAs<const uint8_t>(1);
+        v_base = m_config.i420 ? getSrcDataAtPortAs<const uint8_t>(2) : u_base + src_size;
+        uv_batch_stride = m_config.i420 ? plane_size / 4 : plane_size / 2;
+    }
+    const size_t uv_row_stride = m_config.i420 ? width / 2 : width;
+
+    const auto dst_height = static_cast<size_t>(m_config.height);
+    const auto dst_width = static_cast<size_t>(m_config.width);
+    const size_t channel_stride = m_config.planar ? dst_height * dst_width : 1;
+    const size_t pixel_stride = m_config.planar ? 1 : 3;
+    auto* dst = getDstDataAtPortAs<uint8_t>(0);
+    const size_t dst_size = m_dst_precision.size();
+
+    // Every output row reads only the source pixels it interpolates, so neither the decoded nor the resized full
+    // size image is ever materialized.
+    context->getCpuParallel()->parallel_for2d(batch, dst_height, [&](size_t b, size_t oy) {
+        const auto* y = y_base + b * y_batch_stride * src_size;
+        const auto* u = u_base + b * uv_batch_stride * src_size;
+        const auto* v = v_base + b * uv_batch_stride * src_size;
+        ov::Extensions::Cpu::YuvPreprocessRow row{};
+        const size_t src_rows[2] = {static_cast<size_t>(m_rows.first[oy]), static_cast<size_t>(m_rows.second[oy])};
+        for (size_t i = 0; i < 2; i++) {
+            row.y[i] = y + src_rows[i] * width * src_size;
+            row.u[i] = u + src_rows[i] / 2 * uv_row_stride * src_size;
+            row.v[i] = v + src_rows[i] / 2 * uv_row_stride * src_size;
+        }
+        row.wy = m_rows.weight[oy];
+        row.x0 = m_cols.first.data();
+        row.x1 = m_cols.second.data();
+        row.c0 = m_uv_first.data();
+        row.c1 = m_uv_second.data();
+        row.wx = m_cols.weight.data();
+        row.width = dst_width;
+        row.linear = m_linear;
+        row.bgr = m_config.bgr;
+        row.round_color = m_config.round_color;
+        row.scale = m_config.scale.data();
+        row.shift = m_config.shift.data();
+        row.dst = dst + (b * 3 * dst_height * dst_width + oy * dst_width * pixel_stride) * dst_size;
+        row.channel_stride = channel_stride;
+        row.pixel_stride = pixel_stride;
+        row.scratch = m_scratch.data() + parallel_get_thread_num() * 6 * dst_width;
+        ov::Extensions::Cpu::XARCH::yuv_preprocess_row(row, m_precision, m_dst_precision);
+    });
+}
+
+void YuvPreprocess::executeDynamicImpl(const dnnl::stream& strm) {
+    execute(strm);
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "graph_context.h"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+
+namespace ov::intel_cpu::node {
+
+class YuvPreprocess : public Node {
+public:
+    YuvPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(const dnnl::stream& strm) override;
+    void prepareParams() override;
+
+private:
+    // Source coordinates of an output row or column and the weight of the second one.
+    struct Taps {
+        std::vector<int32_t> first;
+        std::vector<int32_t> second;
+        std::vector<float> weight;
+    };
+
+    void computeTaps(Taps& taps, size_t src_size, size_t dst_size) const;
+
+    YuvPreprocessNode::Config m_config;
+    bool m_linear = false;
+    ov::element::Type m_precision;
+    ov::element::Type m_dst_precision;
+    size_t m_src_height = 0;
+    size_t m_src_width = 0;
+    Taps m_rows;
+    Taps m_cols;
+    // chroma offsets of the horizontal taps
+    std::vector<int32_t> m_uv_first;
+    std::vector<int32_t> m_uv_second;
+    // per thread buffers of the gathered pixels and of the decoded planes
+    std::vector<float> m_scratch;
+    size_t m_threads_num = 0;
+};
+
+}  // namespace ov::intel_cpu::node
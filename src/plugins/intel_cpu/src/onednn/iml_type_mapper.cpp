@@ -56,6 +56,8 @@ impl_desc_type parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD_2(dw, _dw);
     SEARCH_WORD(reorder);
     SEARCH_WORD(sparse);
+    SEARCH_WORD(gemv);
+    SEARCH_WORD(inverted_residual);
     SEARCH_WORD(acl);
     SEARCH_WORD(kleidiai);
     SEARCH_WORD(asimd);
@@ -118,6 +120,12 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(jit_sse42_dw);
     CASE(jit_uni_dw);
     CASE(jit_avx512_amx);
+    CASE(jit_sparse_avx512);
+    CASE(jit_sparse_avx2);
+    CASE(jit_gemv_avx512);
+    CASE(jit_gemv_avx2);
+    CASE(jit_inverted_residual_avx512);
+    CASE(jit_inverted_residual_avx2);
     CASE(jit_avx512_amx_1x1);
     CASE(jit_avx512_amx_dw);
     CASE(jit_avx2_1x1_dw);
@@ -147,6 +155,7 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(gemm_acl);
     CASE(winograd_acl);
     CASE(gemm_mlas);
+    CASE(winograd_mlas);
     CASE(jit_asimd);
     CASE(jit_sve128);
     CASE(jit_sve256);
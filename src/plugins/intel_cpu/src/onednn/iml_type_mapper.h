@@ -52,6 +52,12 @@ enum impl_desc_type : int64_t {
 
     kleidiai = 1LL << 33,
 
+    // matrix-vector product
+    gemv = 1LL << 34,
+
+    // fused 1x1 expand -> depthwise -> 1x1 project convolutions
+    inverted_residual = 1LL << 35,
+
     // real types
     ref_any = ref | any,
 
@@ -70,6 +76,12 @@ enum impl_desc_type : int64_t {
     jit_sse42 = jit | sse42,
     jit_uni = jit | uni,
     jit_avx512_amx = jit | avx512 | amx,
+    jit_sparse_avx512 = jit | sparse | avx512,
+    jit_sparse_avx2 = jit | sparse | avx2,
+    jit_gemv_avx512 = jit | gemv | avx512,
+    jit_gemv_avx2 = jit | gemv | avx2,
+    jit_inverted_residual_avx512 = jit | inverted_residual | avx512,
+    jit_inverted_residual_avx2 = jit | inverted_residual | avx2,
 
     jit_avx512_1x1 = jit | avx512 | _1x1,
     jit_avx2_1x1 = jit | avx2 | _1x1,
@@ -116,6 +128,7 @@ enum impl_desc_type : int64_t {
     gemm_acl = gemm | acl,
     winograd_acl = winograd | acl,
     gemm_mlas = gemm | mlas,
+    winograd_mlas = winograd | mlas,
 
     jit_asimd = jit | asimd,
     jit_sve128 = jit | sve128,
@@ -4,6 +4,7 @@
 
 #include "plugin.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <filesystem>
@@ -26,12 +27,14 @@
 #    pragma warning(disable : 4244 4267 4334)
 #endif
 
+#include "cache/jit_kernel_registry.h"
 #include "compiled_model.h"
 #include "config.h"
 #include "cpu_streams_calculation.hpp"
 #include "graph_context.h"
 #include "internal_properties.hpp"
 #include "itt.h"
+#include "micro_batcher.h"
 #include "node.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -344,6 +347,37 @@ static Config::ModelType getModelType(const std::shared_ptr<const Model>& model)
     return Config::ModelType::Unknown;
 }
 
+// Compiles a batched copy of the model for the micro-batching of the concurrent requests, if it's enabled and the
+// model is eligible. The imported models are transformed already, so their copies are batched as they are.
+static void enableMicroBatching(CompiledModel& compiled_model,
+                                const std::shared_ptr<const ov::Model>& model,
+                                const Config& conf,
+                                bool transform) {
+    if (conf.microBatchSize <= 1 || conf.hintPerfMode != ov::hint::PerformanceMode::THROUGHPUT ||
+        conf.numSubStreams != 0 || conf.exclusiveAsyncRequests || conf.enableAdaptiveStreams) {
+        return;
+    }
+    auto batched_model = MicroBatcher::make_batched_model(model, conf.microBatchSize);
+    if (!batched_model) {
+        return;
+    }
+    // One batched execution replaces up to microBatchSize direct ones, so the streams get proportionally wider
+    Config batched_conf = conf;
+    const int batch = static_cast<int>(conf.microBatchSize);
+    const int streams = std::max(1, conf.streamExecutorConfig.get_streams() / batch);
+    const int threads = std::max(1, conf.streamExecutorConfig.get_threads() / streams);
+    batched_conf.streamExecutorConfig = IStreamsExecutor::Config{"CPUMicroBatchStreamsExecutor", streams, threads};
+
+    if (transform) {
+        Transformations batched_transformations(batched_model, batched_conf);
+        batched_transformations.UpToLpt();
+        batched_transformations.PostLpt();
+        batched_transformations.Snippets();
+        batched_transformations.CpuSpecificOpSet();
+    }
+    compiled_model.enable_micro_batching(batched_model, batched_conf);
+}
+
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                           const ov::AnyMap& orig_config) const {
     OV_ITT_SCOPED_TASK(itt::domains::ov_intel_cpu, "Plugin::compile_model");
@@ -370,6 +404,12 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     }
 
     const auto& config = orig_config;
+    // the JIT kernels cache is process wide, it's configured on the plugin only
+    if (config.find(ov::intel_cpu::jit_kernels_cache_capacity.name()) != config.end()) {
+        OPENVINO_THROW("Property ",
+                       ov::intel_cpu::jit_kernels_cache_capacity.name(),
+                       " can't be passed to compile_model, set it on the plugin instead");
+    }
     const std::shared_ptr<ov::Model> cloned_model = model->clone();
     Config::ModelType modelType = getModelType(model);
     DEBUG_LOG(PrintableModel(*cloned_model, "org_"));
@@ -429,7 +469,11 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         }
     }
 #endif
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+
+    // The batched graph is compiled from the original model, so the transformations see the relaxed batch
+    enableMicroBatching(*compiled_model, model, conf, true);
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -438,6 +482,9 @@ void Plugin::set_property(const ov::AnyMap& config) {
     streamsExplicitlySetForEngine = streamsSet(config);
 
     engConfig.readProperties(config);
+    if (config.find(ov::intel_cpu::jit_kernels_cache_capacity.name()) != config.end()) {
+        JitKernelRegistry::instance().setCacheCapacity(engConfig.jitKernelsCacheCapacity);
+    }
 }
 
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options) const {
@@ -552,6 +599,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         return decltype(ov::weights_path)::value_type(std::string(""));
     }
 
+    if (name == ov::cache_dir) {
+        return decltype(ov::cache_dir)::value_type{engConfig.cacheDir};
+    }
     if (name == ov::enable_weightless) {
         return decltype(ov::enable_weightless)::value_type{engConfig.enableWeightless};
     }
@@ -609,7 +659,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::value_cache_precision.name()),
                                                    RW_property(ov::key_cache_group_size.name()),
                                                    RW_property(ov::value_cache_group_size.name()),
-                                                   RW_property(ov::enable_weightless.name())};
+                                                   RW_property(ov::enable_weightless.name()),
+                                                   RW_property(ov::cache_dir.name())};
 
         std::vector<ov::PropertyName> wo_properties{WO_property(ov::weights_path.name())};
 
@@ -683,6 +734,13 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
     if (name == ov::intel_cpu::tbb_partitioner) {
         return static_cast<decltype(ov::intel_cpu::tbb_partitioner)::value_type>(engConfig.tbbPartitioner);
     }
+    if (name == ov::intel_cpu::jit_kernels_stats) {
+        return decltype(ov::intel_cpu::jit_kernels_stats)::value_type(JitKernelRegistry::instance().getStats());
+    }
+    if (name == ov::intel_cpu::jit_kernels_cache_capacity) {
+        return decltype(ov::intel_cpu::jit_kernels_cache_capacity)::value_type(
+            JitKernelRegistry::instance().getCacheCapacity());
+    }
     if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{get_device_name()};
     }
@@ -902,6 +960,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
     // import config props from caching model
     calculate_streams(conf, model, true);
     auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    enableMicroBatching(*compiled_model, model, conf, false);
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
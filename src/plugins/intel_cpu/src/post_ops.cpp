@@ -444,6 +444,11 @@ PostOps getPostOps(const std::vector<NodePtr>& fused, ov::element::Type_t sumDat
         }
 
         if (const auto conv = std::dynamic_pointer_cast<node::Convolution>(node)) {
+            if (!conv->isDepthWise()) {
+                ops.push_back(std::make_any<PointwiseConvolutionPostOp>(conv->getOutputShapeAtPort(0).getDims()[1]));
+                continue;
+            }
+
             const auto& inputShape = conv->getInputShapeAtPort(0);
             const auto& inActivationDims = inputShape.getStaticDims();
             const size_t ih = inActivationDims[inputShape.getRank() - 2];
@@ -258,6 +258,19 @@ private:
     std::vector<size_t> m_strides;
 };
 
+// a 1x1 convolution fused after the DepthwiseConvolutionPostOp (the project convolution of an inverted residual block)
+// the post ops following it are applied to its output
+struct PointwiseConvolutionPostOp {
+    explicit PointwiseConvolutionPostOp(size_t oc) : m_oc(oc) {}
+
+    [[nodiscard]] size_t oc() const {
+        return m_oc;
+    }
+
+private:
+    size_t m_oc;
+};
+
 struct SumPostOp {
     SumPostOp(float scale, int32_t zero_point, ov::element::Type_t dataType)
         : m_scale(scale),
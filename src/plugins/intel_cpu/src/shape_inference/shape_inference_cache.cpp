@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference_cache.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/primitive_hashing_utils.hpp"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/except.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+size_t ShapeInferCached::Key::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& item : dims) {
+        seed = get_vector_hash(seed, item);
+    }
+    return seed;
+}
+
+bool ShapeInferCached::Key::operator==(const Key& rhs) const {
+    return dims == rhs.dims;
+}
+
+ShapeInferCached::ShapeInferCached(ShapeInferPtr shapeInfer, size_t capacity)
+    : m_shapeInfer(std::move(shapeInfer)),
+      m_cache(capacity) {
+    OPENVINO_ASSERT(m_shapeInfer, "ShapeInferCached: shape inference is not defined");
+    OPENVINO_ASSERT(m_shapeInfer->get_port_mask() == EMPTY_PORT_MASK,
+                    "ShapeInferCached: data dependent shape inference can't be memoized");
+}
+
+IShapeInfer::Result ShapeInferCached::infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                                            const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    Key key;
+    key.dims.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.dims.push_back(shape.get());
+    }
+
+    if (auto entry = m_cache.get(key)) {
+        m_hits++;
+        m_padsBegin = entry->padsBegin;
+        m_padsEnd = entry->padsEnd;
+        return {entry->dims, ShapeInferStatus::success};
+    }
+
+    m_misses++;
+    auto result = m_shapeInfer->infer(input_shapes, data_dependency);
+    m_padsBegin = m_shapeInfer->get_pads_begin();
+    m_padsEnd = m_shapeInfer->get_pads_end();
+    if (result.status == ShapeInferStatus::success) {
+        m_cache.put(key, std::make_shared<const Entry>(Entry{result.dims, m_padsBegin, m_padsEnd}));
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
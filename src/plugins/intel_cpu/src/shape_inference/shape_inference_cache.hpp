@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Shape inference decorator which memoizes the results of the recently seen input shapes. Dynamic models usually
+ * cycle through a small set of input shapes (e.g. padded sequence lengths), so switching back to a seen shape reuses
+ * the output dims and paddings instead of running the shape inference again.
+ * Only shape inferences which do not depend on the input data (empty port mask) can be memoized.
+ */
+class ShapeInferCached final : public IShapeInfer {
+public:
+    // Enough for the handful of recurring shapes, while keeping the per node overhead small.
+    static constexpr size_t defaultCapacity = 8;
+
+    ShapeInferCached(ShapeInferPtr shapeInfer, size_t capacity);
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return m_padsBegin;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return m_padsEnd;
+    }
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return m_shapeInfer->get_port_mask();
+    }
+
+    [[nodiscard]] size_t hits() const {
+        return m_hits;
+    }
+    [[nodiscard]] size_t misses() const {
+        return m_misses;
+    }
+
+private:
+    struct Key {
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const;
+
+        std::vector<VectorDims> dims;
+    };
+
+    struct Entry {
+        std::vector<VectorDims> dims;
+        ov::CoordinateDiff padsBegin;
+        ov::CoordinateDiff padsEnd;
+    };
+
+    ShapeInferPtr m_shapeInfer;
+    LruCache<Key, std::shared_ptr<const Entry>> m_cache;
+    ov::CoordinateDiff m_padsBegin;
+    ov::CoordinateDiff m_padsEnd;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+};
+
+}  // namespace ov::intel_cpu
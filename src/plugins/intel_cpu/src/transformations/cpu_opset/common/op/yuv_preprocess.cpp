@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::YuvPreprocessNode::YuvPreprocessNode(const OutputVector& args, Config cfg)
+    : Op(args),
+      m_config(std::move(cfg)) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::YuvPreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::YuvPreprocessNode>(new_args, m_config);
+}
+
+bool ov::intel_cpu::YuvPreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("i420", m_config.i420);
+    visitor.on_attribute("bgr", m_config.bgr);
+    visitor.on_attribute("round_color", m_config.round_color);
+    visitor.on_attribute("resize_mode", m_config.resize_mode);
+    visitor.on_attribute("height", m_config.height);
+    visitor.on_attribute("width", m_config.width);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.on_attribute("planar", m_config.planar);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::YuvPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(YuvPreprocessNode_validate_and_infer_types);
+    const auto planes = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+                          planes == 1 || planes == (m_config.i420 ? 3U : 2U),
+                          "unexpected number of image planes: ",
+                          planes);
+    NODE_VALIDATION_CHECK(this,
+                          m_config.resize_mode == "linear" || m_config.resize_mode == "nearest",
+                          "unsupported resize mode: ",
+                          m_config.resize_mode);
+    NODE_VALIDATION_CHECK(this, m_config.height > 0 && m_config.width > 0, "output image size must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.scale.size() == 3 && m_config.shift.size() == 3,
+                          "scale and shift must be defined per channel");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.output_type == ov::element::f32 || m_config.output_type == ov::element::bf16 ||
+                              m_config.output_type == ov::element::u8,
+                          "unsupported output type: ",
+                          m_config.output_type);
+
+    const auto& y_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, y_shape.rank().compatible(4), "image planes must be 4D");
+
+    const auto batch = y_shape.rank().is_static() ? y_shape[0] : Dimension::dynamic();
+    const Dimension height(m_config.height);
+    const Dimension width(m_config.width);
+    set_output_type(0,
+                    m_config.output_type,
+                    m_config.planar ? PartialShape{batch, 3, height, width} : PartialShape{batch, height, width, 3});
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * The operation decodes NV12/I420 image, resizes it, applies per-channel scale and shift and optionally makes the
+ * result planar in a single pass. It replaces the ConvertColor -> Interpolate -> eltwise -> Transpose chain produced
+ * by PrePostProcessor. Inputs:
+ *     1..3. Image planes of type T in NHWC layout: Y/UV for NV12, Y/U/V for I420 or a single plane of [N, H * 3 / 2,
+ * W, 1] shape. Required
+ * Outputs:
+ *     1. Image of type `output_type` and of shape [N, height, width, 3] or [N, 3, height, width] if `planar` is set.
+ * Types:
+ *     T - U8 and F32 are supported
+ *     output_type - F32, BF16 and U8 (saturated and truncated as Convert does) are supported
+ */
+class YuvPreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("YuvPreprocess", "cpu_plugin_opset");
+
+    YuvPreprocessNode() = default;
+
+    struct Config {
+        bool i420 = false;         // I420 source, NV12 otherwise
+        bool bgr = false;          // BGR channel order, RGB otherwise
+        bool round_color = false;  // colors are rounded to u8 before the resize
+        std::string resize_mode;   // "linear" or "nearest", half_pixel coordinates
+        int64_t height = 0;
+        int64_t width = 0;
+        std::vector<float> scale;  // per-channel x * scale + shift, applied after the resize
+        std::vector<float> shift;
+        bool planar = false;
+        ov::element::Type output_type = ov::element::f32;
+    };
+
+    YuvPreprocessNode(const OutputVector& args, Config cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,227 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "move_eltwise_up_through_shape_ops.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/broadcast_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+namespace {
+
+bool is_shape_op(const std::shared_ptr<Node>& node) {
+    if (ov::is_type_any_of<op::v1::Reshape, op::v0::Squeeze, op::v0::Unsqueeze, op::v1::Transpose>(node)) {
+        return true;
+    }
+    if (const auto broadcast = ov::as_type_ptr<op::util::BroadcastBase>(node)) {
+        const auto mode = broadcast->get_broadcast_spec().m_type;
+        return any_of(mode, op::BroadcastType::NUMPY, op::BroadcastType::BIDIRECTIONAL);
+    }
+    return false;
+}
+
+bool is_fusable_eltwise(const std::shared_ptr<Node>& node) {
+    return ov::is_type_any_of<op::util::UnaryElementwiseArithmetic,
+                              op::util::BinaryElementwiseArithmetic,
+                              op::v4::Swish>(node);
+}
+
+// the shape ops above the eltwise are skipped only when they end at an eltwise the moved one is fused with
+bool follows_eltwise(std::shared_ptr<Node> node) {
+    while (is_shape_op(node)) {
+        if (node->get_output_target_inputs(0).size() != 1 || node->get_output_partial_shape(0).is_dynamic()) {
+            return false;
+        }
+        node = node->get_input_node_shared_ptr(0);
+    }
+    return is_fusable_eltwise(node) && node->get_output_size() == 1;
+}
+
+Shape align_rank(const Shape& shape, size_t rank) {
+    Shape aligned(rank - shape.size(), 1);
+    aligned.insert(aligned.end(), shape.begin(), shape.end());
+    return aligned;
+}
+
+std::shared_ptr<op::v0::Constant> through_transpose(const std::shared_ptr<Node>& transpose,
+                                                    const std::shared_ptr<op::v0::Constant>& constant,
+                                                    const Shape& aligned) {
+    const auto order_const = ov::as_type_ptr<op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!order_const) {
+        return nullptr;
+    }
+    auto order = order_const->cast_vector<int64_t>();
+    if (order.empty()) {
+        // the default order reverses the dimensions
+        for (size_t i = aligned.size(); i > 0; i--) {
+            order.push_back(static_cast<int64_t>(i - 1));
+        }
+    }
+    if (order.size() != aligned.size()) {
+        return nullptr;
+    }
+    // the constant dimension i is the input dimension order[i]
+    std::vector<int64_t> inverse(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        inverse[order[i]] = static_cast<int64_t>(i);
+    }
+    const auto reshaped = std::make_shared<op::v0::Constant>(*constant, aligned);
+    const auto inverse_const = op::v0::Constant::create(element::i64, Shape{inverse.size()}, inverse);
+    return ov::util::get_constant_from_source(std::make_shared<op::v1::Transpose>(reshaped, inverse_const));
+}
+
+// the input and output dimensions are split into the groups of the same number of elements, the constant may
+// either broadcast or cover every group completely, so its elements keep their order
+std::optional<Shape> through_reshape(const Shape& in, const Shape& out, const Shape& aligned) {
+    if (shape_size(in) != shape_size(out) || shape_size(in) == 0) {
+        return std::nullopt;
+    }
+    Shape mapped;
+    size_t i = 0;
+    size_t o = 0;
+    while (i < in.size() || o < out.size()) {
+        const size_t i_begin = i;
+        const size_t o_begin = o;
+        size_t in_size = i < in.size() ? in[i++] : 1;
+        size_t out_size = o < out.size() ? out[o++] : 1;
+        while (in_size != out_size) {
+            if (in_size < out_size && i < in.size()) {
+                in_size *= in[i++];
+            } else if (out_size < in_size && o < out.size()) {
+                out_size *= out[o++];
+            } else {
+                return std::nullopt;
+            }
+        }
+        size_t const_size = 1;
+        for (size_t k = o_begin; k < o; k++) {
+            const_size *= aligned[k];
+        }
+        if (const_size == 1) {
+            mapped.insert(mapped.end(), i - i_begin, 1);
+        } else if (const_size == out_size) {
+            mapped.insert(mapped.end(), in.begin() + i_begin, in.begin() + i);
+        } else {
+            return std::nullopt;
+        }
+    }
+    return mapped;
+}
+
+std::optional<Shape> through_broadcast(const Shape& in, const Shape& aligned) {
+    if (in.size() > aligned.size()) {
+        return std::nullopt;
+    }
+    const size_t offset = aligned.size() - in.size();
+    for (size_t k = 0; k < offset; k++) {
+        if (aligned[k] != 1) {
+            return std::nullopt;
+        }
+    }
+    for (size_t k = 0; k < in.size(); k++) {
+        if (aligned[offset + k] != 1 && aligned[offset + k] != in[k]) {
+            return std::nullopt;
+        }
+    }
+    return Shape(aligned.begin() + offset, aligned.end());
+}
+
+}  // namespace
+
+MoveEltwiseUpThroughShapeOps::MoveEltwiseUpThroughShapeOps() {
+    MATCHER_SCOPE(MoveEltwiseUpThroughShapeOps);
+    auto eltwise_m = ov::pass::pattern::wrap_type<ov::op::util::BinaryElementwiseArithmetic>(
+        ov::pass::pattern::has_static_shape());
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        const auto eltwise = m.get_match_root();
+        if (transformation_callback(eltwise)) {
+            return false;
+        }
+        const size_t const_idx = ov::is_type<ov::op::v0::Constant>(eltwise->get_input_node_ptr(0)) ? 0 : 1;
+        const size_t data_idx = 1 - const_idx;
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(eltwise->get_input_node_shared_ptr(const_idx));
+        const auto shape_op = eltwise->get_input_node_shared_ptr(data_idx);
+        if (!constant || !is_shape_op(shape_op) || !follows_eltwise(shape_op)) {
+            return false;
+        }
+        // the scalar case is covered by the common transformation, the integer constants are kept for LPT
+        const auto& const_shape = constant->get_shape();
+        const auto& out_shape = eltwise->get_output_shape(0);
+        if (eltwise->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY || ov::shape_size(const_shape) == 1 ||
+            const_shape.size() > out_shape.size() ||
+            out_shape != shape_op->get_output_shape(0) || !constant->get_element_type().is_real() ||
+            constant->get_element_type() != eltwise->get_input_element_type(data_idx)) {
+            return false;
+        }
+
+        const auto& in_shape = shape_op->get_input_shape(0);
+        const auto aligned = align_rank(const_shape, out_shape.size());
+        std::shared_ptr<ov::op::v0::Constant> new_const;
+        if (ov::is_type<ov::op::v1::Transpose>(shape_op)) {
+            new_const = through_transpose(shape_op, constant, aligned);
+        } else {
+            const auto new_shape = ov::is_type<ov::op::util::BroadcastBase>(shape_op)
+                                       ? through_broadcast(in_shape, aligned)
+                                       : through_reshape(in_shape, out_shape, aligned);
+            if (new_shape) {
+                new_const = std::make_shared<ov::op::v0::Constant>(*constant, *new_shape);
+            }
+        }
+        if (!new_const) {
+            return false;
+        }
+        ov::copy_runtime_info(constant, new_const);
+
+        ov::OutputVector eltwise_inputs = eltwise->input_values();
+        eltwise_inputs[data_idx] = shape_op->input_value(0);
+        eltwise_inputs[const_idx] = new_const;
+        auto new_eltwise = eltwise->clone_with_new_inputs(eltwise_inputs);
+        new_eltwise->set_friendly_name(eltwise->get_friendly_name());
+
+        ov::OutputVector shape_op_inputs = shape_op->input_values();
+        shape_op_inputs[0] = new_eltwise;
+        auto new_shape_op = shape_op->clone_with_new_inputs(shape_op_inputs);
+        new_shape_op->set_friendly_name(shape_op->get_friendly_name());
+
+        ov::copy_runtime_info({eltwise, shape_op}, {new_eltwise, new_shape_op});
+        ov::replace_node(eltwise, new_shape_op);
+        // the eltwise may be moved through the next shape op as well
+        register_new_node(new_eltwise);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(eltwise_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}  // namespace ov::intel_cpu
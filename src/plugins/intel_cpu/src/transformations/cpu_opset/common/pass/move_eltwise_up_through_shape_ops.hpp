@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+// eltwise -> Reshape/Squeeze/Unsqueeze/Transpose/Broadcast... -> Binary eltwise with a non scalar constant
+// The binary eltwise is moved before the shape ops, its constant is mapped to the layout of their input:
+//  - Transpose: the constant is transposed by the inverse order
+//  - Reshape, Squeeze, Unsqueeze: every group of the merged or split dimensions of the constant must be either
+//    broadcasted or full
+//  - Broadcast (numpy, bidirectional): the constant must be broadcasted along the broadcasted dimensions
+// so the eltwise chain is executed by one fused node without the intermediate tensors.
+// Scalar constants are handled by MoveEltwiseUpThroughDataMovScalar.
+
+namespace ov::intel_cpu {
+
+class MoveEltwiseUpThroughShapeOps : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("MoveEltwiseUpThroughShapeOps");
+    MoveEltwiseUpThroughShapeOps();
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,226 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "yuv_preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/interpolate_base.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/yuv_preprocess.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+namespace {
+
+constexpr size_t channels = 3;
+
+std::shared_ptr<Node> single_consumer(const Output<Node>& output) {
+    const auto targets = output.get_target_inputs();
+    if (targets.size() != 1) {
+        return nullptr;
+    }
+    return targets.begin()->get_node()->shared_from_this();
+}
+
+// Folds `data op constant` into per-channel x * scale + shift, the constant must be a scalar or a per-channel one.
+bool fold_eltwise(const std::shared_ptr<Node>& node,
+                  const Output<Node>& data,
+                  size_t channel_axis,
+                  std::vector<float>& scale,
+                  std::vector<float>& shift) {
+    if (!ov::is_type_any_of<op::v1::Add, op::v1::Subtract, op::v1::Multiply, op::v1::Divide>(node) ||
+        node->input_value(0) != data || node->get_output_partial_shape(0) != data.get_partial_shape()) {
+        return false;
+    }
+    const auto constant = ov::as_type_ptr<op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    if (!constant) {
+        return false;
+    }
+    const auto& shape = constant->get_shape();
+    const auto rank = data.get_partial_shape().size();
+    if (shape_size(shape) != 1) {
+        if (shape.size() > rank) {
+            return false;
+        }
+        for (size_t i = 0; i < shape.size(); i++) {
+            if (shape[i] != 1 && rank - shape.size() + i != channel_axis) {
+                return false;
+            }
+        }
+    }
+
+    const auto values = constant->cast_vector<float>();
+    for (size_t c = 0; c < channels; c++) {
+        const float value = values.size() == 1 ? values[0] : values[c];
+        if (ov::is_type<op::v1::Add>(node)) {
+            shift[c] += value;
+        } else if (ov::is_type<op::v1::Subtract>(node)) {
+            shift[c] -= value;
+        } else if (ov::is_type<op::v1::Multiply>(node)) {
+            scale[c] *= value;
+            shift[c] *= value;
+        } else {
+            scale[c] /= value;
+            shift[c] /= value;
+        }
+    }
+    return true;
+}
+
+bool fill_resize_config(const op::util::InterpolateBase& interpolate, YuvPreprocessNode::Config& config) {
+    using Base = op::util::InterpolateBase;
+    const auto& attrs = interpolate.get_attrs();
+    const auto is_zero = [](size_t pad) {
+        return pad == 0;
+    };
+    if (attrs.shape_calculation_mode != Base::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != Base::CoordinateTransformMode::HALF_PIXEL ||
+        !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero)) {
+        return false;
+    }
+    if (any_of(attrs.mode, Base::InterpolateMode::LINEAR, Base::InterpolateMode::LINEAR_ONNX) && !attrs.antialias) {
+        config.resize_mode = "linear";
+    } else if (attrs.mode == Base::InterpolateMode::NEAREST &&
+               attrs.nearest_mode == Base::NearestMode::ROUND_PREFER_FLOOR) {
+        config.resize_mode = "nearest";
+    } else {
+        return false;
+    }
+
+    // Only H and W of the NHWC image may be resized.
+    const auto& in_shape = interpolate.get_input_partial_shape(0);
+    const auto& out_shape = interpolate.get_output_partial_shape(0);
+    if (in_shape.is_dynamic() || out_shape.is_dynamic() || in_shape.size() != 4 || out_shape.size() != 4 ||
+        in_shape[0] != out_shape[0] || in_shape[3] != out_shape[3]) {
+        return false;
+    }
+    config.height = out_shape[1].get_length();
+    config.width = out_shape[2].get_length();
+    return true;
+}
+
+}  // namespace
+
+YuvPreprocessFusion::YuvPreprocessFusion() {
+    MATCHER_SCOPE(YuvPreprocessFusion);
+
+    auto color_m = pass::pattern::wrap_type<op::v8::NV12toRGB, op::v8::NV12toBGR, op::v8::I420toRGB, op::v8::I420toBGR>(
+        pass::pattern::consumers_count(1));
+
+    matcher_pass_callback callback = [=](pass::pattern::Matcher& m) {
+        const auto color = m.get_match_root();
+        const auto color_type = color->get_output_element_type(0);
+        if (color->is_dynamic() || none_of(color_type, element::u8, element::f32)) {
+            return false;
+        }
+
+        YuvPreprocessNode::Config config;
+        config.i420 = ov::is_type_any_of<op::v8::I420toRGB, op::v8::I420toBGR>(color);
+        config.bgr = ov::is_type_any_of<op::v8::NV12toBGR, op::v8::I420toBGR>(color);
+        config.round_color = color_type == element::u8;
+        NodeVector fused{color};
+
+        Output<Node> data = color->output(0);
+        auto next = single_consumer(data);
+        if (next && ov::is_type<op::v0::Convert>(next) && next->get_output_element_type(0) == element::f32) {
+            fused.push_back(next);
+            data = next->output(0);
+            next = single_consumer(data);
+        }
+        // The resize is the reason of the fusion, and it is computed in f32 only.
+        const auto interpolate = ov::as_type_ptr<op::util::InterpolateBase>(next);
+        if (data.get_element_type() != element::f32 || !interpolate || interpolate->input_value(0) != data ||
+            !fill_resize_config(*interpolate, config)) {
+            return false;
+        }
+        fused.push_back(interpolate);
+        data = interpolate->output(0);
+
+        std::vector<float> scale(channels, 1.F);
+        std::vector<float> shift(channels, 0.F);
+        size_t channel_axis = 3;
+        for (next = single_consumer(data); next; next = single_consumer(data)) {
+            if (ov::is_type<op::v1::Transpose>(next) && !config.planar) {
+                const auto order = ov::as_type_ptr<op::v0::Constant>(next->get_input_node_shared_ptr(1));
+                if (!order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2}) {
+                    break;
+                }
+                config.planar = true;
+                channel_axis = 1;
+            } else if (!fold_eltwise(next, data, channel_axis, scale, shift)) {
+                break;
+            }
+            fused.push_back(next);
+            data = next->output(0);
+        }
+        config.scale = std::move(scale);
+        config.shift = std::move(shift);
+        // the kernel stores the low precision result directly
+        if (next && ov::is_type<op::v0::Convert>(next) &&
+            any_of(next->get_output_element_type(0), element::u8, element::bf16)) {
+            config.output_type = next->get_output_element_type(0);
+            fused.push_back(next);
+            data = next->output(0);
+        }
+
+        // u8 planes converted to f32 right before the decoding are read as is.
+        OutputVector planes = color->input_values();
+        const bool converted_u8 = std::all_of(planes.begin(), planes.end(), [](const Output<Node>& plane) {
+            return ov::is_type<op::v0::Convert>(plane.get_node()) && plane.get_target_inputs().size() == 1 &&
+                   plane.get_node()->get_input_element_type(0) == element::u8;
+        });
+        if (converted_u8) {
+            for (auto& plane : planes) {
+                fused.push_back(plane.get_node_shared_ptr());
+                plane = plane.get_node()->input_value(0);
+            }
+        }
+        if (!std::all_of(planes.begin(), planes.end(), [](const Output<Node>& plane) {
+                return any_of(plane.get_element_type(), element::u8, element::f32);
+            })) {
+            return false;
+        }
+
+        const auto last = data.get_node_shared_ptr();
+        const auto preprocess = std::make_shared<YuvPreprocessNode>(planes, config);
+        preprocess->set_friendly_name(last->get_friendly_name());
+        copy_runtime_info(fused, preprocess);
+        ov::replace_node(last, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<pass::pattern::Matcher>(color_m, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::intel_cpu
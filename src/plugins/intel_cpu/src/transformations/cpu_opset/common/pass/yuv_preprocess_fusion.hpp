@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+// NV12/I420 -> [Convert] -> Interpolate -> [Add/Subtract/Multiply/Divide by const]... -> [Transpose] -> [eltwise]...
+// -> [Convert to u8/bf16] is replaced with YuvPreprocess, so the image is decoded, resized and normalized in one pass.
+// Registered only with ENABLE_YUV_PREPROCESS_FUSION until the YuvPreprocessFusionBenchmark test shows the gain
+
+namespace ov::intel_cpu {
+
+class YuvPreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("YuvPreprocessFusion");
+    YuvPreprocessFusion();
+};
+
+}  // namespace ov::intel_cpu
@@ -28,6 +28,7 @@
 #include "snippets/utils/utils.hpp"
 #include "transformations/snippets/x64/op/brgemm_cpu.hpp"
 #include "transformations/snippets/x64/op/brgemm_utils.hpp"
+#include "utils/brgemm_blocking_database.hpp"
 
 namespace ov::intel_cpu::pass {
 using LinearIR = snippets::lowered::LinearIR;
@@ -115,9 +116,14 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
 
     const auto [m, n, k] = get_brgemm_dimensions(brgemm_expr);
 
-    const auto default_m_blk = 32;
-    const auto default_n_blk = 64;
-    const auto default_k_blk = !ov::snippets::utils::is_dynamic_value(k) && k > 1024 ? 1024 : 512;
+    size_t default_m_blk = 32;
+    size_t default_n_blk = 64;
+    size_t default_k_blk = !ov::snippets::utils::is_dynamic_value(k) && k > 1024 ? 1024 : 512;
+    if (m_blocks) {
+        default_m_blk = m_blocks->m_blk != 0 ? m_blocks->m_blk : default_m_blk;
+        default_n_blk = m_blocks->n_blk != 0 ? m_blocks->n_blk : default_n_blk;
+        default_k_blk = m_blocks->k_blk != 0 ? m_blocks->k_blk : default_k_blk;
+    }
 
     size_t m_blk = get_corrected_blk_size_by_dim(m, default_m_blk);
     size_t n_blk =
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <tuple>
 
 #include "openvino/core/rtti.hpp"
@@ -15,6 +16,7 @@
 #include "snippets/lowered/pass/pass.hpp"
 #include "snippets/lowered/specific_loop_iter_handlers.hpp"
 #include "transformations/snippets/x64/op/brgemm_cpu.hpp"
+#include "utils/brgemm_blocking_database.hpp"
 
 namespace ov::intel_cpu::pass {
 
@@ -27,6 +29,11 @@ class BrgemmCPUBlocking : public ov::snippets::lowered::pass::BrgemmBlocking<Brg
 public:
     OPENVINO_RTTI("BrgemmCPUBlocking", "", BrgemmBlocking)
 
+    /**
+     * @param blocks block sizes chosen by the blocking tuner, the non-zero ones replace the heuristic defaults
+     */
+    explicit BrgemmCPUBlocking(std::optional<BrgemmBlockSizes> blocks = std::nullopt) : m_blocks(blocks) {}
+
     /**
      * @interface DummyPass
      * @brief The empty pass which is used to force insertion of first specific iteration of loop by K dimension
@@ -85,6 +92,8 @@ private:
                              size_t m_block,
                              size_t n_block,
                              size_t k_block) override;
+
+    std::optional<BrgemmBlockSizes> m_blocks;
 };
 
 }  // namespace ov::intel_cpu::pass
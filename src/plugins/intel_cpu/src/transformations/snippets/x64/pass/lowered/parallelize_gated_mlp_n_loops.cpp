@@ -35,7 +35,10 @@ bool ParallelizeGatedMlpNLoops::run(LinearIR& linear_ir, LinearIR::constExprIt b
     // Gated MLP pattern contains 3 brgemms, 2 first brgemms have the same A input
     const bool is_gated_mlp = brgemm_expressions.size() == 3 && brgemm_expressions[0]->get_input_expr_ptr(0) ==
                                                                     brgemm_expressions[1]->get_input_expr_ptr(0);
-    if (!is_gated_mlp) {
+    // Normalization + FC subgraph contains 1 brgemm, which A input is computed in the kernel (see
+    // TokenizeNormFCSnippets): the normalization is done once per M block, and the N blocks are shared by the threads
+    const bool is_norm_fc = m_is_norm_fc && brgemm_expressions.size() == 1;
+    if (!is_gated_mlp && !is_norm_fc) {
         return false;
     }
 
@@ -16,6 +16,8 @@ namespace ov::intel_cpu::pass {
  * This pass identifies GatedMLP computational patterns characterized by:
  * - Exactly 3 BrgemmCPU operations
  * - First two Brgemm operations sharing the same A input
+ * The same is done for the normalization + FullyConnected subgraphs (see TokenizeNormFCSnippets) with the single
+ * BrgemmCPU, which A input is computed in the kernel, so the normalization isn't repeated for each N block.
  *
  * @note The blocking loop order is assumed to be: M -> N -> K.
  *
@@ -23,11 +25,17 @@ namespace ov::intel_cpu::pass {
  */
 class ParallelizeGatedMlpNLoops : public snippets::lowered::pass::RangedPass {
 public:
-    ParallelizeGatedMlpNLoops() = default;
+    /**
+     * @param is_norm_fc the Subgraph was tokenized by TokenizeNormFCSnippets
+     */
+    explicit ParallelizeGatedMlpNLoops(bool is_norm_fc = false) : m_is_norm_fc(is_norm_fc) {}
     OPENVINO_RTTI("ParallelizeGatedMlpNLoops", "", RangedPass)
     bool run(snippets::lowered::LinearIR& linear_ir,
              snippets::lowered::LinearIR::constExprIt begin,
              snippets::lowered::LinearIR::constExprIt end) override;
+
+private:
+    bool m_is_norm_fc = false;
 };
 
 }  // namespace ov::intel_cpu::pass
@@ -146,10 +146,12 @@
 
 // CPU specific transformations
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
+#include "transformations/cpu_opset/common/pass/move_eltwise_up_through_shape_ops.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/yuv_preprocess_fusion.hpp"
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
 #include "utils/precision_support.h"
 
@@ -161,6 +163,7 @@
 #include "snippets/pass/gated_mlp_tokenization.hpp"
 #include "snippets/pass/mha_tokenization.hpp"
 #include "snippets/pass/mlp_seq_tokenization.hpp"
+#include "snippets/pass/norm_fc_tokenization.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/tokenization_config.hpp"
 #include "snippets/utils/tokenization_utils.hpp"
@@ -220,6 +223,7 @@
 #    include "transformations/op_conversions/reduce_l2_decomposition.hpp"
 #    include "transformations/snippets/x64/op/brgemm_utils.hpp"
 #    include "transformations/snippets/x64/pass/fuse_brgemm_cpu_postops.hpp"
+#    include "transformations/snippets/x64/pass/lowered/brgemm_cpu_blocking.hpp"
 #    include "transformations/snippets/x64/pass/snippets_mark_skipped.hpp"
 #    include "transformations/utils/utils.hpp"
 #endif
@@ -641,8 +645,12 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EliminateConvert);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EliminateIdentityConvert);
     ov::pass::ConvertPagedAttnInputs::KVCacheConfig cacheConfig;
-    cacheConfig.keyCachePrecision = config.keyCachePrecision;
-    cacheConfig.valueCachePrecision = config.valueCachePrecision;
+    // PagedAttention has no f8 cache kernels, an f8 hint keeps its cache in the inference precision
+    auto pagedCachePrecision = [&config](const ov::element::Type& precision) {
+        return any_of(precision, ov::element::f8e4m3, ov::element::f8e5m2) ? config.inferencePrecision : precision;
+    };
+    cacheConfig.keyCachePrecision = pagedCachePrecision(config.keyCachePrecision);
+    cacheConfig.valueCachePrecision = pagedCachePrecision(config.valueCachePrecision);
     cacheConfig.inferencePrecision = config.inferencePrecision;
     cacheConfig.keyCacheGroupSize = config.keyCacheGroupSize;
     cacheConfig.valueCacheGroupSize = config.valueCacheGroupSize;
@@ -1128,8 +1136,14 @@ void Transformations::PostLpt() {
             return false;
         },
         ov::pass::MoveEltwiseUpThroughDataMovScalar);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, MoveEltwiseUpThroughShapeOps);
 
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ConstantFolding);
+    // Executed after ConstantFolding, so mean and scale of the image preprocessing are plain constants.
+    // The fused kernel is scalar and f32 only, so the fusion is applied only when requested explicitly
+    if (config.enableYuvPreprocessFusion) {
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, YuvPreprocessFusion);
+    }
 
     CPU_REGISTER_PASS_X64(postLPTPassManager, FuseFQtoInteraction);
 
@@ -1382,6 +1396,16 @@ void Transformations::MainSnippets() {
         CPU_DISABLE_PASS_COMMON(snippetsManager, TokenizeMLPSeqSnippets);
     }
 
+#if defined(OPENVINO_ARCH_X86_64)
+    const bool isNormFCSupported = is_infer_prc_supported_by_brgemm;
+#else
+    const bool isNormFCSupported = false;
+#endif
+
+    if (!isNormFCSupported) {
+        CPU_DISABLE_PASS_COMMON(snippetsManager, TokenizeNormFCSnippets);
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
     auto is_supported_matmul = [this](const std::shared_ptr<const ov::Node>& n) {
         const auto matmul = ov::as_type_ptr<const ov::op::v0::MatMul>(n);
@@ -1560,6 +1584,21 @@ void Transformations::MainSnippets() {
                 return output_shape[1].is_dynamic() || output_shape[1].get_length() > 256;
             },
             TokenizeMLPSeqSnippets);
+        CPU_SET_CALLBACK_X64(
+            snippetsManager,
+            [&](const std::shared_ptr<const ov::Node>& n) -> bool {
+                if (!is_supported_matmul(n))
+                    return true;
+                // Small M (e.g. LLM decoding) is parallelized over the N blocks of Brgemm (see
+                // ParallelizeGatedMlpNLoops), which are formed only if the weights are blocked by N
+                const auto brgemm_precision = config.inferencePrecision == ov::element::dynamic
+                                                  ? n->get_input_element_type(0)
+                                                  : config.inferencePrecision;
+                if (pass::BrgemmCPUBlocking::is_kn_blocking_supported(brgemm_precision))
+                    return false;
+                return is_unsupported_parallel_work_amount(n, n->get_output_partial_shape(0));
+            },
+            TokenizeNormFCSnippets);
         CPU_SET_CALLBACK_X64(
             snippetsManager,
             [&](const std::shared_ptr<const ov::Node>& n) -> bool {
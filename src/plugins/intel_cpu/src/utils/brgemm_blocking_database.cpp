@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_blocking_database.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+namespace {
+
+constexpr const char* database_file = "cpu_brgemm_blocking.db";
+// The first line of the database file, the entries of the other versions are ignored
+constexpr const char* database_header = "# CPU brgemm blocking v1";
+
+}  // namespace
+
+BrgemmBlockingDatabase& BrgemmBlockingDatabase::get(const std::string& cache_dir) {
+    static std::mutex mutex;
+    static std::map<std::string, std::unique_ptr<BrgemmBlockingDatabase>> databases;
+
+    const auto path = cache_dir.empty() ? std::string{} : (std::filesystem::path(cache_dir) / database_file).string();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& database = databases[path];
+    if (!database) {
+        database.reset(new BrgemmBlockingDatabase(path));
+    }
+    return *database;
+}
+
+BrgemmBlockingDatabase::BrgemmBlockingDatabase(std::string path) : m_path(std::move(path)) {
+    load();
+}
+
+void BrgemmBlockingDatabase::load() {
+    if (m_path.empty()) {
+        return;
+    }
+    std::ifstream file(m_path);
+    if (!file.is_open()) {
+        return;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != database_header) {
+        // written by another version, replaced on the first store
+        m_rewrite = true;
+        return;
+    }
+    while (std::getline(file, line)) {
+        std::istringstream entry(line);
+        std::string key;
+        BrgemmBlockSizes blocks;
+        if (entry >> key >> blocks.m_blk >> blocks.n_blk >> blocks.k_blk) {
+            m_entries[key] = blocks;
+        } else {
+            DEBUG_LOG("Skipping malformed brgemm blocking database entry: ", line);
+        }
+    }
+}
+
+std::optional<BrgemmBlockSizes> BrgemmBlockingDatabase::find(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void BrgemmBlockingDatabase::store(const std::string& key, const BrgemmBlockSizes& blocks) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_entries.emplace(key, blocks).second || m_path.empty()) {
+        return;
+    }
+    // the entries are only appended, so the entries stored by other processes in the meantime are kept
+    const bool write_header = m_rewrite || !std::filesystem::exists(m_path);
+    std::ofstream file(m_path, m_rewrite ? std::ios::trunc : std::ios::app);
+    if (!file.is_open()) {
+        DEBUG_LOG("Failed to open the brgemm blocking database ", m_path);
+        return;
+    }
+    m_rewrite = false;
+    if (write_header) {
+        file << database_header << '\n';
+    }
+    file << key << ' ' << blocks.m_blk << ' ' << blocks.n_blk << ' ' << blocks.k_blk << '\n';
+}
+
+}  // namespace ov::intel_cpu
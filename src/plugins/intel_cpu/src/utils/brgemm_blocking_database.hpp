@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Block sizes of the Brgemm blocking loops. Zero block size means that the blocking heuristic is used for the
+ * dimension
+ */
+struct BrgemmBlockSizes {
+    size_t m_blk = 0;
+    size_t n_blk = 0;
+    size_t k_blk = 0;
+
+    bool operator==(const BrgemmBlockSizes& rhs) const {
+        return m_blk == rhs.m_blk && n_blk == rhs.n_blk && k_blk == rhs.k_blk;
+    }
+};
+
+/**
+ * @brief The Brgemm block sizes chosen by the blocking tuner for the subgraphs seen so far. The database is shared by
+ * all the compiled models using the same cache directory and is persisted in it, so the tuning is done once per
+ * subgraph and shape class. Without the cache directory the results are kept for the process lifetime only.
+ */
+class BrgemmBlockingDatabase {
+public:
+    static BrgemmBlockingDatabase& get(const std::string& cache_dir);
+
+    BrgemmBlockingDatabase(const BrgemmBlockingDatabase&) = delete;
+    BrgemmBlockingDatabase& operator=(const BrgemmBlockingDatabase&) = delete;
+
+    [[nodiscard]] std::optional<BrgemmBlockSizes> find(const std::string& key) const;
+
+    void store(const std::string& key, const BrgemmBlockSizes& blocks);
+
+private:
+    explicit BrgemmBlockingDatabase(std::string path);
+
+    void load();
+
+    const std::string m_path;
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, BrgemmBlockSizes> m_entries;
+    bool m_rewrite = false;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_prefetcher.h"
+
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+#    include <xmmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "nodes/executors/executor.hpp"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+namespace {
+
+constexpr size_t cache_line_size = 64;
+// Bytes prefetched between the checks for a newer request
+constexpr size_t chunk_size = 64 * 1024;
+
+inline void prefetch_line(const char* ptr) {
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
+    // the helper thread runs on another core, so the lines are brought to the outer cache levels only
+    _mm_prefetch(ptr, _MM_HINT_T2);
+#elif defined(__GNUC__)
+    __builtin_prefetch(ptr, 0, 1);
+#else
+    (void)ptr;
+#endif
+}
+
+}  // namespace
+
+WeightsPrefetcher::WeightsPrefetcher(size_t budget) : m_budget(budget) {
+    OPENVINO_ASSERT(m_budget > 0, "Weights prefetch budget must be positive");
+    m_thread = std::thread([this] {
+        run();
+    });
+}
+
+WeightsPrefetcher::~WeightsPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_cv.notify_all();
+    m_thread.join();
+}
+
+void WeightsPrefetcher::submit(const MemoryRegions& regions) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+#if defined(__linux__)
+        if (!m_affinityCaptured) {
+            m_affinityCaptured = true;
+            // the helper thread stays where the OS puts it if the mask cannot be read
+            m_pinned = sched_getaffinity(0, sizeof(m_affinity), &m_affinity) != 0;
+        }
+#endif
+        m_pending.clear();
+        size_t left = m_budget;
+        for (const auto& [data, size] : regions) {
+            if (left == 0) {
+                break;
+            }
+            if (data == nullptr || size == 0) {
+                continue;
+            }
+            const auto bytes = std::min(size, left);
+            m_pending.emplace_back(data, bytes);
+            left -= bytes;
+        }
+        m_requestedBytes.fetch_add(m_budget - left, std::memory_order_relaxed);
+        m_epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_cv.notify_one();
+}
+
+void WeightsPrefetcher::cancel() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.clear();
+    m_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void WeightsPrefetcher::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] {
+            return m_stop || !m_pending.empty();
+        });
+        if (m_stop) {
+            return;
+        }
+        pinToConsumer();
+        const auto regions = std::exchange(m_pending, {});
+        const auto epoch = m_epoch.load(std::memory_order_relaxed);
+        lock.unlock();
+        stream(regions, epoch);
+        lock.lock();
+    }
+}
+
+// called by the helper thread under m_mutex
+void WeightsPrefetcher::pinToConsumer() {
+#if defined(__linux__)
+    if (m_affinityCaptured && !m_pinned) {
+        m_pinned = true;
+        // a failure leaves the prefetch working, only farther from the consumer
+        sched_setaffinity(0, sizeof(m_affinity), &m_affinity);
+    }
+#endif
+}
+
+void WeightsPrefetcher::stream(const MemoryRegions& regions, uint64_t epoch) const {
+    for (const auto& [data, size] : regions) {
+        const auto* begin = static_cast<const char*>(data);
+        for (size_t offset = 0; offset < size; offset += chunk_size) {
+            if (m_epoch.load(std::memory_order_relaxed) != epoch) {
+                return;
+            }
+            const auto end = std::min(size, offset + chunk_size);
+            for (size_t line = offset; line < end; line += cache_line_size) {
+                prefetch_line(begin + line);
+            }
+        }
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+
+#include "nodes/executors/executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Helper thread streaming the weights of the upcoming nodes into the cache hierarchy while the memory light nodes
+ * of the graph (attention, normalizations, eltwise) run, so the following memory bound GEMMs of a single batch
+ * decode find at least a part of their weights cached.
+ * Only prefetch instructions are issued, so the regions of the executors replaced meanwhile are harmless. The
+ * prefetched volume is capped by the budget, so the streamed weights do not evict the live activations.
+ * On Linux the helper thread takes the CPU affinity of the thread submitting the first request, i.e. of the stream
+ * executing the graph, so the weights land in the cache domain of their consumer and not of an arbitrary core.
+ */
+class WeightsPrefetcher {
+public:
+    explicit WeightsPrefetcher(size_t budget);
+    ~WeightsPrefetcher();
+
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+
+    // Replaces the pending regions with the given ones, trimmed to the budget
+    void submit(const MemoryRegions& regions);
+    // Stops streaming, the node consuming the weights is about to run
+    void cancel();
+
+    size_t budget() const {
+        return m_budget;
+    }
+
+    // Bytes of weights accepted for prefetch since the creation
+    uint64_t requestedBytes() const {
+        return m_requestedBytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run();
+    void stream(const MemoryRegions& regions, uint64_t epoch) const;
+    void pinToConsumer();
+
+    const size_t m_budget;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    MemoryRegions m_pending;
+    // incremented on every submit / cancel, the streaming of an outdated request stops at the next chunk
+    std::atomic<uint64_t> m_epoch{0};
+    bool m_stop = false;
+    std::atomic<uint64_t> m_requestedBytes{0};
+#if defined(__linux__)
+    // affinity of the consumer, captured by the first submit and applied by the helper thread once
+    cpu_set_t m_affinity{};
+    bool m_affinityCaptured = false;
+    bool m_pinned = false;
+#endif
+    std::thread m_thread;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/multi_single_conv.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+// The second model of the group needs a larger arena than the first one, which is already allocated, so the arena is
+// reallocated under the first model. Both models must report the shared arena and their interleaved inferences must
+// match the models compiled separately.
+TEST(ActivationArena, smoke_GroupedModelsMatchSeparateCompilation) {
+    ov::Core core;
+    const std::vector<ov::Shape> shapes{{1, 3, 24, 24}, {1, 3, 64, 64}};
+
+    std::vector<ov::InferRequest> references;
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::CompiledModel> grouped;
+    for (const auto& shape : shapes) {
+        auto model = ov::test::utils::make_multi_single_conv(shape);
+        auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape);
+
+        references.push_back(core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request());
+        references.back().set_input_tensor(input);
+        references.back().infer();
+
+        grouped.push_back(
+            core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::intel_cpu::activation_arena_group("pipeline")));
+        requests.push_back(grouped.back().create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].infer();
+            ov::test::utils::compare(references[i].get_output_tensor(), requests[i].get_output_tensor(), 1e-4);
+        }
+    }
+
+    // both models use the arena sized to the larger one, which the smaller model alone would not need
+    const auto arena_size = grouped.front().get_property(ov::intel_cpu::activation_arena_size);
+    EXPECT_GT(arena_size, 0U);
+    EXPECT_EQ(grouped.back().get_property(ov::intel_cpu::activation_arena_size), arena_size);
+    auto alone = core.compile_model(ov::test::utils::make_multi_single_conv(shapes.front()),
+                                    ov::test::utils::DEVICE_CPU,
+                                    ov::intel_cpu::activation_arena_group("alone"));
+    EXPECT_GT(alone.get_property(ov::intel_cpu::activation_arena_size), 0U);
+    EXPECT_LT(alone.get_property(ov::intel_cpu::activation_arena_size), arena_size);
+
+    // the asynchronous requests of the group are serialized per stream
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i].wait();
+        ov::test::utils::compare(references[i].get_output_tensor(), requests[i].get_output_tensor(), 1e-4);
+    }
+
+    // releasing the memory of one model must keep the arena of the other one alive
+    grouped.front().release_memory();
+    requests.back().infer();
+    ov::test::utils::compare(references.back().get_output_tensor(), requests.back().get_output_tensor(), 1e-4);
+    requests.front().infer();
+    ov::test::utils::compare(references.front().get_output_tensor(), requests.front().get_output_tensor(), 1e-4);
+}
+
+}  // namespace
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/matmul_bias.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+// Reports when the memory of the tensor is released
+struct TrackingAllocator {
+    std::shared_ptr<bool> released = std::make_shared<bool>(false);
+
+    void* allocate(size_t bytes, size_t alignment) {
+        return ov::Allocator{}.allocate(bytes, alignment);
+    }
+    void deallocate(void* ptr, size_t bytes, size_t alignment) noexcept {
+        ov::Allocator{}.deallocate(ptr, bytes, alignment);
+        *released = true;
+    }
+    bool is_equal(const TrackingAllocator& other) const {
+        return released == other.released;
+    }
+};
+
+// A single client issuing one request at a time makes the adaptive streams compiled model switch to the wide
+// partition, the results must not depend on the partition the requests are served by.
+TEST(AdaptiveStreams, smoke_SequentialRequestsSwitchToWideStreams) {
+    ov::Core core;
+    auto model = ov::test::utils::make_matmul_bias({1, 3, 24, 24});
+
+    auto reference = core.compile_model(model,
+                                        ov::test::utils::DEVICE_CPU,
+                                        ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+    auto adaptive = core.compile_model(model,
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                       ov::intel_cpu::enable_adaptive_streams(true));
+    const auto streams = adaptive.get_property(ov::num_streams);
+    if (streams.num <= 1) {
+        GTEST_SKIP() << "The wide partition is only created for multiple streams";
+    }
+    EXPECT_EQ(adaptive.get_property(ov::intel_cpu::adaptive_streams_active), streams.num);
+    const auto supported = adaptive.get_property(ov::supported_properties);
+    for (const auto& name : {ov::intel_cpu::adaptive_streams_active.name(),
+                             ov::intel_cpu::adaptive_streams_switches.name()}) {
+        EXPECT_NE(std::find(supported.begin(), supported.end(), name), supported.end()) << name;
+    }
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 3, 24, 24});
+    auto reference_request = reference.create_infer_request();
+    reference_request.set_input_tensor(input);
+    reference_request.infer();
+
+    auto request = adaptive.create_infer_request();
+    request.set_input_tensor(input);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (adaptive.get_property(ov::intel_cpu::adaptive_streams_switches) == 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+        request.start_async();
+        request.wait();
+        ov::test::utils::compare(reference_request.get_output_tensor(), request.get_output_tensor(), 1e-4);
+    }
+    EXPECT_EQ(adaptive.get_property(ov::intel_cpu::adaptive_streams_switches), uint64_t{1});
+    EXPECT_EQ(adaptive.get_property(ov::intel_cpu::adaptive_streams_active), 1);
+
+    for (size_t i = 0; i < 8; i++) {
+        request.start_async();
+        request.wait();
+        ov::test::utils::compare(reference_request.get_output_tensor(), request.get_output_tensor(), 1e-4);
+    }
+
+    // The wide request serving the inference must not keep the tensors of the user request once it's done
+    TrackingAllocator allocator;
+    {
+        ov::Tensor tracked(ov::element::f32, input.get_shape(), allocator);
+        input.copy_to(tracked);
+        request.set_input_tensor(tracked);
+        request.start_async();
+        request.wait();
+        ov::test::utils::compare(reference_request.get_output_tensor(), request.get_output_tensor(), 1e-4);
+        request.set_input_tensor(input);
+    }
+    EXPECT_TRUE(*allocator.released);
+}
+
+}  // namespace
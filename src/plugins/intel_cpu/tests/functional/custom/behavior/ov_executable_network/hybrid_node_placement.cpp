@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace {
+
+bool has_efficient_cores() {
+    const auto proc_type_table = ov::get_proc_type_table();
+    return !proc_type_table.empty() && proc_type_table[0][ov::MAIN_CORE_PROC] > 0 &&
+           proc_type_table[0][ov::EFFICIENT_CORE_PROC] > 0;
+}
+
+// A bandwidth bound Transpose + Add segment large enough to be moved to the efficient cores followed by a MatMul which
+// stays on the stream.
+std::shared_ptr<ov::Model> make_hybrid_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64, 64, 128});
+    auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 1, 3});
+    auto transpose = std::make_shared<ov::op::v1::Transpose>(param, order);
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1}, {0.5F});
+    auto add = std::make_shared<ov::op::v1::Add>(transpose, bias);
+    auto weights =
+        ov::op::v0::Constant::create(ov::element::f32, ov::Shape{128, 32}, std::vector<float>(128 * 32, 0.01F));
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(add, weights);
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{param});
+}
+
+TEST(HybridNodePlacement, smoke_BandwidthBoundSegmentMatchesReference) {
+    if (!has_efficient_cores()) {
+        GTEST_SKIP() << "The segments are only placed on the efficient cores of a hybrid CPU";
+    }
+    auto model = make_hybrid_model();
+    auto param = model->get_parameters()[0];
+
+    ov::Core core;
+    auto reference = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    auto hybrid = core.compile_model(model,
+                                     ov::test::utils::DEVICE_CPU,
+                                     ov::intel_cpu::enable_hybrid_node_placement(true));
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, param->get_shape());
+    auto reference_request = reference.create_infer_request();
+    reference_request.set_input_tensor(input);
+    reference_request.infer();
+
+    auto request = hybrid.create_infer_request();
+    request.set_input_tensor(input);
+    for (size_t i = 0; i < 4; i++) {
+        request.infer();
+        ov::test::utils::compare(reference_request.get_output_tensor(), request.get_output_tensor(), 1e-4);
+    }
+
+    const auto supported = hybrid.get_property(ov::supported_properties);
+    EXPECT_NE(std::find(supported.begin(), supported.end(), ov::intel_cpu::efficient_core_time_share.name()),
+              supported.end());
+    const auto share = hybrid.get_property(ov::intel_cpu::efficient_core_time_share);
+    EXPECT_GT(share, 0.F);
+    EXPECT_LE(share, 1.F);
+}
+
+// Every stream offloads its segments to efficient cores of its own, concurrent requests must not interfere
+TEST(HybridNodePlacement, smoke_ConcurrentStreamsMatchReference) {
+    if (!has_efficient_cores()) {
+        GTEST_SKIP() << "The segments are only placed on the efficient cores of a hybrid CPU";
+    }
+    auto model = make_hybrid_model();
+    auto param = model->get_parameters()[0];
+
+    ov::Core core;
+    auto reference = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    auto hybrid = core.compile_model(model,
+                                     ov::test::utils::DEVICE_CPU,
+                                     ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                     ov::intel_cpu::enable_hybrid_node_placement(true));
+    const auto streams = hybrid.get_property(ov::num_streams).num;
+
+    std::vector<ov::Tensor> inputs;
+    std::vector<ov::InferRequest> references;
+    std::vector<ov::InferRequest> requests;
+    for (int i = 0; i < std::max(2, streams); i++) {
+        const ov::test::utils::InputGenerateData data(-5, 10, 1, i + 1);
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, param->get_shape(), data));
+        references.push_back(reference.create_infer_request());
+        references.back().set_input_tensor(inputs.back());
+        references.back().infer();
+        requests.push_back(hybrid.create_infer_request());
+        requests.back().set_input_tensor(inputs.back());
+    }
+    for (size_t iteration = 0; iteration < 4; iteration++) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            ov::test::utils::compare(references[i].get_output_tensor(), requests[i].get_output_tensor(), 1e-4);
+        }
+    }
+
+    EXPECT_GT(hybrid.get_property(ov::intel_cpu::efficient_core_time_share), 0.F);
+}
+
+}  // namespace
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/matmul_bias.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+constexpr size_t num_requests = 7;
+
+// Runs the requests of the compiled model concurrently and compares their results with the ones of the requests
+// executed one by one
+void run_concurrently(ov::CompiledModel& reference, ov::CompiledModel& batched) {
+    auto reference_request = reference.create_infer_request();
+    std::vector<ov::InferRequest> requests;
+    std::vector<ov::Tensor> expected;
+    for (size_t i = 0; i < num_requests; i++) {
+        auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32,
+                                                             {1, 3, 24, 24},
+                                                             ov::test::utils::InputGenerateData(-10, 20, 1, i));
+        reference_request.set_input_tensor(input);
+        reference_request.infer();
+        ov::Tensor output(ov::element::f32, reference_request.get_output_tensor().get_shape());
+        reference_request.get_output_tensor().copy_to(output);
+        expected.push_back(output);
+
+        requests.push_back(batched.create_infer_request());
+        requests.back().set_input_tensor(input);
+    }
+
+    // enough iterations to pass through the measurement windows of both modes
+    for (size_t iteration = 0; iteration < 64; iteration++) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (size_t i = 0; i < num_requests; i++) {
+            requests[i].wait();
+            ov::test::utils::compare(expected[i], requests[i].get_output_tensor(), 1e-4);
+        }
+    }
+}
+
+// Concurrent asynchronous requests of a micro-batched model must get the same results as the requests executed one
+// by one, whichever of the direct and the batched modes serves them, and some of them must be served in batches.
+TEST(MicroBatching, smoke_AsyncRequestsMatchSequentialExecution) {
+    ov::Core core;
+    auto model = ov::test::utils::make_matmul_bias({1, 3, 24, 24});
+
+    auto reference = core.compile_model(model,
+                                        ov::test::utils::DEVICE_CPU,
+                                        ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+    auto batched = core.compile_model(model,
+                                      ov::test::utils::DEVICE_CPU,
+                                      ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                                      ov::intel_cpu::micro_batch_size(4),
+                                      ov::intel_cpu::micro_batch_timeout(1000));
+
+    const auto supported = batched.get_property(ov::supported_properties);
+    for (const auto& name : {ov::intel_cpu::micro_batching_mode.name(), ov::intel_cpu::micro_batched_requests.name()}) {
+        EXPECT_NE(std::find(supported.begin(), supported.end(), name), supported.end()) << name;
+    }
+    // the batched mode is the first one measured
+    EXPECT_EQ(batched.get_property(ov::intel_cpu::micro_batching_mode), "BATCHED");
+
+    run_concurrently(reference, batched);
+
+    EXPECT_GT(batched.get_property(ov::intel_cpu::micro_batched_requests), 0U);
+    const auto mode = batched.get_property(ov::intel_cpu::micro_batching_mode);
+    EXPECT_TRUE(mode == "BATCHED" || mode == "DIRECT") << mode;
+    EXPECT_EQ(reference.get_property(ov::intel_cpu::micro_batching_mode), "DISABLED");
+    EXPECT_EQ(reference.get_property(ov::intel_cpu::micro_batched_requests), 0U);
+}
+
+// The model imported from a blob, e.g. from the model cache, is micro-batched as well.
+TEST(MicroBatching, smoke_ImportedModelIsBatched) {
+    ov::Core core;
+    auto model = ov::test::utils::make_matmul_bias({1, 3, 24, 24});
+    const ov::AnyMap config = {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT),
+                               ov::intel_cpu::micro_batch_size(4),
+                               ov::intel_cpu::micro_batch_timeout(1000)};
+
+    auto reference = core.compile_model(model,
+                                        ov::test::utils::DEVICE_CPU,
+                                        ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+    std::stringstream blob;
+    core.compile_model(model, ov::test::utils::DEVICE_CPU, config).export_model(blob);
+    auto imported = core.import_model(blob, ov::test::utils::DEVICE_CPU, config);
+    EXPECT_EQ(imported.get_property(ov::intel_cpu::micro_batching_mode), "BATCHED");
+
+    run_concurrently(reference, imported);
+
+    EXPECT_GT(imported.get_property(ov::intel_cpu::micro_batched_requests), 0U);
+}
+
+}  // namespace
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace {
+
+// Single row FullyConnected layers separated by Softmax nodes, so the weights of the next layers are prefetched while
+// the Softmax nodes run. The prefetch must be requested, must not change the results and every FullyConnected must
+// report its bandwidth once profiling is enabled.
+TEST(WeightsPrefetch, smoke_DecodeLikeChainMatchesReference) {
+    constexpr size_t hidden = 1024;
+    constexpr size_t layers = 4;
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, hidden});
+    std::shared_ptr<ov::Node> x = param;
+    for (size_t i = 0; i < layers; i++) {
+        const std::vector<float> values(hidden * hidden, 0.01F * static_cast<float>(i + 1));
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{hidden, hidden}, values);
+        auto fc = std::make_shared<ov::op::v0::MatMul>(x, weights, false, true);
+        // Softmax is not fused into FullyConnected
+        x = std::make_shared<ov::op::v8::Softmax>(fc, 1);
+    }
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{x}, ov::ParameterVector{param});
+
+    ov::Core core;
+    auto reference =
+        core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::hint::inference_precision(ov::element::f32));
+    auto prefetching = core.compile_model(model,
+                                          ov::test::utils::DEVICE_CPU,
+                                          ov::hint::inference_precision(ov::element::f32),
+                                          ov::intel_cpu::weights_prefetch_distance(2),
+                                          ov::enable_profiling(true));
+
+    const auto supported = prefetching.get_property(ov::supported_properties);
+    for (const auto& name : {ov::intel_cpu::weights_bandwidth.name(),
+                             ov::intel_cpu::weights_prefetch_requested_bytes.name()}) {
+        EXPECT_NE(std::find(supported.begin(), supported.end(), name), supported.end()) << name;
+    }
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, param->get_shape());
+    auto reference_request = reference.create_infer_request();
+    reference_request.set_input_tensor(input);
+    reference_request.infer();
+
+    auto request = prefetching.create_infer_request();
+    request.set_input_tensor(input);
+    for (size_t i = 0; i < 4; i++) {
+        request.infer();
+        ov::test::utils::compare(reference_request.get_output_tensor(), request.get_output_tensor(), 1e-4);
+    }
+
+    EXPECT_GT(prefetching.get_property(ov::intel_cpu::weights_prefetch_requested_bytes), 0U);
+    EXPECT_EQ(reference.get_property(ov::intel_cpu::weights_prefetch_requested_bytes), 0U);
+
+    const auto bandwidth = prefetching.get_property(ov::intel_cpu::weights_bandwidth);
+    EXPECT_EQ(bandwidth.size(), layers);
+    for (const auto& [layer, gbps] : bandwidth) {
+        EXPECT_GT(gbps, 0.F) << layer;
+    }
+    EXPECT_TRUE(reference.get_property(ov::intel_cpu::weights_bandwidth).empty());
+}
+
+}  // namespace
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> eltwiseChain() {
+    auto param0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16, 8, 8});
+    auto param1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16, 8, 8});
+    auto add = std::make_shared<ov::op::v1::Add>(param0, param1);
+    auto mul = std::make_shared<ov::op::v1::Multiply>(add, param1);
+    auto relu = std::make_shared<ov::op::v0::Relu>(mul);
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param0, param1});
+}
+
+TEST(JitKernelsStats, smoke_CodegenIsAccounted) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP() << "The JIT kernels are generated on AVX2 and newer";
+    }
+    ov::Core core;
+    auto compiled = core.compile_model(eltwiseChain(), ov::test::utils::DEVICE_CPU);
+    auto request = compiled.create_infer_request();
+    for (const auto& input : compiled.inputs()) {
+        request.set_tensor(input, ov::test::utils::create_and_fill_tensor(ov::element::f32, input.get_shape()));
+    }
+    request.infer();
+
+    const auto stats = core.get_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_stats);
+    ASSERT_FALSE(stats.empty());
+    for (const auto& [type, kernels] : stats) {
+        EXPECT_GT(kernels.kernels, 0U) << type;
+        EXPECT_GT(kernels.code_bytes, 0U) << type;
+        EXPECT_LE(kernels.deduplicated, kernels.kernels) << type;
+    }
+}
+
+uint64_t deduplicatedKernels(const ov::Core& core) {
+    uint64_t deduplicated = 0;
+    const auto stats = core.get_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_stats);
+    for (const auto& [type, kernels] : stats) {
+        deduplicated += kernels.deduplicated;
+    }
+    return deduplicated;
+}
+
+// The second compilation of the same model generates the same code. The kernels of the first model are kept in the
+// cache after it's destroyed, so the second model reuses them and the results don't change.
+TEST(JitKernelsStats, smoke_CacheCapacity) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP() << "The JIT kernels are generated on AVX2 and newer";
+    }
+    ov::Core core;
+    core.set_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_cache_capacity(1 << 20));
+    EXPECT_EQ(core.get_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_cache_capacity), 1U << 20);
+
+    auto model = eltwiseChain();
+    std::vector<ov::Tensor> inputs;
+    for (const auto& input : model->inputs()) {
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, input.get_shape()));
+    }
+    auto infer = [&](ov::CompiledModel& compiled) {
+        auto request = compiled.create_infer_request();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            request.set_input_tensor(i, inputs[i]);
+        }
+        request.infer();
+        const auto output = request.get_output_tensor();
+        ov::Tensor result(output.get_element_type(), output.get_shape());
+        output.copy_to(result);
+        return result;
+    };
+
+    ov::Tensor expected;
+    {
+        auto first = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+        expected = infer(first);
+    }
+    const auto deduplicated = deduplicatedKernels(core);
+
+    auto second = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    EXPECT_GT(deduplicatedKernels(core), deduplicated);
+    ov::test::utils::compare(expected, infer(second));
+
+    core.set_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_cache_capacity(0));
+    EXPECT_EQ(core.get_property(ov::test::utils::DEVICE_CPU, ov::intel_cpu::jit_kernels_cache_capacity), 0U);
+}
+
+// The cache is process wide, so its capacity can't be passed to a single model
+TEST(JitKernelsStats, smoke_CacheCapacityIsRejectedByCompileModel) {
+    ov::Core core;
+    EXPECT_THROW(core.compile_model(eltwiseChain(),
+                                    ov::test::utils::DEVICE_CPU,
+                                    ov::intel_cpu::jit_kernels_cache_capacity(1 << 20)),
+                 ov::Exception);
+}
+
+}  // namespace
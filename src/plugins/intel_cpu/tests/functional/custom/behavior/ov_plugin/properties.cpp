@@ -70,6 +70,7 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::key_cache_group_size.name()),
         RW_property(ov::value_cache_group_size.name()),
         RW_property(ov::enable_weightless.name()),
+        RW_property(ov::cache_dir.name()),
     };
 
     ov::Core ie;
@@ -409,6 +409,46 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+// long axes, e.g. LLM vocabularies, are processed with radix select
+const std::vector<int64_t> k_radix_select = {8, 50, 256};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select = {
+    {{}, {{1, 2, 3, 8192}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{-1, -1, -1, -1}, {{1, 1, 1, 8192}, {1, 2, 3, 8192}, {1, 1, 1, 8192}}}};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_TopK_radix_select,
+    TopKLayerCPUTest,
+    ::testing::Combine(::testing::Combine(::testing::ValuesIn(k_radix_select),
+                                          ::testing::Values(3),
+                                          ::testing::ValuesIn(modes),
+                                          ::testing::ValuesIn(sortTypeStable),
+                                          ::testing::Values(ElementType::f32, ElementType::i32),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::ValuesIn(inputShapes_radix_select)),
+                       ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+                       ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_TopK_radix_select_dynamic,
+    TopKLayerCPUTest,
+    ::testing::Combine(::testing::Combine(::testing::Values(64),
+                                          ::testing::Values(3),
+                                          ::testing::ValuesIn(modes),
+                                          ::testing::ValuesIn(sortTypeStable),
+                                          ::testing::ValuesIn(netPrecisions),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+                       ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+                       ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(
     smoke_TopK_negative,
     TopKLayerInvalidK,
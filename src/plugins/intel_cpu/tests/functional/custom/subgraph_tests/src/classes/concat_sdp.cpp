@@ -101,9 +101,18 @@ void ConcatSDPTest::SetUp() {
     const bool is_u8 = has_value("KEY_CACHE_PRECISION", "u8") || has_value("VALUE_CACHE_PRECISION", "u8");
     const bool is_tbq = has_value("KEY_CACHE_QUANT_ALG", "TURBO") ||
                         has_value("VALUE_CACHE_QUANT_ALG", "TURBO");
+    // f8 caches carry no scales: the error is relative to the value, 2^-4 for e4m3 and 2^-3 for e5m2
+    const bool is_f8e4m3 = has_value("KV_CACHE_PRECISION", "f8e4m3");
+    const bool is_f8e5m2 = has_value("KV_CACHE_PRECISION", "f8e5m2");
     rel_threshold = 1e-2F;
     abs_threshold = 1e-3F;
-    if (is_u4 && is_tbq) {
+    if (is_f8e5m2) {
+        rel_threshold = 0.05F;
+        abs_threshold = 0.06F;
+    } else if (is_f8e4m3) {
+        rel_threshold = 0.05F;
+        abs_threshold = 0.03F;
+    } else if (is_u4 && is_tbq) {
         abs_threshold = 0.1F;
     } else if (is_u4) {
         abs_threshold = 0.08F;
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph:
+
+                              param
+                   /       /       |      \        \
+                 Add   Multiply  Gather   MVN   ReduceMean
+                  |       |        |       |        |
+               Subtract  Add       |       |       Add
+                   \       \       |       /        /
+                                 Concat
+                                   |
+                                 Result
+
+The branches are small, independent and of the same cost, so with ENABLE_BRANCH_PARALLELISM the eltwise, gather and
+MVN nodes of the same level are executed concurrently, each on its share of the threads. The main purpose of the test
+is to check that the concurrently executed nodes don't share memory and produce the same results as the sequential
+execution.
+*/
+
+namespace ov {
+namespace test {
+
+class BranchParallelism : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::intel_cpu::enable_branch_parallelism.name()] = true;
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 8, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto scalar = [&](float value) {
+            return std::make_shared<ov::op::v0::Constant>(precision, ov::Shape{1}, std::vector<float>{value});
+        };
+        auto indices = std::make_shared<ov::op::v0::Constant>(ov::element::i64,
+                                                              ov::Shape{8},
+                                                              std::vector<int64_t>{7, 6, 5, 4, 3, 2, 1, 0});
+        auto axes = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{1});
+        auto mvn_axes =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{2}, std::vector<int64_t>{2, 3});
+
+        auto add = utils::make_eltwise(param, scalar(1.0f), utils::EltwiseTypes::ADD);
+        auto sub = utils::make_eltwise(add, scalar(3.0f), utils::EltwiseTypes::SUBTRACT);
+        auto mul = utils::make_eltwise(param, scalar(2.0f), utils::EltwiseTypes::MULTIPLY);
+        auto mul_add = utils::make_eltwise(mul, scalar(0.5f), utils::EltwiseTypes::ADD);
+        auto gather = std::make_shared<ov::op::v8::Gather>(param, indices, axes);
+        auto mvn = std::make_shared<ov::op::v6::MVN>(param, mvn_axes, true, 1e-9f, ov::op::MVNEpsMode::INSIDE_SQRT);
+        auto reduce = std::make_shared<ov::op::v1::ReduceMean>(param, axes, true);
+        auto reduce_add = utils::make_eltwise(reduce, param, utils::EltwiseTypes::ADD);
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::NodeVector{sub, mul_add, gather, mvn, reduce_add}, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(concat);
+        function =
+            std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "BranchParallelism");
+    }
+};
+
+TEST_F(BranchParallelism, smoke_CompareWithRefs) {
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/runtime/profiling_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+/*  Param [1,C,H,W]
+ *     |
+ *    Relu
+ *     |
+ *  Reshape [1,C,H*W]
+ *     |
+ *  Multiply [1,C,1]
+ *
+ *  The per-channel Multiply is moved above the Reshape and fused into the Relu, so a single Eltwise node is executed.
+ */
+class MoveEltwiseUpThroughReshape : public SubgraphBaseStaticTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        // the snippets would fuse the chain through the Reshape on their own
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::DISABLE));
+        configuration.insert(ov::enable_profiling(true));
+
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{1, 4, 8, 8}}));
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes.front());
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1}, {0.5F, 1.5F, -2.F, 3.F});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+        function = std::make_shared<ov::Model>(ov::OutputVector{multiply},
+                                               ov::ParameterVector{param},
+                                               "MoveEltwiseUpThroughReshape");
+    }
+};
+
+TEST_F(MoveEltwiseUpThroughReshape, smoke_CompareWithRefs) {
+    run();
+
+    size_t eltwise_nodes = 0;
+    for (const auto& info : inferRequest.get_profiling_info()) {
+        if (info.node_type == "Eltwise" && info.status == ov::ProfilingInfo::Status::EXECUTED) {
+            eltwise_nodes++;
+        }
+    }
+    EXPECT_EQ(eltwise_nodes, 1U);
+}
+
+}  // namespace test
+}  // namespace ov
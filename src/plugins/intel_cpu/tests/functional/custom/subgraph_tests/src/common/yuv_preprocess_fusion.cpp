@@ -0,0 +1,195 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the subgraph PrePostProcessor builds for the NV12 camera frame:
+
+        Y (u8)      UV (u8)
+            \        /
+            NV12toBGR
+                |
+             Convert
+                |
+           Interpolate
+                |
+            Subtract
+                |
+             Divide
+                |
+            Transpose
+                |
+          [Convert u8/bf16]
+                |
+             Result
+
+The whole chain is expected to be executed by a single YuvPreprocess node when the fusion is enabled. The u8 output
+skips the normalization, so the values are meaningful after the truncation.
+*/
+
+namespace ov {
+namespace test {
+
+using InterpolateMode = ov::op::util::InterpolateBase::InterpolateMode;
+
+static std::shared_ptr<ov::Model> makeYuvPreprocessModel(InterpolateMode mode,
+                                                         ov::element::Type out_type,
+                                                         const std::vector<size_t>& image,
+                                                         const std::vector<int64_t>& size) {
+    const auto batch = image[0];
+    const auto height = image[1];
+    const auto width = image[2];
+    auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{batch, height, width, 1});
+    auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::Shape{batch, height / 2, width / 2, 2});
+    auto bgr = std::make_shared<ov::op::v8::NV12toBGR>(y, uv);
+    auto convert = std::make_shared<ov::op::v0::Convert>(bgr, ov::element::f32);
+
+    ov::op::util::InterpolateBase::InterpolateAttrs attrs(mode,
+                                                          ov::op::util::InterpolateBase::ShapeCalcMode::SIZES,
+                                                          {0, 0, 0, 0},
+                                                          {0, 0, 0, 0});
+    auto sizes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, size);
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+    auto resize = std::make_shared<ov::op::v11::Interpolate>(convert, sizes, axes, attrs);
+
+    auto mean = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {103.9f, 116.8f, 123.7f});
+    auto std_dev = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {57.4f, 57.1f, 58.4f});
+    std::shared_ptr<ov::Node> normalized = resize;
+    if (out_type != ov::element::u8) {
+        normalized = std::make_shared<ov::op::v1::Divide>(std::make_shared<ov::op::v1::Subtract>(resize, mean),
+                                                          std_dev);
+    }
+    auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2});
+    std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Transpose>(normalized, order);
+    if (out_type != ov::element::f32) {
+        result = std::make_shared<ov::op::v0::Convert>(result, out_type);
+    }
+
+    return std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{y, uv}, "YuvPreprocessFusion");
+}
+
+using YuvPreprocessFusionParams = std::tuple<InterpolateMode,    // resize mode
+                                             ov::element::Type,  // output precision
+                                             bool>;              // fusion enabled
+
+class YuvPreprocessFusion : public testing::WithParamInterface<YuvPreprocessFusionParams>,
+                            virtual public SubgraphBaseStaticTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<YuvPreprocessFusionParams>& obj) {
+        const auto& [mode, out_type, enabled] = obj.param;
+        std::ostringstream result;
+        result << "mode=" << mode << "_out=" << out_type << "_enabled=" << enabled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [mode, out_type, enabled] = GetParam();
+        m_enabled = enabled;
+        // the fusion is disabled by default, so the property is set only to enable it
+        if (enabled) {
+            configuration.insert({ov::intel_cpu::enable_yuv_preprocess_fusion(true)});
+        }
+        // u8 output is truncated, so a rounding difference of the resize may change it by one
+        abs_threshold = out_type == ov::element::u8 ? 1.0 : (out_type == ov::element::bf16 ? 2e-2 : 1e-2);
+        function = makeYuvPreprocessModel(mode, out_type, {1, 64, 96}, {40, 56});
+    }
+
+    bool m_enabled = false;
+};
+
+TEST_P(YuvPreprocessFusion, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "YuvPreprocess", m_enabled ? 1 : 0);
+    if (m_enabled) {
+        CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+        // the low precision result is stored by the fused node itself
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_YuvPreprocessFusion,
+                         YuvPreprocessFusion,
+                         ::testing::Combine(::testing::Values(InterpolateMode::LINEAR, InterpolateMode::NEAREST),
+                                            ::testing::Values(ov::element::f32, ov::element::bf16, ov::element::u8),
+                                            ::testing::Values(true)),
+                         YuvPreprocessFusion::getTestCaseName);
+
+// the fusion isn't applied by default
+INSTANTIATE_TEST_SUITE_P(smoke_YuvPreprocessFusion_Default,
+                         YuvPreprocessFusion,
+                         ::testing::Combine(::testing::Values(InterpolateMode::LINEAR),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(false)),
+                         YuvPreprocessFusion::getTestCaseName);
+
+// Latency of the fused node against the unfused chain on camera frames resized to the classification and detection
+// inputs, the fusion is to be enabled by default only where it pays off.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*YuvPreprocessFusionBenchmark*
+using YuvPreprocessBenchmarkParams = std::tuple<InterpolateMode,        // resize mode
+                                                std::vector<size_t>,    // source image {N, H, W}
+                                                std::vector<int64_t>>;  // output {H, W}
+
+class YuvPreprocessFusionBenchmark : public testing::WithParamInterface<YuvPreprocessBenchmarkParams>,
+                                     public ov::test::TestsCommon {
+protected:
+    static double measureLatency(const std::shared_ptr<ov::Model>& model, bool fused) {
+        ov::Core core;
+        auto compiled =
+            core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::intel_cpu::enable_yuv_preprocess_fusion(fused));
+        auto request = compiled.create_infer_request();
+        for (const auto& input : compiled.inputs()) {
+            request.set_tensor(input, utils::create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+        }
+
+        constexpr size_t warmup = 10;
+        constexpr size_t iterations = 100;
+        for (size_t i = 0; i < warmup; i++) {
+            request.infer();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.infer();
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+TEST_P(YuvPreprocessFusionBenchmark, DISABLED_Latency) {
+    const auto& [mode, image, size] = GetParam();
+    const auto model = makeYuvPreprocessModel(mode, ov::element::f32, image, size);
+    const auto unfused_us = measureLatency(model, false);
+    const auto fused_us = measureLatency(model, true);
+    std::cout << "mode=" << mode << "_image=" << ov::test::utils::vec2str(image)
+              << "_size=" << ov::test::utils::vec2str(size) << ": unfused " << unfused_us << " us, fused " << fused_us
+              << " us, speedup " << unfused_us / fused_us << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(YuvPreprocessFusion,
+                         YuvPreprocessFusionBenchmark,
+                         ::testing::Combine(::testing::Values(InterpolateMode::LINEAR, InterpolateMode::NEAREST),
+                                            ::testing::Values(std::vector<size_t>{1, 1080, 1920},
+                                                              std::vector<size_t>{1, 720, 1280},
+                                                              std::vector<size_t>{4, 480, 640}),
+                                            ::testing::Values(std::vector<int64_t>{224, 224},
+                                                              std::vector<int64_t>{640, 640})));
+
+}  // namespace test
+}  // namespace ov
@@ -3,6 +3,12 @@
 //
 #include "custom/subgraph_tests/src/classes/concat_sdp.hpp"
 
+#include <cmath>
+#include <limits>
+
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
+
 namespace ov {
 namespace test {
 namespace {
@@ -61,6 +67,72 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTest,
                                             ::testing::Values<int64_t>(8, 2, 1)),
                          ConcatSDPTest::getTestCaseName);
 
+const std::vector<ov::AnyMap> f8KvCfgs = {
+    {{ov::hint::kv_cache_precision.name(), "f8e4m3"}},
+    {{ov::hint::kv_cache_precision.name(), "f8e5m2"}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTestF8Cache,
+                         ConcatSDPTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
+                                            ::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(f8KvCfgs),
+                                            ::testing::Values(false),
+                                            ::testing::Values<int64_t>(8),
+                                            ::testing::Values<int64_t>(8, 2)),
+                         ConcatSDPTest::getTestCaseName);
+
+// f8 cache stores saturate values beyond the f8 range and keep NaN. The current k/v get values out of the f8 range
+// and v gets a NaN; the reference runs the same inputs saturated to the f8 range through an f32 cache.
+class ConcatSDPF8SaturationTest : public ConcatSDPTest {
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        ConcatSDPTest::generate_inputs(targetInputStaticShapes);
+        const auto prec = m_cacheCfg.at(ov::hint::kv_cache_precision.name()).as<std::string>();
+        const float f8_max = prec == "f8e4m3" ? static_cast<float>(std::numeric_limits<ov::float8_e4m3>::max())
+                                              : static_cast<float>(std::numeric_limits<ov::float8_e5m2>::max());
+        const float big = m_saturate ? f8_max : 1e5F;
+        const auto& params = function->get_parameters();
+        for (size_t port : {1, 2}) {
+            auto* data = inputs.at(params[port]).data<float>();
+            data[0] = big;
+            data[1] = -big;
+        }
+        inputs.at(params[2]).data<float>()[2] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    void run() override {
+        auto ref_config = configuration;
+        ref_config.erase(ov::hint::kv_cache_precision.name());
+        m_saturate = true;
+        auto expected = run_test(functionRefs, ref_config);
+        m_saturate = false;
+        auto actual = run_test(function, configuration);
+        for (size_t i = 0; i < actual.size(); ++i) {
+            ASSERT_TRUE(std::isnan(actual[i][0].data<float>()[2])) << "NaN in the f8 cache must reach the output";
+            ASSERT_TRUE(std::isfinite(actual[i][0].data<float>()[0])) << "f8 cache store must saturate";
+            compare(expected[i], actual[i]);
+        }
+    }
+
+    bool m_saturate = false;
+};
+
+TEST_P(ConcatSDPF8SaturationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPF8SaturationTest,
+                         ConcatSDPF8SaturationTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::Values(inputShapes[0]),
+                                            ::testing::ValuesIn(f8KvCfgs),
+                                            ::testing::Values(false),
+                                            ::testing::Values<int64_t>(8),
+                                            ::testing::Values<int64_t>(8)),
+                         ConcatSDPTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
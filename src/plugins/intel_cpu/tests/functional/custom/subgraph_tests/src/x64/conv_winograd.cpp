@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov::test {
+
+using ConvWinogradParams = std::tuple<InputShape,                // input
+                                      size_t,                    // output channels
+                                      bool,                      // with relu
+                                      bool,                      // winograd enabled
+                                      ov::hint::ExecutionMode>;  // execution mode
+
+// fp32 3x3 stride 1 convolution with the inputs and the weights in [-1, 1]
+static std::shared_ptr<ov::Model> makeConvWinogradModel(const ov::PartialShape& input_shape,
+                                                        size_t out_channels,
+                                                        bool with_relu) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, input_shape);
+    std::shared_ptr<ov::Node> conv = utils::make_convolution(param,
+                                                             ov::element::f32,
+                                                             {3, 3},
+                                                             {1, 1},
+                                                             {1, 1},
+                                                             {1, 1},
+                                                             {1, 1},
+                                                             ov::op::PadType::EXPLICIT,
+                                                             out_channels,
+                                                             utils::InputGenerateData(-1, 2, 1000),
+                                                             true);
+    if (with_relu) {
+        conv = std::make_shared<ov::op::v0::Relu>(conv);
+    }
+    return std::make_shared<ov::Model>(conv->outputs(), ov::ParameterVector{param}, "ConvWinograd");
+}
+
+// fp32 3x3 stride 1 convolutions with large spatial sizes and enough channels (16 on AVX2, 64 on AVX-512) are executed
+// with Winograd F(4x4, 3x3) unless it's disabled explicitly or the execution mode is ACCURACY
+class ConvWinograd : public testing::WithParamInterface<ConvWinogradParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvWinogradParams>& obj) {
+        const auto& [input_shape, out_channels, with_relu, winograd, execution_mode] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << utils::partialShape2str({input_shape.first}) << "_TS=";
+        for (const auto& shape : input_shape.second) {
+            result << utils::vec2str(shape) << "_";
+        }
+        result << "OC=" << out_channels << "_Relu=" << with_relu << "_Winograd=" << winograd
+               << "_Mode=" << execution_mode;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [input_shape, out_channels, with_relu, winograd, execution_mode] = this->GetParam();
+        m_winogradRequested = winograd && execution_mode == ov::hint::ExecutionMode::PERFORMANCE;
+        if (!winograd) {
+            configuration.insert({ov::intel_cpu::enable_winograd_convolution(false)});
+        }
+        configuration.insert({ov::hint::execution_mode(execution_mode)});
+        configuration.insert({ov::hint::inference_precision(ov::element::f32)});
+
+        init_input_shapes({input_shape});
+        m_inChannels = static_cast<size_t>(inputDynamicShapes[0][1].get_length());
+        m_outChannels = out_channels;
+        // An output sums IC * 9 products of values in [-1, 1], so the rounding error of the direct convolution is
+        // below IC * 9 * eps. The tile transforms scale the error by the norms of B^T, G and A^T, whose products
+        // over the two tile dimensions stay below 2^10 for the points 0, +-1, +-2 and the random data. No relative
+        // part: the bound covers the outputs close to zero as well
+        constexpr double transformGrowth = 1024.0;
+        constexpr double eps = std::numeric_limits<float>::epsilon();
+        abs_threshold = static_cast<double>(m_inChannels) * 9.0 * eps * transformGrowth;
+        rel_threshold = 0.0;
+
+        function = makeConvWinogradModel(inputDynamicShapes[0], out_channels, with_relu);
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->get_parameters()[0];
+        inputs.insert({param,
+                       utils::create_and_fill_tensor(param->get_element_type(),
+                                                     targetInputStaticShapes[0],
+                                                     utils::InputGenerateData(-1, 2, 1000))});
+    }
+
+    void checkImplType() const {
+#ifdef OV_CPU_WITH_MLAS
+        const bool winograd_supported = ov::with_cpu_x86_avx2();
+#else
+        const bool winograd_supported = false;
+#endif
+        const size_t min_channels = ov::with_cpu_x86_avx512_core() ? 64 : 16;
+        const bool enough_channels = m_inChannels >= min_channels && m_outChannels >= min_channels;
+        const auto& out_shape = function->get_output_shape(0);
+        const bool large_spatial = out_shape[2] * out_shape[3] >= 56 * 56;
+        const bool winograd_expected = winograd_supported && enough_channels && large_spatial && m_winogradRequested;
+        size_t conv_count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = node->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "Convolution") {
+                continue;
+            }
+            conv_count++;
+            const auto prim_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(winograd_expected, prim_type == "winograd_mlas") << prim_type;
+        }
+        // the activation is fused into the convolution
+        ASSERT_EQ(conv_count, 1);
+    }
+
+private:
+    bool m_winogradRequested = false;
+    size_t m_inChannels = 0;
+    size_t m_outChannels = 0;
+};
+
+TEST_P(ConvWinograd, CompareWithRefs) {
+    run();
+    checkImplType();
+}
+
+namespace {
+
+const std::vector<InputShape> input_shapes = {
+    // output tiles fully inside
+    {{}, {{1, 32, 64, 64}}},
+    // partial tiles at the bottom and right borders
+    {{}, {{2, 24, 58, 61}}},
+    // wide enough for the AVX-512 threshold
+    {{}, {{1, 64, 56, 56}}},
+    // small spatial sizes fall back to the direct implementations
+    {{}, {{1, 32, 14, 14}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConvWinograd,
+                         ConvWinograd,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values(16, 64),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(ov::hint::ExecutionMode::PERFORMANCE,
+                                                              ov::hint::ExecutionMode::ACCURACY)),
+                         ConvWinograd::getTestCaseName);
+
+// disabled explicitly, the direct implementations are used
+INSTANTIATE_TEST_SUITE_P(smoke_ConvWinograd_Disabled,
+                         ConvWinograd,
+                         ::testing::Combine(::testing::Values(input_shapes[2]),
+                                            ::testing::Values(64),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ov::hint::ExecutionMode::PERFORMANCE)),
+                         ConvWinograd::getTestCaseName);
+
+}  // namespace
+
+// Compares Winograd with the direct implementation selected otherwise (brgconv on AVX-512)
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*ConvWinogradBenchmark*
+using ConvWinogradBenchmarkParams = std::tuple<ov::Shape,  // input shape
+                                               size_t>;    // output channels
+
+class ConvWinogradBenchmark : public testing::WithParamInterface<ConvWinogradBenchmarkParams>,
+                              public ov::test::TestsCommon {
+protected:
+    static double measureLatency(const std::shared_ptr<ov::Model>& model, bool winograd) {
+        ov::Core core;
+        auto compiled = core.compile_model(model,
+                                           ov::test::utils::DEVICE_CPU,
+                                           ov::intel_cpu::enable_winograd_convolution(winograd));
+        auto request = compiled.create_infer_request();
+        for (const auto& input : compiled.inputs()) {
+            request.set_tensor(input, utils::create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+        }
+
+        constexpr size_t warmup = 10;
+        constexpr size_t iterations = 100;
+        for (size_t i = 0; i < warmup; i++) {
+            request.infer();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.infer();
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+TEST_P(ConvWinogradBenchmark, DISABLED_Latency) {
+    const auto& [shape, out_channels] = GetParam();
+    const auto model = makeConvWinogradModel(shape, out_channels, true);
+    const auto direct_us = measureLatency(model, false);
+    const auto winograd_us = measureLatency(model, true);
+    std::cout << "shape=" << shape << "_OC=" << out_channels << ": direct " << direct_us << " us, winograd "
+              << winograd_us << " us, speedup " << direct_us / winograd_us << std::endl;
+}
+
+// ResNet and VGG 3x3 layers around the channel thresholds
+INSTANTIATE_TEST_SUITE_P(ConvWinograd,
+                         ConvWinogradBenchmark,
+                         ::testing::Combine(::testing::Values(ov::Shape{1, 16, 112, 112},
+                                                              ov::Shape{1, 32, 112, 112},
+                                                              ov::Shape{1, 64, 56, 56},
+                                                              ov::Shape{1, 128, 56, 56},
+                                                              ov::Shape{1, 256, 56, 56}),
+                                            ::testing::Values(16, 32, 64, 128, 256)));
+
+}  // namespace ov::test
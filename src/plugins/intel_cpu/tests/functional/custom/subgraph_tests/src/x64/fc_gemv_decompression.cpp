@@ -0,0 +1,163 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov::test {
+
+using FCGemvDecompressionParams = std::tuple<InputShape,                           // activations
+                                             ov::Shape,                            // weights [K, N]
+                                             int,                                  // group size, -1 per channel
+                                             ov::element::Type,                    // weights precision
+                                             ov::test::utils::DecompressionType>;  // zero points
+
+// FullyConnected with compressed weights and at most 4 rows must be executed by the split-K decompression GEMV
+// executor on AVX2 and AVX-512, while the larger batches keep the default implementation. Larger batches with f8
+// weights are executed by the MLAS decompression GEMM executor
+class FCGemvDecompressionCPUTest : public SubgraphBaseTest,
+                                   public testing::WithParamInterface<FCGemvDecompressionParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCGemvDecompressionParams>& obj) {
+        const auto& [input_shape, weights_shape, group_size, weights_precision, zero_points] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << input_shape << "_W=" << weights_shape << "_group=" << group_size
+               << "_weights=" << weights_precision << "_zp=" << zero_points;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        configuration.insert({ov::hint::dynamic_quantization_group_size.name(), 0});
+        const auto& [input_shape, weights_shape, group_size, weights_precision, zero_points] = GetParam();
+        abs_threshold = 5e-3;
+
+        init_input_shapes({input_shape});
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        const auto weights = utils::initMatMulDecompressionSubgraph(weights_shape,
+                                                                    group_size,
+                                                                    ov::element::f32,
+                                                                    weights_precision,
+                                                                    ov::element::f32,
+                                                                    ov::element::dynamic,
+                                                                    true,
+                                                                    utils::DecompressionType::full,
+                                                                    zero_points,
+                                                                    false);
+        auto fc = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        function = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Result>(fc)},
+                                               ov::ParameterVector{param},
+                                               "FCGemvDecompression");
+    }
+
+    void checkImplType() const {
+        size_t fc_count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = node->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected") {
+                continue;
+            }
+            fc_count++;
+            // the executor of a dynamic node is chosen per shape
+            if (node->get_input_partial_shape(0).is_dynamic()) {
+                continue;
+            }
+            const auto& dims = node->get_input_shape(0);
+            const auto rows = ov::shape_size(dims) / dims.back();
+            const auto weights_precision = std::get<3>(GetParam());
+            const bool f8_weights =
+                weights_precision == ov::element::f8e4m3 || weights_precision == ov::element::f8e5m2;
+#ifdef OV_CPU_WITH_MLAS
+            const bool compressed = ov::with_cpu_x86_avx2();
+#else
+            // f8 weights stay decompressed by the separate operations without the MLAS executor
+            const bool compressed = ov::with_cpu_x86_avx2() && !f8_weights;
+#endif
+            const bool gemv_expected = compressed && rows <= 4;
+            const auto prim_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(gemv_expected, prim_type.find("jit_gemv") != std::string::npos) << prim_type;
+            if (compressed && f8_weights && rows > 4) {
+                ASSERT_EQ("gemm_mlas", prim_type);
+            }
+        }
+        ASSERT_EQ(fc_count, 1);
+    }
+};
+
+TEST_P(FCGemvDecompressionCPUTest, CompareWithRefs) {
+    run();
+    checkImplType();
+}
+
+namespace {
+
+const std::vector<InputShape> input_shapes = {
+    {{}, {{1, 1, 512}}},
+    {{}, {{1, 3, 512}}},
+    {{}, {{4, 512}}},
+    {{}, {{1, 5, 512}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCGemvDecompression,
+                         FCGemvDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values(ov::Shape{512, 64}),
+                                            ::testing::Values(-1, 128),
+                                            ::testing::Values(ov::element::u8,
+                                                              ov::element::u4,
+                                                              ov::element::i4,
+                                                              ov::element::nf4),
+                                            ::testing::Values(ov::test::utils::DecompressionType::empty,
+                                                              ov::test::utils::DecompressionType::full)),
+                         FCGemvDecompressionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCGemvDecompression_fp8,
+                         FCGemvDecompressionCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 1, 512}}},
+                                                              InputShape{{}, {{1, 7, 512}}},
+                                                              InputShape{{}, {{16, 512}}}),
+                                            ::testing::Values(ov::Shape{512, 64}),
+                                            ::testing::Values(-1, 128),
+                                            ::testing::Values(ov::element::f8e4m3, ov::element::f8e5m2),
+                                            ::testing::Values(ov::test::utils::DecompressionType::empty,
+                                                              ov::test::utils::DecompressionType::full)),
+                         FCGemvDecompressionCPUTest::getTestCaseName);
+
+// the split of the decode step changes with the number of rows, so the executor is updated in place
+INSTANTIATE_TEST_SUITE_P(smoke_FCGemvDecompression_dynamic,
+                         FCGemvDecompressionCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{-1, -1, 256},
+                                                                         {{1, 1, 256},
+                                                                          {1, 2, 256},
+                                                                          {1, 4, 256},
+                                                                          {1, 1, 256}}}),
+                                            ::testing::Values(ov::Shape{256, 96}),
+                                            ::testing::Values(32),
+                                            ::testing::Values(ov::element::u4),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full)),
+                         FCGemvDecompressionCPUTest::getTestCaseName);
+
+// f8 weights switch between the GEMV and the decompression GEMM executors with the number of rows
+INSTANTIATE_TEST_SUITE_P(smoke_FCGemvDecompression_fp8_dynamic,
+                         FCGemvDecompressionCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{-1, -1, 256},
+                                                                         {{1, 1, 256},
+                                                                          {1, 9, 256},
+                                                                          {2, 17, 256},
+                                                                          {1, 3, 256}}}),
+                                            ::testing::Values(ov::Shape{256, 96}),
+                                            ::testing::Values(32),
+                                            ::testing::Values(ov::element::f8e4m3),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full)),
+                         FCGemvDecompressionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace ov::test
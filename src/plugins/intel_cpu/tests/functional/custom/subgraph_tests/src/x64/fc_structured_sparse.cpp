@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov::test {
+
+enum class WeightsSparsity { Dense, Structured2x4, Block1x16, Block4x4 };
+
+static std::ostream& operator<<(std::ostream& os, WeightsSparsity sparsity) {
+    switch (sparsity) {
+    case WeightsSparsity::Dense:
+        return os << "Dense";
+    case WeightsSparsity::Structured2x4:
+        return os << "2x4";
+    case WeightsSparsity::Block1x16:
+        return os << "1x16";
+    case WeightsSparsity::Block4x4:
+        return os << "4x4";
+    }
+    return os;
+}
+
+using FCStructuredSparseParams = std::tuple<InputShape,       // activations
+                                            size_t,           // output channels
+                                            WeightsSparsity,  // weights sparsity pattern
+                                            bool,             // with bias
+                                            bool>;            // sparse executor disabled by the property
+
+// FullyConnected with f32 weights pruned to 2:4 / 1x16 / 4x4 blocks must be executed by the sparse JIT executor
+// on AVX2 and AVX-512 by default when the activations have at most 32 rows, while dense weights, larger batches and
+// the explicitly disabled executor keep the default implementation
+class FCStructuredSparseCPUTest : public SubgraphBaseTest,
+                                  public testing::WithParamInterface<FCStructuredSparseParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCStructuredSparseParams>& obj) {
+        const auto& [input_shape, N, sparsity, with_bias, disabled] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << input_shape << "_N=" << N << "_sparsity=" << sparsity << "_bias=" << with_bias
+               << "_disabled=" << disabled;
+        return result.str();
+    }
+
+protected:
+    static std::vector<float> generateWeights(size_t N, size_t K, WeightsSparsity sparsity) {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> values(-1.F, 1.F);
+        std::uniform_int_distribution<size_t> position(0, 3);
+        std::bernoulli_distribution is_zero_block(0.6);
+
+        std::vector<float> weights(N * K);
+        for (auto& w : weights) {
+            w = values(gen);
+        }
+        switch (sparsity) {
+        case WeightsSparsity::Dense:
+            break;
+        case WeightsSparsity::Structured2x4:
+            for (size_t i = 0; i < N * K; i += 4) {
+                const auto first = position(gen);
+                const auto second = (first + 1 + position(gen) % 3) % 4;
+                for (size_t j = 0; j < 4; j++) {
+                    if (j != first && j != second) {
+                        weights[i + j] = 0.F;
+                    }
+                }
+            }
+            break;
+        case WeightsSparsity::Block1x16:
+        case WeightsSparsity::Block4x4: {
+            const size_t block_n = sparsity == WeightsSparsity::Block1x16 ? 16 : 4;
+            const size_t block_k = sparsity == WeightsSparsity::Block1x16 ? 1 : 4;
+            for (size_t n = 0; n < N; n += block_n) {
+                for (size_t k = 0; k < K; k += block_k) {
+                    if (!is_zero_block(gen)) {
+                        continue;
+                    }
+                    for (size_t bn = 0; bn < block_n; bn++) {
+                        std::fill_n(weights.begin() + (n + bn) * K + k, block_k, 0.F);
+                    }
+                }
+            }
+            break;
+        }
+        }
+        return weights;
+    }
+
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        // the sparse executor handles f32 activations only
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        const auto& [input_shape, N, sparsity, with_bias, disabled] = GetParam();
+        if (disabled) {
+            configuration.insert({ov::intel_cpu::enable_structured_sparse_fc(false)});
+        }
+        m_sparsity = sparsity;
+        m_disabled = disabled;
+        abs_threshold = 1e-4;
+
+        init_input_shapes({input_shape});
+        const auto K = static_cast<size_t>(inputDynamicShapes[0].rbegin()->get_length());
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::f32,
+                                                              ov::Shape{N, K},
+                                                              generateWeights(N, K, sparsity));
+        std::shared_ptr<ov::Node> fc = std::make_shared<ov::op::v0::MatMul>(param, weights, false, true);
+        if (with_bias) {
+            auto bias = utils::make_constant(ov::element::f32, ov::Shape{1, N});
+            fc = std::make_shared<ov::op::v1::Add>(fc, bias);
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Result>(fc)},
+                                               ov::ParameterVector{param},
+                                               "FCStructuredSparse");
+    }
+
+    void checkImplType() const {
+        // the executor of the last inferred shape is reported
+        const auto& last_shape = targetStaticShapes.back().front();
+        const auto rows = ov::shape_size(last_shape) / last_shape.back();
+        const bool sparse_expected =
+            !m_disabled && m_sparsity != WeightsSparsity::Dense && ov::with_cpu_x86_avx2() && rows <= 32;
+        size_t fc_count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = node->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "FullyConnected") {
+                continue;
+            }
+            fc_count++;
+            const auto prim_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(sparse_expected, prim_type.find("jit_sparse") != std::string::npos) << prim_type;
+        }
+        ASSERT_EQ(fc_count, 1);
+    }
+
+    WeightsSparsity m_sparsity = WeightsSparsity::Dense;
+    bool m_disabled = false;
+};
+
+TEST_P(FCStructuredSparseCPUTest, CompareWithRefs) {
+    run();
+    checkImplType();
+}
+
+// Latency of the sparse executor against the dense one chosen with the property disabled, it's used to pick the
+// maximal number of rows the sparse executor is selected for.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*FCStructuredSparseBenchmark*
+class FCStructuredSparseBenchmark : public FCStructuredSparseCPUTest {
+protected:
+    double measureLatency(bool sparse) {
+        auto config = configuration;
+        config[ov::intel_cpu::enable_structured_sparse_fc.name()] = sparse;
+        auto compiled = core->compile_model(function, targetDevice, config);
+        auto request = compiled.create_infer_request();
+        const auto& shape = targetStaticShapes.front().front();
+        request.set_input_tensor(utils::create_and_fill_tensor(ov::element::f32, shape));
+
+        constexpr size_t warmup = 10;
+        constexpr size_t iterations = 100;
+        for (size_t i = 0; i < warmup; i++) {
+            request.infer();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.infer();
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+TEST_P(FCStructuredSparseBenchmark, DISABLED_Latency) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP();
+    }
+    const auto dense_us = measureLatency(false);
+    const auto sparse_us = measureLatency(true);
+    std::cout << getTestCaseName({GetParam(), 0}) << ": dense " << dense_us << " us, sparse " << sparse_us
+              << " us, speedup " << dense_us / sparse_us << std::endl;
+}
+
+namespace {
+
+const std::vector<InputShape> input_shapes = {
+    {{}, {{1, 256}}},
+    {{}, {{2, 13, 256}}},
+    // above the rows threshold the dense executor is selected
+    {{}, {{1, 64, 256}}},
+    {{-1, -1, 256}, {{1, 1, 256}, {1, 7, 256}, {3, 9, 256}, {1, 1, 256}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCStructuredSparse,
+                         FCStructuredSparseCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            // 320 output channels: the block patterns are detected on a sample
+                                            ::testing::Values(64, 80, 320),
+                                            ::testing::Values(WeightsSparsity::Dense,
+                                                              WeightsSparsity::Structured2x4,
+                                                              WeightsSparsity::Block1x16,
+                                                              WeightsSparsity::Block4x4),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(false)),
+                         FCStructuredSparseCPUTest::getTestCaseName);
+
+// the sparse executor isn't used when it's disabled explicitly
+INSTANTIATE_TEST_SUITE_P(smoke_FCStructuredSparse_Disabled,
+                         FCStructuredSparseCPUTest,
+                         ::testing::Combine(::testing::Values(input_shapes[0]),
+                                            ::testing::Values(64),
+                                            ::testing::Values(WeightsSparsity::Structured2x4,
+                                                              WeightsSparsity::Block1x16),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true)),
+                         FCStructuredSparseCPUTest::getTestCaseName);
+
+// the projections of a 7B LLM from the decode step up to the compute bound prefill chunks
+const std::vector<InputShape> benchmark_shapes = {
+    {{}, {{1, 4096}}},
+    {{}, {{1, 8, 4096}}},
+    {{}, {{1, 16, 4096}}},
+    {{}, {{1, 32, 4096}}},
+    {{}, {{1, 64, 4096}}},
+    {{}, {{1, 128, 4096}}},
+    {{}, {{1, 256, 4096}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(FCStructuredSparse,
+                         FCStructuredSparseBenchmark,
+                         ::testing::Combine(::testing::ValuesIn(benchmark_shapes),
+                                            ::testing::Values(4096, 11008),
+                                            ::testing::Values(WeightsSparsity::Structured2x4,
+                                                              WeightsSparsity::Block1x16,
+                                                              WeightsSparsity::Block4x4),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false)),
+                         FCStructuredSparseCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace ov::test
@@ -0,0 +1,241 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/group_convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov::test {
+
+// 1x1 expand (+ReLU) -> 3x3 depthwise (+bias, ReLU) -> 1x1 project convolutions with an optional residual add
+static std::shared_ptr<ov::Model> makeInvertedResidualModel(size_t stride,
+                                                           size_t out_channels,
+                                                           bool residual,
+                                                           const ov::Shape& input_shape,
+                                                           size_t expanded_channels) {
+    const auto precision = element::f32;
+    auto param = std::make_shared<ov::op::v0::Parameter>(precision, input_shape);
+    auto expand = utils::make_convolution(param,
+                                          precision,
+                                          {1, 1},
+                                          {1, 1},
+                                          {0, 0},
+                                          {0, 0},
+                                          {1, 1},
+                                          ov::op::PadType::EXPLICIT,
+                                          expanded_channels,
+                                          true);
+    auto expand_relu = std::make_shared<ov::op::v0::Relu>(expand);
+
+    auto dw_weights = utils::make_constant(precision, std::vector<size_t>{expanded_channels, 1, 1, 3, 3});
+    auto dw_conv = utils::make_group_convolution(expand_relu,
+                                                 dw_weights,
+                                                 precision,
+                                                 std::vector<size_t>{stride, stride},
+                                                 ov::CoordinateDiff{1, 1},
+                                                 ov::CoordinateDiff{1, 1},
+                                                 std::vector<size_t>{1, 1},
+                                                 ov::op::PadType::EXPLICIT);
+    auto dw_bias_const = utils::make_constant(precision, std::vector<size_t>{1, expanded_channels, 1, 1});
+    auto dw_bias = std::make_shared<ov::op::v1::Add>(dw_conv, dw_bias_const);
+    auto dw_relu = std::make_shared<ov::op::v0::Relu>(dw_bias);
+
+    std::shared_ptr<ov::Node> project = utils::make_convolution(dw_relu,
+                                                                precision,
+                                                                {1, 1},
+                                                                {1, 1},
+                                                                {0, 0},
+                                                                {0, 0},
+                                                                {1, 1},
+                                                                ov::op::PadType::EXPLICIT,
+                                                                out_channels,
+                                                                true);
+    if (residual) {
+        project = std::make_shared<ov::op::v1::Add>(project, param);
+    }
+
+    return std::make_shared<ov::Model>(project->outputs(), ov::ParameterVector{param}, "InvertedResidual");
+}
+
+using InvertedResidualFusionParams = std::tuple<size_t,             // depthwise stride
+                                                size_t,             // output channels
+                                                bool,               // with residual add
+                                                ov::element::Type,  // inference precision
+                                                bool>;              // fusion enabled
+
+// 1x1 expand -> 3x3 depthwise -> 1x1 project convolutions must be executed as a single convolution node
+// when the fusion is enabled
+class InvertedResidualFusion : public testing::WithParamInterface<InvertedResidualFusionParams>,
+                               virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InvertedResidualFusionParams>& obj) {
+        const auto& [stride, out_channels, residual, inference_precision, enabled] = obj.param;
+        std::ostringstream result;
+        result << "S=" << stride << "_OC=" << out_channels << "_Residual=" << residual
+               << "_InferPrc=" << inference_precision << "_Enabled=" << enabled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto& [stride, out_channels, residual, inference_precision, enabled] = this->GetParam();
+        if (inference_precision == element::bf16 && !ov::with_cpu_x86_bfloat16()) {
+            GTEST_SKIP();
+        }
+        m_enabled = enabled;
+        configuration.insert({ov::intel_cpu::enable_inverted_residual_fusion(enabled)});
+        configuration.insert({ov::hint::inference_precision(inference_precision)});
+        if (inference_precision == element::bf16) {
+            rel_threshold = 2e-2;
+            abs_threshold = 1e-1;
+        }
+        const size_t in_channels = 24;
+        const size_t expanded_channels = 144;
+        // two threads: the expanded tensor doesn't fit their L2, so the block is fused and the bands are split
+        // between the threads
+        configuration.insert({ov::inference_num_threads(2)});
+        init_input_shapes({{{}, {{1, in_channels, 112, 112}}}});
+        function = makeInvertedResidualModel(stride,
+                                             out_channels,
+                                             residual,
+                                             inputDynamicShapes[0].to_shape(),
+                                             expanded_channels);
+    }
+
+    void checkFusing() const {
+        if (!ov::with_cpu_x86_avx2()) {
+            return;
+        }
+        size_t conv_count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = node->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "Convolution") {
+                continue;
+            }
+            conv_count++;
+            const auto prim_type = rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(m_enabled, prim_type.find("inverted_residual") != std::string::npos) << prim_type;
+            if (m_enabled) {
+                // data, expand weights and bias, depthwise weights and bias, project weights and bias
+                ASSERT_EQ(7, node->inputs().size());
+            }
+        }
+        if (m_enabled) {
+            ASSERT_EQ(1, conv_count) << "Only one convolution node is expected after fusing.";
+        } else {
+            ASSERT_LT(1, conv_count) << "The project convolution is not expected to be fused.";
+        }
+    }
+
+private:
+    bool m_enabled = false;
+};
+
+TEST_P(InvertedResidualFusion, CompareWithRefs) {
+    run();
+    checkFusing();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_InvertedResidualFusion_Stride1,
+                         InvertedResidualFusion,
+                         ::testing::Combine(::testing::Values(1),
+                                            ::testing::Values(24),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(element::f32, element::bf16),
+                                            ::testing::Values(true)),
+                         InvertedResidualFusion::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_InvertedResidualFusion_Stride2,
+                         InvertedResidualFusion,
+                         ::testing::Combine(::testing::Values(2),
+                                            ::testing::Values(32),
+                                            ::testing::Values(false),
+                                            ::testing::Values(element::f32, element::bf16),
+                                            ::testing::Values(true)),
+                         InvertedResidualFusion::getTestCaseName);
+
+// the block isn't fused by default
+INSTANTIATE_TEST_SUITE_P(smoke_InvertedResidualFusion_Disabled,
+                         InvertedResidualFusion,
+                         ::testing::Combine(::testing::Values(1),
+                                            ::testing::Values(24),
+                                            ::testing::Values(false),
+                                            ::testing::Values(element::f32),
+                                            ::testing::Values(false)),
+                         InvertedResidualFusion::getTestCaseName);
+
+}  // namespace
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*InvertedResidualFusionBenchmark*
+using InvertedResidualBenchmarkParams = std::tuple<ov::Shape,  // input shape
+                                                   size_t,     // expanded channels
+                                                   size_t,     // depthwise stride
+                                                   size_t>;    // threads, 0 - default
+
+class InvertedResidualFusionBenchmark : public testing::WithParamInterface<InvertedResidualBenchmarkParams>,
+                                        public ov::test::TestsCommon {
+protected:
+    static double measureLatency(const std::shared_ptr<ov::Model>& model, bool fused, size_t threads) {
+        ov::Core core;
+        ov::AnyMap config{ov::intel_cpu::enable_inverted_residual_fusion(fused)};
+        if (threads != 0) {
+            config.insert(ov::inference_num_threads(static_cast<int>(threads)));
+        }
+        auto compiled = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+        auto request = compiled.create_infer_request();
+        for (const auto& input : compiled.inputs()) {
+            request.set_tensor(input, utils::create_and_fill_tensor(input.get_element_type(), input.get_shape()));
+        }
+
+        constexpr size_t warmup = 10;
+        constexpr size_t iterations = 100;
+        for (size_t i = 0; i < warmup; i++) {
+            request.infer();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.infer();
+        }
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+TEST_P(InvertedResidualFusionBenchmark, DISABLED_Latency) {
+    const auto& [shape, expanded_channels, stride, threads] = GetParam();
+    const auto model = makeInvertedResidualModel(stride, shape[1], stride == 1, shape, expanded_channels);
+    const auto unfused_us = measureLatency(model, false, threads);
+    const auto fused_us = measureLatency(model, true, threads);
+    std::cout << "shape=" << shape << "_expanded=" << expanded_channels << "_stride=" << stride
+              << "_threads=" << threads << ": unfused " << unfused_us << " us, fused " << fused_us << " us, speedup "
+              << unfused_us / fused_us << std::endl;
+}
+
+// MobileNetV2 blocks with the expanded tensor out of L2
+INSTANTIATE_TEST_SUITE_P(InvertedResidualFusion,
+                         InvertedResidualFusionBenchmark,
+                         ::testing::Combine(::testing::Values(ov::Shape{1, 16, 112, 112},
+                                                              ov::Shape{1, 24, 112, 112},
+                                                              ov::Shape{1, 24, 56, 56},
+                                                              ov::Shape{8, 32, 28, 28}),
+                                            ::testing::Values(96, 144),
+                                            ::testing::Values(1, 2),
+                                            ::testing::Values(1, 4, 0)));
+
+}  // namespace ov::test
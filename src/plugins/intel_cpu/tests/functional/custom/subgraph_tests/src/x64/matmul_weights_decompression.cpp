@@ -43,6 +43,18 @@ const std::vector<MatMulDecompressionShapeParams> input_shapes_basic = {
     {{{}, {{1, 11, 154}}}, {154, 77}, 154ul},
     {{{-1, -1, -1}, {{10, 40, 480}, {11, 40, 480}}}, {1, 480, 256}},
 };
+// f8 weights are decompressed by the GEMV executor, which needs 2D weights with the multiple of 32 output channels
+const std::vector<MatMulDecompressionShapeParams> input_shapes_basic_fp8 = {
+    {{{-1, -1, -1}, {{1, 4, 16}, {10, 16, 16}}}, {16, 32}},
+    {{{}, {{1, 8, 16}}}, {16, 32}, 4ul},
+    {{{}, {{1, 4, 48}}}, {48, 256}},
+    {{{}, {{1, 11, 256}}}, {256, 64}, 128ul},
+};
+const std::vector<MatMulDecompressionShapeParams> input_shapes_basic_fp8_unsupported = {
+    {{{}, {{1, 4, 16}}}, {1, 16, 32}},
+    {{{}, {{1, 11, 154}}}, {154, 77}, 154ul},
+    {{{-1, -1, -1}, {{10, 40, 480}, {11, 40, 480}}}, {1, 480, 256}},
+};
 const std::vector<MatMulDecompressionShapeParams> input_shapes_basic_u2 = {
     {{{}, {{1, 8, 16}}}, {16, 2}},
     {{{}, {{1, 4, 16}}}, {16, 2}},
@@ -101,7 +113,23 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_basic_u2,
 
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_basic_fp8,
                          MatmulWeightsDecompression,
-                         ::testing::Combine(::testing::ValuesIn(input_shapes_basic),
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_basic_fp8),
+                                            ::testing::ValuesIn(weights_precisions_fp8),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::Values(ov::element::dynamic),
+                                            ::testing::Values(true),
+                                            ::testing::Values(DecompressionType::full),
+                                            ::testing::Values(DecompressionType::full),
+                                            // todo: zero points converted to fp32 for reshape == true case
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(filter_additional_config_basic()),
+                                            ::testing::ValuesIn(fusing_params),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_basic_fp8_unsupported,
+                         MatmulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_basic_fp8_unsupported),
                                             ::testing::ValuesIn(weights_precisions_fp8),
                                             ::testing::ValuesIn(decompression_precisions),
                                             ::testing::Values(ov::element::dynamic),
@@ -564,6 +564,8 @@ const std::vector<std::regex>& disabled_test_patterns() {
             std::regex(R"(.*smoke_Snippets.*PrecisionPropagation_Convertion.*)"),
             std::regex(R"(.*smoke_MHAQuant.*)"),
             std::regex(R"(.*smoke_Snippets_MLP.*)"),
+            // Normalization + FC tokenization is enabled on x64 only
+            std::regex(R"(.*smoke_Snippets_NormFC.*)"),
 #    if defined(OPENVINO_ARCH_ARM64)
             std::regex(R"(.*smoke_Snippets_GatedMLP_f32.*InputShape=\[\]_\(\[1\.32\.1024\]\).*)"),
             std::regex(R"(.*smoke_Snippets_MatMulTransposeB.*IS\[0\]=\[\]_.*T\[0\]=f32.*)"),
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/norm_fc.hpp"
+
+#include "utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+
+static std::vector<std::pair<InputShape, Shape>> shapes {
+    {InputShape{{-1, -1, 1024}, {{2, 128, 1024}, {1, 1, 1024}, {4, 17, 1024}, {1, 1, 1024}}}, Shape{256, 1024}},
+    {InputShape{{-1, 757}, {{1, 757}, {39, 757}, {2, 757}}}, Shape{127, 757}},
+    {InputShape{{}, {{1, 32, 1024}}}, Shape{1024, 1024}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_NormFC_f32,
+                         NormFC,
+                         ::testing::Combine(::testing::ValuesIn(shapes),
+                                            ::testing::Values(NormFCFunction::NormType::RMS,
+                                                              NormFCFunction::NormType::MVN),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(1),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::Values(CPUTestUtils::empty_plugin_config)),
+                         NormFC::getTestCaseName);
+
+}  // namespace
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
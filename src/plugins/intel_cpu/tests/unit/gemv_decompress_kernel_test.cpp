@@ -0,0 +1,299 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+#include "nodes/kernels/x64/gemv_decompress_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float8_e4m3.hpp"
+#include "openvino/core/type/float8_e5m2.hpp"
+
+using GemvDecompressParams = std::tuple<ov::element::Type,  // packed weights precision (u8, u4, f8e4m3 or f8e5m2)
+                                        size_t,             // M
+                                        size_t,             // N
+                                        size_t,             // K
+                                        size_t>;            // group size
+
+namespace gemvDecompressUnitTest {
+using namespace dnnl::impl::cpu::x64;
+using namespace ov::intel_cpu::kernel;
+
+// Decompression GEMV over the pre-packed layout, split over the panels and K as the FullyConnected executor does
+class GemvDecompress {
+public:
+    GemvDecompress(ov::element::Type type, size_t M, size_t N, size_t K, size_t group)
+        : m_type(type),
+          M(M),
+          N(N),
+          K(K),
+          m_group(group),
+          m_groups(K / group),
+          m_panel(mayiuse(avx512_core) ? gemv_decompress_panel_size<avx512_core>()
+                                       : gemv_decompress_panel_size<avx2>()) {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> codes(0, type == ov::element::u4 ? 15 : 255);
+        std::uniform_real_distribution<float> values(-1.F, 1.F);
+        m_weights.resize(N * K);
+        for (auto& w : m_weights) {
+            // f8 codes of finite values only
+            if (type == ov::element::f8e4m3) {
+                w = ov::float8_e4m3(values(gen) * 8.F).to_bits();
+            } else if (type == ov::element::f8e5m2) {
+                w = ov::float8_e5m2(values(gen) * 8.F).to_bits();
+            } else {
+                w = static_cast<uint8_t>(codes(gen));
+            }
+        }
+        m_scales.resize(N * m_groups);
+        m_zeroPoints.resize(N * m_groups);
+        for (size_t i = 0; i < N * m_groups; i++) {
+            m_scales[i] = values(gen) * 0.01F;
+            m_zeroPoints[i] = isF8() ? values(gen) : static_cast<float>(codes(gen));
+        }
+        m_src.resize(M * K);
+        for (auto& x : m_src) {
+            x = values(gen);
+        }
+        pack();
+
+        const jit_gemv_decompress_compile_params jcp{type, M, true};
+        if (mayiuse(avx512_core)) {
+            m_kernel = std::make_shared<jit_gemv_decompress_kernel<avx512_core>>(jcp);
+        } else {
+            m_kernel = std::make_shared<jit_gemv_decompress_kernel<avx2>>(jcp);
+        }
+        m_kernel->create_kernel();
+
+        const size_t panels = N / m_panel;
+        const auto threads = static_cast<size_t>(parallel_get_max_threads());
+        const size_t kSplit = std::min(m_groups, (threads + panels - 1) / panels);
+        m_blocksPerSplit = (m_groups + kSplit - 1) / kSplit;
+        m_kSplit = (m_groups + m_blocksPerSplit - 1) / m_blocksPerSplit;
+        m_partials.resize(panels * m_kSplit * M * m_panel);
+        m_dst.resize(M * N);
+    }
+
+    size_t weightsBytes() const {
+        return m_packedWeights.size();
+    }
+
+    const std::vector<float>& run() {
+        const size_t panels = N / m_panel;
+        const size_t rowBytes = m_type == ov::element::u4 ? m_panel / 2 : m_panel;
+        ov::parallel_for2d(panels, m_kSplit, [&](size_t p, size_t s) {
+            const size_t b0 = s * m_blocksPerSplit;
+            const size_t b1 = std::min(m_groups, b0 + m_blocksPerSplit);
+            const size_t params = (p * m_groups + b0) * m_panel;
+            jit_gemv_decompress_call_args args{};
+            args.src = m_srcT.data() + b0 * m_group * M;
+            args.xsum = m_srcSums.data() + b0 * M;
+            args.wei = m_packedWeights.data() + (p * K + b0 * m_group) * rowBytes;
+            args.scales = m_packedScales.data() + params;
+            args.zero_points = m_packedZeroPoints.data() + params;
+            args.dst = m_partials.data() + (p * m_kSplit + s) * M * m_panel;
+            args.scale_stride = m_panel * sizeof(float);
+            args.blocks = b1 - b0;
+            args.block_k = m_group;
+            (*m_kernel)(&args);
+        });
+        ov::parallel_for(panels, [&](size_t p) {
+            for (size_t m = 0; m < M; m++) {
+                for (size_t c = 0; c < m_panel; c++) {
+                    float value = 0.F;
+                    for (size_t s = 0; s < m_kSplit; s++) {
+                        value += m_partials[((p * m_kSplit + s) * M + m) * m_panel + c];
+                    }
+                    m_dst[m * N + p * m_panel + c] = value;
+                }
+            }
+        });
+        return m_dst;
+    }
+
+    float reference(size_t m, size_t n) const {
+        float result = 0.F;
+        for (size_t k = 0; k < K; k++) {
+            const size_t g = k / m_group;
+            const float w = (value(m_weights[n * K + k]) - m_zeroPoints[n * m_groups + g]) * m_scales[n * m_groups + g];
+            result += m_src[m * K + k] * w;
+        }
+        return result;
+    }
+
+private:
+    bool isF8() const {
+        return m_type == ov::element::f8e4m3 || m_type == ov::element::f8e5m2;
+    }
+
+    float value(uint8_t code) const {
+        if (m_type == ov::element::f8e4m3) {
+            return static_cast<float>(ov::float8_e4m3::from_bits(code));
+        }
+        if (m_type == ov::element::f8e5m2) {
+            return static_cast<float>(ov::float8_e5m2::from_bits(code));
+        }
+        return static_cast<float>(code);
+    }
+
+    void pack() {
+        const size_t rowBytes = m_type == ov::element::u4 ? m_panel / 2 : m_panel;
+        m_packedWeights.resize(N * K * rowBytes / m_panel);
+        for (size_t p = 0; p < N / m_panel; p++) {
+            for (size_t k = 0; k < K; k++) {
+                auto* row = m_packedWeights.data() + (p * K + k) * rowBytes;
+                for (size_t c = 0; c < rowBytes; c++) {
+                    const auto w = m_weights[(p * m_panel + c) * K + k];
+                    row[c] = m_type != ov::element::u4
+                                 ? w
+                                 : static_cast<uint8_t>(w | (m_weights[(p * m_panel + rowBytes + c) * K + k] << 4));
+                }
+            }
+        }
+        // the kernel decodes f8e4m3 scaled by 2^-8
+        const float f8Scale = m_type == ov::element::f8e4m3 ? 256.F : 1.F;
+        m_packedScales.resize(N * m_groups);
+        m_packedZeroPoints.resize(N * m_groups);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t g = 0; g < m_groups; g++) {
+                const size_t i = ((n / m_panel) * m_groups + g) * m_panel + n % m_panel;
+                m_packedScales[i] = m_scales[n * m_groups + g] * f8Scale;
+                m_packedZeroPoints[i] = m_zeroPoints[n * m_groups + g] / f8Scale;
+            }
+        }
+        m_srcT.resize(K * M);
+        m_srcSums.assign(m_groups * M, 0.F);
+        for (size_t m = 0; m < M; m++) {
+            for (size_t k = 0; k < K; k++) {
+                m_srcT[k * M + m] = m_src[m * K + k];
+                m_srcSums[(k / m_group) * M + m] += m_src[m * K + k];
+            }
+        }
+    }
+
+    const ov::element::Type m_type;
+    const size_t M;
+    const size_t N;
+    const size_t K;
+    const size_t m_group;
+    const size_t m_groups;
+    const size_t m_panel;
+    size_t m_kSplit = 1;
+    size_t m_blocksPerSplit = 1;
+    std::vector<uint8_t> m_weights;
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+    std::vector<float> m_src;
+    std::vector<uint8_t> m_packedWeights;
+    std::vector<float> m_packedScales;
+    std::vector<float> m_packedZeroPoints;
+    std::vector<float> m_srcT;
+    std::vector<float> m_srcSums;
+    std::vector<float> m_partials;
+    std::vector<float> m_dst;
+    std::shared_ptr<JitKernelBase> m_kernel;
+};
+
+class GemvDecompressKernelTest : public ov::test::TestsCommon,
+                                 public testing::WithParamInterface<GemvDecompressParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<GemvDecompressParams>& obj) {
+        const auto& [type, M, N, K, group] = obj.param;
+        std::ostringstream result;
+        result << "Prec=" << type.to_string();
+        result << ",M=" << M;
+        result << ",N=" << N;
+        result << ",K=" << K;
+        result << ",group=" << group;
+        return result.str();
+    }
+};
+
+TEST_P(GemvDecompressKernelTest, compareWithReference) {
+    const auto& [type, M, N, K, group] = this->GetParam();
+    if (!mayiuse(avx2)) {
+        GTEST_SKIP();
+    }
+    GemvDecompress gemv(type, M, N, K, group);
+    const auto& dst = gemv.run();
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            const auto expected = gemv.reference(m, n);
+            ASSERT_NEAR(expected, dst[m * N + n], 1e-4F * std::max(1.F, std::abs(expected))) << m << "|" << n;
+        }
+    }
+}
+
+const std::vector<GemvDecompressParams> params = {{ov::element::u4, 1, 64, 256, 32},
+                                                  {ov::element::u4, 2, 64, 256, 64},
+                                                  {ov::element::u4, 3, 32, 128, 128},
+                                                  {ov::element::u4, 4, 96, 512, 128},
+                                                  {ov::element::u8, 1, 64, 256, 32},
+                                                  {ov::element::u8, 3, 64, 256, 64},
+                                                  {ov::element::u8, 4, 32, 128, 128},
+                                                  {ov::element::f8e4m3, 1, 64, 256, 32},
+                                                  {ov::element::f8e4m3, 4, 96, 512, 128},
+                                                  {ov::element::f8e5m2, 2, 64, 256, 64},
+                                                  {ov::element::f8e5m2, 3, 32, 128, 128}};
+
+INSTANTIATE_TEST_SUITE_P(GemvDecompressKernelUnitTest,
+                         GemvDecompressKernelTest,
+                         ::testing::ValuesIn(params),
+                         GemvDecompressKernelTest::getTestCaseName);
+
+// Micro-benchmark over the projections of a 7B LLM decode step, reports the weights bandwidth.
+// The f8 cases stream as many bytes as the u8 ones and show the cost of the conversion through f16.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*GemvDecompressKernelBenchmark*
+class GemvDecompressKernelBenchmark : public GemvDecompressKernelTest {};
+
+TEST_P(GemvDecompressKernelBenchmark, DISABLED_weightsBandwidth) {
+    const auto& [type, M, N, K, group] = this->GetParam();
+    if (!mayiuse(avx2)) {
+        GTEST_SKIP();
+    }
+    constexpr size_t warmup = 10;
+    constexpr size_t iterations = 100;
+    GemvDecompress gemv(type, M, N, K, group);
+    for (size_t i = 0; i < warmup; i++) {
+        gemv.run();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        gemv.run();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    const double us = elapsed.count() / iterations;
+    std::cout << getTestCaseName({this->GetParam(), 0}) << ": " << us << " us, "
+              << static_cast<double>(gemv.weightsBytes()) / us * 1e-3 << " GB/s" << std::endl;
+}
+
+const std::vector<GemvDecompressParams> llm_params = {{ov::element::u4, 1, 4096, 4096, 128},
+                                                      {ov::element::u4, 1, 11008, 4096, 128},
+                                                      {ov::element::u4, 1, 4096, 11008, 128},
+                                                      {ov::element::u4, 4, 4096, 4096, 128},
+                                                      {ov::element::u4, 4, 11008, 4096, 128},
+                                                      {ov::element::u4, 4, 4096, 11008, 128},
+                                                      {ov::element::u8, 1, 4096, 4096, 128},
+                                                      {ov::element::u8, 1, 11008, 4096, 128},
+                                                      {ov::element::u8, 1, 4096, 11008, 128},
+                                                      {ov::element::f8e4m3, 1, 4096, 4096, 128},
+                                                      {ov::element::f8e4m3, 1, 11008, 4096, 128},
+                                                      {ov::element::f8e4m3, 1, 4096, 11008, 128},
+                                                      {ov::element::f8e5m2, 1, 4096, 4096, 128}};
+
+INSTANTIATE_TEST_SUITE_P(GemvDecompressKernelUnitTest,
+                         GemvDecompressKernelBenchmark,
+                         ::testing::ValuesIn(llm_params),
+                         GemvDecompressKernelTest::getTestCaseName);
+}  // namespace gemvDecompressUnitTest
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "shape_inference/shape_inference_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// Doubles the first dimension and reports it as the padding, to check that paddings follow the cached shapes.
+class CountingShapeInfer final : public IShapeInfer {
+public:
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>&) override {
+        calls++;
+        auto dims = input_shapes.front().get();
+        dims[0] *= 2;
+        pads = ov::CoordinateDiff{static_cast<std::ptrdiff_t>(dims[0])};
+        return {{dims}, ShapeInferStatus::success};
+    }
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return pads;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return pads;
+    }
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+    size_t calls = 0;
+    ov::CoordinateDiff pads;
+};
+
+IShapeInfer::Result infer(IShapeInfer& shapeInfer, const VectorDims& dims) {
+    return shapeInfer.infer({std::cref(dims)}, {});
+}
+}  // namespace
+
+TEST(ShapeInferCacheTests, RecurringShapesAreNotInferredAgain) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    ShapeInferCached cached(counting, 2);
+
+    for (size_t iter = 0; iter < 3; ++iter) {
+        for (size_t seqLen : {64, 128}) {
+            const auto result = infer(cached, {seqLen, 16});
+            ASSERT_EQ(result.dims.front(), (VectorDims{2 * seqLen, 16}));
+            ASSERT_EQ(cached.get_pads_begin(), ov::CoordinateDiff{static_cast<std::ptrdiff_t>(2 * seqLen)});
+        }
+    }
+    EXPECT_EQ(counting->calls, 2U);
+    EXPECT_EQ(cached.hits(), 4U);
+    EXPECT_EQ(cached.misses(), 2U);
+}
+
+TEST(ShapeInferCacheTests, LeastRecentlyUsedShapeIsEvicted) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    ShapeInferCached cached(counting, 2);
+
+    infer(cached, {64});
+    infer(cached, {128});
+    infer(cached, {256});
+    infer(cached, {64});
+    EXPECT_EQ(counting->calls, 4U);
+    infer(cached, {256});
+    EXPECT_EQ(counting->calls, 4U);
+}
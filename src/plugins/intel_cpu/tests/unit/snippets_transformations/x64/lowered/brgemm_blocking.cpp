@@ -507,6 +507,61 @@ TEST_F(BrgemmCPUBlockingTest, AMX_FC) {
     }
 }
 
+class BrgemmCPUTunedBlockingTest : public BrgemmBlockingTest {
+public:
+    BrgemmCPUTunedBlockingTest() = default;
+
+    void SetUp() override {
+        m_blk = 64;
+        k_blk = 256;
+        // N block is not tuned: the heuristic one is expected
+        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>(
+            ov::intel_cpu::BrgemmBlockSizes{m_blk, 0, k_blk});
+    }
+};
+
+TEST_F(BrgemmCPUTunedBlockingTest, Floating) {
+    const ov::PartialShape input_shape_a{1, 384, 16, 1024};
+    const ov::PartialShape input_shape_b{1, 384, 16, 1024};
+    const auto precision = ov::element::f32;
+    const VectorDims layout_a{0, 2, 1, 3};
+    const VectorDims layout_b{0, 2, 3, 1};
+    const VectorDims layout_c{0, 2, 1, 3};
+    const BrgemmConfig brgemm_config(x64::cpu_isa_t::avx512_core, precision, precision, precision, false, false);
+
+    {
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second},
+                                                      brgemm_config,
+                                                      std::vector<PortDescriptor>{},
+                                                      PortDescriptor{0, 0},
+                                                      layout_a,
+                                                      layout_b,
+                                                      layout_c);
+        init_expr_descriptors(*brgemm.first, {}, {layout_a, layout_b, layout_c});
+        auto result = linear_ir->push_node<ov::snippets::op::Result>(brgemm.second);
+    }
+    {
+        auto data_a = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir_ref->push_node<BrgemmCPU>(OutputVector{data_a.second, data_b.second},
+                                                          brgemm_config,
+                                                          std::vector<PortDescriptor>{},
+                                                          PortDescriptor{0, 0},
+                                                          layout_a,
+                                                          layout_b,
+                                                          layout_c);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr,
+                              {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}},
+                              {layout_a, layout_b, layout_c});
+        create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, 384, m_blk, 1024, k_blk, 384, n_blk);
+        brgemm_expr->set_loop_ids({2, 1, 0});
+        auto result = linear_ir_ref->push_node<ov::snippets::op::Result>(brgemm.second);
+    }
+}
+
 #ifdef SNIPPETS_LIBXSMM_TPP
 class BrgemmTPPBlockingTest : public BrgemmBlockingTest {
 public:
@@ -539,7 +594,9 @@ TEST_F(BrgemmTPPBlockingTest, TPPFloating) {
         auto brgemm = linear_ir_ref->push_node<tpp::op::BrgemmTPP>(data_a.second, data_b.second, 0, 0, 0,
                                                                    layout_a, layout_b, layout_c);
         const auto& brgemm_expr = *brgemm.first;
-        init_expr_descriptors(brgemm_expr, {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}}, {layout_a, layout_b, layout_c});
+        init_expr_descriptors(brgemm_expr,
+                              {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}},
+                              {layout_a, layout_b, layout_c});
         create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, 384, m_blk, 1024, k_blk, 384, n_blk, BACKEND_TYPE::TPP);
         brgemm_expr->set_loop_ids({2, 1, 0});
         auto result = linear_ir_ref->push_node<ov::snippets::op::Result>(brgemm.second);
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/snippets/x64/pass/lowered/parallelize_gated_mlp_n_loops.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "lir_test_utils.hpp"
+#include "openvino/opsets/opset10_decl.hpp"
+#include "snippets/lowered/loop_info.hpp"
+#include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/result.hpp"
+#include "transformations/snippets/x64/op/brgemm_copy_b.hpp"
+#include "transformations/snippets/x64/op/brgemm_cpu.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+using namespace ov::intel_cpu;
+using namespace ov::snippets::lowered;
+using namespace dnnl::impl::cpu;
+using BrgemmConfig = intel_cpu::brgemm_utils::BrgemmConfig;
+using PortType = LoopPort::Type;
+
+class ParallelizeGatedMlpNLoopsTest : public ov::test::TestsCommon {
+protected:
+    // bf16 FullyConnected subgraph with the N blocked Brgemm, which A input is converted by EnforcePrecision:
+    // the A input isn't a Parameter, like the normalized rows of the normalization + FullyConnected subgraph
+    static bool is_n_loop_parallel(bool is_norm_fc) {
+        const ov::Dimension::value_type m = 4;
+        const ov::Dimension::value_type k = 1024;
+        const ov::Dimension::value_type n = 512;
+        const size_t n_blk = 64;
+        const size_t full_dim = ov::snippets::utils::get_full_dim_value();
+        const auto precision = ov::element::bf16;
+        const BrgemmConfig brgemm_config(x64::cpu_isa_t::avx512_core_bf16,
+                                         precision,
+                                         precision,
+                                         precision,
+                                         false,
+                                         false);
+
+        Config lir_config;
+        lir_config.m_manual_build_support = true;
+        const auto linear_ir = std::make_shared<LinearIR>(lir_config);
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(ov::element::f32, ov::PartialShape{1, m, k});
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, ov::PartialShape{1, k, n});
+        auto convert = linear_ir->push_node<ov::snippets::op::ConvertSaturation>(data_a.second, precision);
+        init_expr_descriptors(*convert.first);
+        auto copy_b = linear_ir->push_node<BrgemmCopyB>(data_b.second, brgemm_config);
+        init_expr_descriptors(*copy_b.first);
+        auto brgemm =
+            linear_ir->push_node<BrgemmCPU>(OutputVector{convert.second, copy_b.second->output(0)}, brgemm_config);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr, {{full_dim, full_dim}, {full_dim, n_blk}, {full_dim, n_blk}});
+        const std::vector<LoopPort> entries{LoopPort::create<PortType::NotProcessed>(brgemm_expr->get_input_port(0)),
+                                            LoopPort::create<PortType::Incremented>(brgemm_expr->get_input_port(1), 0)};
+        const std::vector<LoopPort> exits{LoopPort::create<PortType::Incremented>(brgemm_expr->get_output_port(0), 0)};
+        linear_ir->get_loop_manager()->add_loop_info(
+            std::make_shared<UnifiedLoopInfo>(n, n_blk, entries, exits, false));
+        brgemm_expr->set_loop_ids({0});
+        linear_ir->push_node<ov::snippets::op::Result>(brgemm.second);
+
+        ov::intel_cpu::pass::ParallelizeGatedMlpNLoops pass(is_norm_fc);
+        pass.run(*linear_ir, linear_ir->cbegin(), linear_ir->cend());
+        return linear_ir->get_loop_manager()->get_loop_info(0)->is_parallel();
+    }
+};
+
+TEST_F(ParallelizeGatedMlpNLoopsTest, PlainFullyConnectedIsUnchanged) {
+    EXPECT_FALSE(is_n_loop_parallel(false));
+}
+
+TEST_F(ParallelizeGatedMlpNLoopsTest, NormFullyConnected) {
+    EXPECT_TRUE(is_n_loop_parallel(true));
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/transpose.hpp"
+#include "transformations/cpu_opset/common/pass/move_eltwise_up_through_shape_ops.hpp"
+
+using namespace testing;
+
+class MoveEltwiseUpThroughShapeOpsTest : public TransformationTestsF {
+public:
+    MoveEltwiseUpThroughShapeOpsTest() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    }
+
+protected:
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::intel_cpu::MoveEltwiseUpThroughShapeOps>();
+    }
+};
+
+// [1,C,H,W] -> Reshape [1,C,H*W] -> Multiply [1,C,1] becomes Multiply [1,C,1,1] -> Reshape
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, PerChannelThroughReshape) {
+    const std::vector<float> scales{1.f, 2.f, 3.f, 4.f};
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1}, scales);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+        model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1, 1}, scales);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(relu, scale);
+        auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(mul, shape, false);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{reshape}, ov::ParameterVector{input});
+    }
+}
+
+// [1,C,H,W] -> Transpose [1,H,W,C] -> Add [C] becomes Add [1,C,1,1] -> Transpose
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, PerChannelThroughTranspose) {
+    const std::vector<float> bias{1.f, 2.f, 3.f};
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 4, 5});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 3, 1});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(relu, order);
+        auto bias_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{3}, bias);
+        auto add = std::make_shared<ov::op::v1::Add>(transpose, bias_const);
+        model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 4, 5});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto bias_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 3, 1, 1}, bias);
+        auto add = std::make_shared<ov::op::v1::Add>(relu, bias_const);
+        auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 3, 1});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(add, order);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{input});
+    }
+}
+
+// [1,C,1,1] -> Broadcast [1,C,H,W] -> Multiply [1,C,1,1] becomes Multiply -> Broadcast
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, PerChannelThroughBroadcast) {
+    const std::vector<float> scales{1.f, 2.f, 3.f, 4.f};
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 1, 1});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto target = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {1, 4, 8, 8});
+        auto broadcast = std::make_shared<ov::op::v3::Broadcast>(relu, target);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1, 1}, scales);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(broadcast, scale);
+        model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 1, 1});
+        auto relu = std::make_shared<ov::op::v0::Relu>(input);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1, 1}, scales);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(relu, scale);
+        auto target = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {1, 4, 8, 8});
+        auto broadcast = std::make_shared<ov::op::v3::Broadcast>(mul, target);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{broadcast}, ov::ParameterVector{input});
+    }
+}
+
+// the constant covers a part of the merged dimensions only, so it can't be mapped to the reshape input
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, PartialGroupIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 8, 8});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 8}, std::vector<float>(8, 2.f));
+    auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+    model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+}
+
+// nothing is fused with the moved eltwise when the shape op doesn't follow an eltwise
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, NoEltwiseBeforeIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(input, shape, false);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1}, {1.f, 2.f, 3.f, 4.f});
+    auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+    model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+}
+
+// [1,64] -> Reshape [1,8,8]: the constant [1,8,1] covers a part of the split dimension only
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, PartiallyCoveredSplitIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 8, 8});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 8, 1}, std::vector<float>(8, 2.f));
+    auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+    model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+}
+
+// the integer eltwise ops are left to LPT
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, IntegerConstantIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{1, 4, 8, 8});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+    auto scale = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1, 4, 1}, {1, 2, 3, 4});
+    auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+    model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+}
+
+// the other consumer of the reshape needs the output without the eltwise applied
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, ShapeOpWithSeveralConsumersIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 8, 8});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{3}, {1, 4, 64});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4, 1}, {1.f, 2.f, 3.f, 4.f});
+    auto mul = std::make_shared<ov::op::v1::Multiply>(reshape, scale);
+    auto reshape_result = std::make_shared<ov::op::v0::Result>(reshape);
+    auto mul_result = std::make_shared<ov::op::v0::Result>(mul);
+    model = std::make_shared<ov::Model>(ov::ResultVector{mul_result, reshape_result}, ov::ParameterVector{input});
+}
+
+// [1,C,1,1] -> Broadcast [1,C,H,W]: the constant [1,1,H,1] varies along a broadcasted dimension
+TEST_F(MoveEltwiseUpThroughShapeOpsTest, ConstantAlongBroadcastedDimIsNotMoved) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 1, 1});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto target = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {1, 4, 8, 8});
+    auto broadcast = std::make_shared<ov::op::v3::Broadcast>(relu, target);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32,
+                                              ov::Shape{1, 1, 8, 1},
+                                              {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+    auto mul = std::make_shared<ov::op::v1::Multiply>(broadcast, scale);
+    model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{input});
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+#include "snippets_helpers.hpp"
+#include "subgraph_norm_fc.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+using NormFCParams = std::tuple<
+    std::pair<InputShape, Shape>,              // InputShape + Weights shape
+    NormFCFunction::NormType,                  // Normalization type
+    ov::element::Type,                         // Inference precision
+    size_t,                                    // Expected num nodes
+    size_t,                                    // Expected num subgraphs
+    std::string,                               // Target Device
+    ov::AnyMap                                 // Config
+>;
+
+class NormFC : public testing::WithParamInterface<NormFCParams>,
+               virtual public SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ov::test::snippets::NormFCParams>& obj);
+protected:
+    void SetUp() override;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
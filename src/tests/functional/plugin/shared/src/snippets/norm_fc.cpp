@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/norm_fc.hpp"
+
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "subgraph_norm_fc.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+void NormFC::SetUp() {
+    const auto& [shapes, normType, prc, target_num_nodes, target_num_subgraphs, device, additional_config] =
+        this->GetParam();
+    const auto& [inShape, weightsShape] = shapes;
+
+    ref_num_nodes = target_num_nodes;
+    ref_num_subgraphs = target_num_subgraphs;
+    targetDevice = device;
+
+    init_input_shapes({inShape});
+
+    const auto subgraph_model = ov::test::snippets::NormFCFunction(inputDynamicShapes, weightsShape, normType);
+    function = subgraph_model.getOriginal();
+
+    configuration.insert(additional_config.begin(), additional_config.end());
+    setIgnoreCallbackMode();
+
+    inType = outType = prc;
+    setInferenceType(prc);
+}
+
+std::string NormFC::getTestCaseName(const testing::TestParamInfo<ov::test::snippets::NormFCParams>& obj) {
+    const auto& [shapes, normType, prc, num_nodes, num_subgraphs, target_device, additional_config] = obj.param;
+    const auto& [inputShape, weightsShape] = shapes;
+
+    std::ostringstream result;
+    result << "InputShape=" << inputShape << "_";
+    result << "weightsShape=" << ov::test::utils::vec2str(weightsShape) << "_";
+    result << "NormType=" << normType << "_";
+    result << "Prc=" << prc << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << target_device << "_";
+
+    if (!additional_config.empty()) {
+        result << "_PluginConf";
+        for (auto& item : additional_config) {
+            result << "_" << item.first << "=" << item.second.as<std::string>();
+        }
+    }
+    return result.str();
+}
+
+TEST_P(NormFC, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "snippets_helpers.hpp"
+
+/* The file contains graphs with the normalization followed by FullyConnected:
+ *        Pattern:
+ *              Input
+ *                |
+ *           RMS or MVN
+ *                |
+ *      [Multiply (MVN gamma)]
+ *                |
+ *        [Add (MVN beta)]
+ *                |
+ *          FullyConnected
+ */
+
+namespace ov::test::snippets {
+
+class NormFCFunction : public SnippetsFunctionBase {
+public:
+    enum class NormType {
+        RMS,
+        MVN,
+    };
+
+    explicit NormFCFunction(const std::vector<PartialShape>& input_shapes,
+                            const Shape& weights_shape,
+                            NormType norm_type)
+        : SnippetsFunctionBase(input_shapes),
+          m_weights_shape(weights_shape),
+          m_norm_type(norm_type) {
+        OPENVINO_ASSERT(input_shapes.size() == 1, "NormFCFunction expects 1 input shape");
+        OPENVINO_ASSERT(input_shapes[0].rank().is_static() && input_shapes[0].rbegin()->is_static(),
+                        "NormFCFunction expects static normalized dimension");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+
+    // Returns the normalization with the affine ops consuming the given gamma (and beta for MVN)
+    std::shared_ptr<ov::Node> makeNorm(const ov::Output<ov::Node>& data, const OutputVector& constants) const;
+    OutputVector makeNormConstants() const;
+
+    const Shape m_weights_shape {};
+    const NormType m_norm_type = {};
+};
+
+std::ostream& operator<<(std::ostream& os, NormFCFunction::NormType type);
+
+}  // namespace ov::test::snippets
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_norm_fc.hpp"
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/op/result.hpp"
+#include "snippets/op/subgraph.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::ostream& operator<<(std::ostream& os, NormFCFunction::NormType type) {
+    switch (type) {
+    case NormFCFunction::NormType::RMS:
+        os << "RMS";
+        break;
+    case NormFCFunction::NormType::MVN:
+        os << "MVN";
+        break;
+    default:
+        OPENVINO_THROW("Unexpected normalization type!");
+    }
+    return os;
+}
+
+OutputVector NormFCFunction::makeNormConstants() const {
+    const auto channels = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+    utils::InputGenerateData gen_data;
+    gen_data.seed = 3;
+    OutputVector constants{ov::test::utils::make_constant(precision, Shape{channels}, gen_data)};
+    if (m_norm_type == NormType::MVN) {
+        gen_data.seed = 7;
+        constants.push_back(ov::test::utils::make_constant(precision, Shape{channels}, gen_data));
+    }
+    return constants;
+}
+
+std::shared_ptr<ov::Node> NormFCFunction::makeNorm(const ov::Output<ov::Node>& data,
+                                                   const OutputVector& constants) const {
+    constexpr double eps = 1e-5;
+    switch (m_norm_type) {
+    case NormType::RMS:
+        return std::make_shared<ov::op::internal::RMS>(data, constants[0], eps, precision);
+    case NormType::MVN: {
+        const auto axes = ov::op::v0::Constant::create(ov::element::i64, Shape{1}, {-1});
+        const auto mvn = std::make_shared<ov::op::v6::MVN>(data, axes, true, eps, ov::op::MVNEpsMode::INSIDE_SQRT);
+        const auto gamma = std::make_shared<ov::op::v1::Multiply>(mvn, constants[0]);
+        return std::make_shared<ov::op::v1::Add>(gamma, constants[1]);
+    }
+    default:
+        OPENVINO_THROW("Unexpected normalization type!");
+    }
+}
+
+std::shared_ptr<ov::Model> NormFCFunction::initOriginal() const {
+    auto param = std::make_shared<ov::op::v0::Parameter>(precision, input_shapes[0]);
+    const auto weights = ov::test::utils::make_constant(precision, m_weights_shape);
+
+    const auto norm = makeNorm(param, makeNormConstants());
+    const auto fc = std::make_shared<ov::op::v0::MatMul>(norm, weights, false, true);
+
+    auto result = std::make_shared<ov::op::v0::Result>(fc);
+    return std::make_shared<Model>(ResultVector{result}, ParameterVector{param});
+}
+
+std::shared_ptr<ov::Model> NormFCFunction::initReference() const {
+    auto data = std::make_shared<ov::op::v0::Parameter>(precision, input_shapes[0]);
+    const auto weights = ov::test::utils::make_constant(precision, m_weights_shape);
+
+    OutputVector subgraph_inputs{data};
+    ParameterVector body_params{std::make_shared<ov::op::v0::Parameter>(precision, input_shapes[0])};
+    OutputVector body_constants;
+    for (const auto& constant : makeNormConstants()) {
+        subgraph_inputs.push_back(constant);
+        body_params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, constant.get_partial_shape()));
+        body_constants.push_back(body_params.back());
+    }
+    subgraph_inputs.push_back(weights);
+    body_params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, weights->get_output_partial_shape(0)));
+
+    const auto norm = makeNorm(body_params.front(), body_constants);
+    const auto fc = std::make_shared<ov::op::v0::MatMul>(norm, body_params.back(), false, true);
+    auto snippets_result = std::make_shared<ov::snippets::op::Result>(fc);
+    auto subgraph = std::make_shared<ov::snippets::op::Subgraph>(
+        subgraph_inputs,
+        std::make_shared<ov::Model>(OutputVector{snippets_result}, body_params));
+
+    return std::make_shared<Model>(OutputVector{subgraph}, ParameterVector{data});
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov